@@ -0,0 +1,84 @@
+#ifndef EXTRADISTR_BERNOULLI_DISTRIBUTION_H
+#define EXTRADISTR_BERNOULLI_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+*  Bernoulli distribution
+*
+*  Values:
+*  x
+*
+*  Parameters:
+*  0 <= p <= 1
+*
+*/
+
+inline double pdf_bernoulli(double x, double prob,
+                            bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(prob))
+    return x+prob;
+#endif
+  if (!VALID_PROB(prob)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x == 1.0)
+    return prob;
+  if (x == 0.0)
+    return 1.0 - prob;
+  
+  char msg[55];
+  std::snprintf(msg, sizeof(msg), "improper x = %f", x);
+  kernel_warning(msg);
+  
+  return 0.0;
+}
+
+inline double cdf_bernoulli(double x, double prob,
+                            bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(prob))
+    return x+prob;
+#endif
+  if (!VALID_PROB(prob)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0)
+    return 0.0;
+  if (x < 1.0)
+    return 1.0 - prob;
+  return 1.0;
+}
+
+inline double invcdf_bernoulli(double p, double prob,
+                               bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(prob))
+    return p+prob;
+#endif
+  if (!VALID_PROB(prob) || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  return (p <= (1.0 - prob)) ? 0.0 : 1.0;
+}
+
+inline double rng_bernoulli(double prob, bool& throw_warning) {
+  if (ISNAN(prob) || !VALID_PROB(prob)) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double u = rng_unif();
+  return (u > prob) ? 0.0 : 1.0;
+}
+
+}
+
+
+#endif
@@ -0,0 +1,217 @@
+#ifndef EXTRADISTR_BETA_BINOMIAL_DISTRIBUTION_H
+#define EXTRADISTR_BETA_BINOMIAL_DISTRIBUTION_H
+
+#include <limits>
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+*  Beta-binomial distribution
+*
+*  Values:
+*  x
+*
+*  Parameters:
+*  k > 0
+*  alpha > 0
+*  beta > 0
+*
+*  f(k) = choose(n, k) * (beta(k+alpha, n-k+beta)) / (beta(alpha, beta))
+*
+*/
+
+
+inline double logpmf_bbinom(double k, double n, double alpha,
+                            double beta, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(k) || ISNAN(n) || ISNAN(alpha) || ISNAN(beta))
+    return k+n+alpha+beta;
+#endif
+  if (alpha < 0.0 || beta < 0.0 || n < 0.0 || !isInteger(n, false)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (!isInteger(k) || k < 0.0 || k > n)
+    return R_NegInf;
+  // R::choose(n, k) * R::beta(k+alpha, n-k+beta) / R::beta(alpha, beta);
+  return lchoose_fn(n, k) + lbeta_fn(k+alpha, n-k+beta) - lbeta_fn(alpha, beta);
+}
+
+inline double rng_bbinom(double n, double alpha,
+                         double beta, bool& throw_warning) {
+  if (ISNAN(n) || ISNAN(alpha) || ISNAN(beta) ||
+      alpha < 0.0 || beta < 0.0 || n < 0.0 || !isInteger(n, false)) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double prob = rng_beta(alpha, beta);
+  return rng_binom(n, prob);
+}
+
+
+
+/*
+ * Cumulative distribution function without tables
+ *
+ * log P(X <= k), for 0 <= k < n, is log f(k) plus the log of the sum
+ * of f(j)/f(k) for j = k, k-1, ..., 0, where the consecutive ratios are
+ *
+ * f(j-1)/f(j) = j/(j-1+alpha) * (n-j+beta)/(n-j+1)
+ *
+ * With alpha >= 1 the first factor does not grow when going down and the
+ * second one is bounded by max(1, (n-j+beta)/(n-j+1)), that does not grow
+ * either, so the remaining terms are bounded by a geometric series and
+ * the summation stops when the bound is negligible. Otherwise all the
+ * terms are summed. The sum is rescaled when it grows large, so terms
+ * far in the tails do not overflow nor underflow.
+ *
+ * The upper tail is the lower tail of n-X ~ BB(n, beta, alpha), the tail
+ * on the side of k with respect to the mean is computed and the other one
+ * is its complement.
+ *
+ */
+
+inline double lcdf_bbinom_sum(double k, double n, double alpha, double beta) {
+  const double eps = std::numeric_limits<double>::epsilon();
+  double s = 1.0, t = 1.0, lscale = 0.0;
+  for (double j = k; j > 0.0; j -= 1.0) {
+    double f1 = j / (j - 1.0 + alpha);
+    double f2 = (n - j + beta) / (n - j + 1.0);
+    t *= f1 * f2;
+    s += t;
+    if (alpha >= 1.0) {
+      double rb = f1 * std::max(1.0, f2);
+      if (rb < 1.0 && t * rb <= eps * s * (1.0 - rb))
+        break;
+    }
+    if (s > 1e250) {
+      lscale += std::log(s);
+      t /= s;
+      s = 1.0;
+    }
+  }
+  return lchoose_fn(n, k) + lbeta_fn(k+alpha, n-k+beta) -
+    lbeta_fn(alpha, beta) + lscale + std::log(s);
+}
+
+inline double cdf_bbinom(double x, double n, double alpha, double beta,
+                         bool lower_tail, bool log_p, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(n) || ISNAN(alpha) || ISNAN(beta))
+    return x+n+alpha+beta;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0 || n < 0.0 || !isInteger(n, false)) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  double lp;
+  bool lower;
+  
+  if (x < 0.0 || x >= n) {
+    lp = 0.0;
+    lower = x >= n;
+  } else {
+    double k = std::floor(x);
+    lower = k < n * alpha / (alpha + beta);
+    if (lower)
+      lp = lcdf_bbinom_sum(k, n, alpha, beta);
+    else
+      lp = lcdf_bbinom_sum(n - k - 1.0, n, beta, alpha);
+    if (lp > 0.0)
+      lp = 0.0;
+  }
+  
+  // lp is log of the lower (or upper) tail probability
+  if (lower != lower_tail)
+    lp = (lp > -LOG_2F) ? std::log(-std::expm1(lp)) : log1p(-std::exp(lp));
+  return log_p ? lp : std::exp(lp);
+}
+
+// the search starts from the normal approximation
+
+inline double invcdf_bbinom(double p, double n, double alpha, double beta,
+                            bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(n) || ISNAN(alpha) || ISNAN(beta))
+    return p+n+alpha+beta;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0 || n < 0.0 ||
+      !isInteger(n, false) || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (p == 0.0)
+    return 0.0;
+  if (p == 1.0)
+    return n;
+  
+  double ab = alpha + beta;
+  double mu = n * alpha / ab;
+  double sigma = std::sqrt(n * alpha * beta * (ab + n) / (ab * ab * (ab + 1.0)));
+  
+  return discrete_quantile(p, mu + sigma * InvPhi(p), 0.0, n, [&](double x) {
+    return cdf_bbinom(x, n, alpha, beta, true, false, throw_warning);
+  });
+}
+
+
+
+/*
+ * Beta-binomial distribution with fixed parameters
+ *
+ * The parameters are validated and log(beta(alpha, beta)) is computed
+ * once, when the object is created. The results are the same as from
+ * logpmf_bbinom and rng_bbinom.
+ *
+ */
+
+class BbinomFrozen {
+
+  double n, alpha, beta;
+  bool nan_param, invalid;
+  double lbeta_ab;
+
+public:
+
+  BbinomFrozen(double n, double alpha, double beta)
+    : n(n), alpha(alpha), beta(beta) {
+    nan_param = ISNAN(n) || ISNAN(alpha) || ISNAN(beta);
+    invalid = nan_param || alpha < 0.0 || beta < 0.0 || n < 0.0 ||
+      !isInteger(n, false);
+    lbeta_ab = invalid ? NAN : lbeta_fn(alpha, beta);
+  }
+
+  inline double pdf(double k, bool log_prob, bool& throw_warning) const {
+    double lp;
+#ifdef IEEE_754
+    if (ISNAN(k) || nan_param)
+      return k+n+alpha+beta;
+#endif
+    if (invalid) {
+      throw_warning = true;
+      return NAN;
+    }
+    if (!isInteger(k) || k < 0.0 || k > n)
+      lp = R_NegInf;
+    else
+      lp = lchoose_fn(n, k) + lbeta_fn(k+alpha, n-k+beta) - lbeta_ab;
+    return log_prob ? lp : std::exp(lp);
+  }
+
+  inline double rng(bool& throw_warning) const {
+    if (invalid) {
+      throw_warning = true;
+      return NA_REAL;
+    }
+    double prob = rng_beta(alpha, beta);
+    return rng_binom(n, prob);
+  }
+
+};
+}
+
+
+#endif
@@ -0,0 +1,256 @@
+#ifndef EXTRADISTR_BETA_NEGATIVE_BINOMIAL_DISTRIBUTION_H
+#define EXTRADISTR_BETA_NEGATIVE_BINOMIAL_DISTRIBUTION_H
+
+#include <limits>
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+*  Beta-negative binomial distribution
+*
+*  Values:
+*  x
+*
+*  Parameters:
+*  r > 0
+*  alpha > 0
+*  beta > 0
+*
+*  f(k) = gamma(r+k)/(k! gamma(r)) * beta(alpha+r, beta+k)/beta(alpha, beta)
+*
+*/
+
+
+inline double logpmf_bnbinom(double k, double r, double alpha,
+                             double beta, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(k) || ISNAN(r) || ISNAN(alpha) || ISNAN(beta))
+    return k+r+alpha+beta;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0 || r < 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (!isInteger(k) || k < 0.0 || !R_FINITE(k))
+    return R_NegInf;
+  // (R::gammafn(r+k) / (R::gammafn(k+1.0) * R::gammafn(r))) *
+  //     R::beta(alpha+r, beta+k) / R::beta(alpha, beta);
+  return (lgamma_fn(r+k) - lgamma_fn(k+1.0) - lgamma_fn(r)) +
+    lbeta_fn(alpha+r, beta+k) - lbeta_fn(alpha, beta);
+}
+
+inline double rng_bnbinom(double r, double alpha,
+                          double beta, bool& throw_warning) {
+  if (ISNAN(r) || ISNAN(alpha) || ISNAN(beta) || alpha <= 0.0 ||
+      beta <= 0.0 || r < 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double prob = rng_beta(alpha, beta);
+  return rng_nbinom(r, prob);
+}
+
+
+/*
+ * Cumulative distribution function without tables
+ *
+ * log P(X <= k) is log f(k) plus the log of the sum of f(j)/f(k) for
+ * j = k, k-1, ..., 0, where the consecutive ratios are
+ *
+ * f(j-1)/f(j) = j/(r+j-1) * (alpha+r+beta+j-1)/(beta+j-1)
+ *
+ * With r >= 1 the first factor does not grow when going down, and the
+ * second one is at most (alpha+r+beta)/beta, so when their product is
+ * below one the remaining terms are bounded by a geometric series and
+ * the summation stops when the bound is negligible.
+ *
+ * The sum takes O(k) steps for heavy tails, so for large k the upper tail
+ * is used instead. X is negative binomial with probability p ~ Beta(alpha,
+ * beta), so P(X > k) = P(p <= T) = E[I(T; alpha, beta)] for independent
+ * T ~ Beta(r, k+1), where I is the regularized incomplete beta function.
+ * Expanding I(t; alpha, beta) in powers of t and taking the expectations
+ * E[T^(alpha+n)] = B(r+alpha+n, k+1) / B(r, k+1) gives
+ *
+ * P(X > k) = B(r+alpha, k+1) / (B(r, k+1) * B(alpha, beta)) *
+ *            sum_n (1-beta)_n / (n! * (alpha+n)) * c_n
+ *
+ * c_0 = 1, c_(n+1) = c_n * (r+alpha+n) / (r+alpha+k+1+n)
+ *
+ * The terms decrease at least as fast as (r+alpha+n)/(r+alpha+k+1+n),
+ * so for k >= 4*(r+alpha) a few tens of terms suffice whatever the size
+ * of k. Terms change sign while n < beta-1 and they grow up to about
+ * exp(beta*(r+alpha)/k) times the first one, so the series is used only
+ * when beta*(r+alpha) is not much above k.
+ *
+ */
+
+inline double lcdf_bnbinom_sum(double k, double r, double alpha, double beta) {
+  const double eps = std::numeric_limits<double>::epsilon();
+  double g1 = (alpha + r + beta) / beta;
+  double s = 1.0, t = 1.0, lscale = 0.0;
+  for (double j = k; j > 0.0; j -= 1.0) {
+    double f1 = j / (r + j - 1.0);
+    t *= f1 * (alpha + r + beta + j - 1.0) / (beta + j - 1.0);
+    s += t;
+    if (r >= 1.0) {
+      double rb = f1 * g1;
+      if (rb < 1.0 && t * rb <= eps * s * (1.0 - rb))
+        break;
+    }
+    if (s > 1e250) {
+      lscale += std::log(s);
+      t /= s;
+      s = 1.0;
+    }
+  }
+  return (lgamma_fn(r+k) - lgamma_fn(k+1.0) - lgamma_fn(r)) +
+    lbeta_fn(alpha+r, beta+k) - lbeta_fn(alpha, beta) + lscale + std::log(s);
+}
+
+inline bool use_lccdf_bnbinom_series(double k, double r, double alpha,
+                                     double beta) {
+  double c = r + alpha;
+  return r > 0.0 && k >= 16.0 && k + 1.0 >= 4.0 * c &&
+    (beta - 1.0) * c <= k + 1.0;
+}
+
+inline double lccdf_bnbinom_series(double k, double r, double alpha,
+                                   double beta) {
+  const double eps = std::numeric_limits<double>::epsilon();
+  double c = r + alpha;
+  double cn = 1.0, s = 1.0 / alpha;
+  for (double n = 0.0; n < 1e4; n += 1.0) {
+    cn *= (n + 1.0 - beta) / (n + 1.0) * (c + n) / (c + k + 1.0 + n);
+    double u = cn / (alpha + n + 1.0);
+    s += u;
+    // once the signs stop changing, the remaining terms sum to less
+    // than u * (c+n+1)/(k+1)
+    if (n + 1.0 > beta && std::abs(u) * (c + n + 2.0) <= eps * s * (k + 1.0))
+      break;
+  }
+  return std::log(s) + lbeta_fn(c, k + 1.0) - lbeta_fn(r, k + 1.0) -
+    lbeta_fn(alpha, beta);
+}
+
+inline double cdf_bnbinom(double x, double r, double alpha, double beta,
+                          bool lower_tail, bool log_p, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(r) || ISNAN(alpha) || ISNAN(beta))
+    return x+r+alpha+beta;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0 || r < 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  double lp;
+  bool lower = true;
+  
+  if (x < 0.0) {
+    lp = R_NegInf;
+  } else if (x == R_PosInf) {
+    lp = 0.0;
+  } else {
+    double k = std::floor(x);
+    // below the median, where the upper tail is above one half, the
+    // lower tail is summed when it is cheap, so that it keeps its
+    // relative accuracy
+    lower = !use_lccdf_bnbinom_series(k, r, alpha, beta);
+    if (!lower) {
+      lp = lccdf_bnbinom_series(k, r, alpha, beta);
+      lower = lp > -LOG_2F && k <= 1e4;
+    }
+    if (lower)
+      lp = lcdf_bnbinom_sum(k, r, alpha, beta);
+    lp = std::min(0.0, lp);
+  }
+  
+  // lp is log of the lower (or upper) tail probability
+  if (lower != lower_tail)
+    lp = (lp > -LOG_2F) ? std::log(-std::expm1(lp)) : log1p(-std::exp(lp));
+  return log_p ? lp : std::exp(lp);
+}
+
+// the search starts from the normal approximation when the variance
+// is finite (alpha > 2), from the mean when it exists, or from zero
+
+inline double invcdf_bnbinom(double p, double r, double alpha, double beta,
+                             bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(r) || ISNAN(alpha) || ISNAN(beta))
+    return p+r+alpha+beta;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0 || r < 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (p == 0.0)
+    return 0.0;
+  if (p == 1.0)
+    return R_PosInf;
+  
+  double x0 = 0.0;
+  if (alpha > 1.0)
+    x0 = r * beta / (alpha - 1.0);
+  if (alpha > 2.0) {
+    double var = r * beta * (r + alpha - 1.0) * (beta + alpha - 1.0) /
+      ((alpha - 2.0) * (alpha - 1.0) * (alpha - 1.0));
+    x0 += std::sqrt(var) * InvPhi(p);
+  }
+  
+  return discrete_quantile(p, x0, 0.0, R_PosInf, [&](double x) {
+    return cdf_bnbinom(x, r, alpha, beta, true, false, throw_warning);
+  });
+}
+
+
+/*
+ * Beta-negative binomial distribution with fixed parameters
+ *
+ * The parameters are validated and log(gamma(r)) and log(beta(alpha, beta))
+ * are computed once, when the object is created. The results are the same
+ * as from logpmf_bnbinom.
+ *
+ */
+
+class BnbinomFrozen {
+
+  double r, alpha, beta;
+  bool nan_param, invalid;
+  double lgamma_r, lbeta_ab;
+
+public:
+
+  BnbinomFrozen(double r, double alpha, double beta)
+    : r(r), alpha(alpha), beta(beta) {
+    nan_param = ISNAN(r) || ISNAN(alpha) || ISNAN(beta);
+    invalid = nan_param || alpha <= 0.0 || beta <= 0.0 || r < 0.0;
+    lgamma_r = invalid ? NAN : lgamma_fn(r);
+    lbeta_ab = invalid ? NAN : lbeta_fn(alpha, beta);
+  }
+
+  inline double pdf(double k, bool log_prob, bool& throw_warning) const {
+    double lp;
+#ifdef IEEE_754
+    if (ISNAN(k) || nan_param)
+      return k+r+alpha+beta;
+#endif
+    if (invalid) {
+      throw_warning = true;
+      return NAN;
+    }
+    if (!isInteger(k) || k < 0.0 || !R_FINITE(k))
+      lp = R_NegInf;
+    else
+      lp = (lgamma_fn(r+k) - lgamma_fn(k+1.0) - lgamma_r) +
+        lbeta_fn(alpha+r, beta+k) - lbeta_ab;
+    return log_prob ? lp : std::exp(lp);
+  }
+
+};
+}
+
+
+#endif
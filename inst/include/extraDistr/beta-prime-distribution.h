@@ -0,0 +1,147 @@
+#ifndef EXTRADISTR_BETA_PRIME_DISTRIBUTION_H
+#define EXTRADISTR_BETA_PRIME_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+*  Beta prime distribution
+*
+*  Values:
+*  x > 0
+*
+*  Parameters:
+*  alpha > 0
+*  beta > 0
+*  sigma > 0
+*
+*/
+
+
+inline double logpdf_betapr(double x, double alpha, double beta,
+                            double sigma, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta) || ISNAN(sigma))
+    return x+alpha+beta+sigma;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0 || sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x <= 0.0 || !R_FINITE(x))
+    return R_NegInf;
+  double z = x / sigma;
+  // pow(z, alpha-1.0) * pow(z+1.0, -alpha-beta) / R::beta(alpha, beta) / sigma;
+  return std::log(z) * (alpha-1.0) + log1p(z) * (-alpha-beta) -
+    lbeta_fn(alpha, beta) - std::log(sigma);
+}
+
+inline double cdf_betapr(double x, double alpha, double beta,
+                         double sigma, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta) || ISNAN(sigma))
+    return x+alpha+beta+sigma;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0 || sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x <= 0.0)
+    return 0.0;
+  if (!R_FINITE(x))
+    return 1.0;
+  double z = x / sigma;
+  return R::pbeta(z/(1.0+z), alpha, beta, true, false);
+}
+
+inline double invcdf_betapr(double p, double alpha, double beta,
+                            double sigma, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(alpha) || ISNAN(beta) || ISNAN(sigma))
+    return p+alpha+beta+sigma;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0 || sigma <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (p == 0.0)
+    return 0.0;
+  if (p == 1.0)
+    return R_PosInf;
+  double x = R::qbeta(p, alpha, beta, true, false);
+  return x/(1.0-x) * sigma;
+}
+
+inline double rng_betapr(double alpha, double beta,
+                         double sigma, bool& throw_warning) {
+  if (ISNAN(alpha) || ISNAN(beta) || ISNAN(sigma) ||
+      alpha <= 0.0 || beta <= 0.0 || sigma <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+#ifndef EXTRADISTR_STANDALONE
+  if (rng_stream() == NULL) {
+    double x = rng_beta(alpha, beta);
+    return x/(1.0-x) * sigma;
+  }
+#endif
+  // X/Y for independent gammas, in log scale so that it is not 0/0
+  // when both underflow for small shapes
+  double lx = rng_log_gamma(alpha);
+  double ly = rng_log_gamma(beta);
+  return std::exp(lx - ly) * sigma;
+}
+
+
+/*
+ * Beta prime distribution with fixed parameters
+ *
+ * The parameters are validated and log(beta(alpha, beta)) and log(sigma)
+ * are computed once, when the object is created. The results are the same
+ * as from logpdf_betapr.
+ *
+ */
+
+class BetaprFrozen {
+
+  double alpha, beta, sigma;
+  bool nan_param, invalid;
+  double lbeta_ab, log_sigma;
+
+public:
+
+  BetaprFrozen(double alpha, double beta, double sigma)
+    : alpha(alpha), beta(beta), sigma(sigma) {
+    nan_param = ISNAN(alpha) || ISNAN(beta) || ISNAN(sigma);
+    invalid = nan_param || alpha <= 0.0 || beta <= 0.0 || sigma <= 0.0;
+    lbeta_ab = invalid ? NAN : lbeta_fn(alpha, beta);
+    log_sigma = invalid ? NAN : std::log(sigma);
+  }
+
+  inline double pdf(double x, bool log_prob, bool& throw_warning) const {
+    double lp;
+#ifdef IEEE_754
+    if (ISNAN(x) || nan_param)
+      return x+alpha+beta+sigma;
+#endif
+    if (invalid) {
+      throw_warning = true;
+      return NAN;
+    }
+    if (x <= 0.0 || !R_FINITE(x)) {
+      lp = R_NegInf;
+    } else {
+      double z = x / sigma;
+      lp = std::log(z) * (alpha-1.0) + log1p(z) * (-alpha-beta) -
+        lbeta_ab - log_sigma;
+    }
+    return log_prob ? lp : std::exp(lp);
+  }
+
+};
+}
+
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef EXTRADISTR_BHATTACHARJEE_DISTRIBUTION_H
+#define EXTRADISTR_BHATTACHARJEE_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+ * Bhattacharjee distribution
+ * 
+ * Parameters:
+ * mu
+ * sigma >= 0
+ * a >= 0
+ * 
+ * Bhattacharjee, G.P., Pandit, S.N.N., and Mohan, R. (1963).
+ * Dimensional chains involving rectangular and normal error-distributions.
+ * Technometrics, 5, 404-406.
+ * 
+ */
+
+inline double G(double x) {
+  return x * Phi(x) + phi(x);
+}
+
+inline double pdf_bhattacharjee(double x, double mu, double sigma,
+                                double a, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(a))
+    return x+mu+sigma+a;
+#endif
+  if (sigma < 0.0 || a < 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (sigma == 0.0)
+    return R::dunif(x, mu-a, mu+a, false);
+  if (a == 0.0)
+    return R::dnorm(x, mu, sigma, false);
+  double z = x-mu;
+  return (Phi((z+a)/sigma) - Phi((z-a)/sigma)) / (2.0*a);
+}
+
+inline double cdf_bhattacharjee(double x, double mu, double sigma,
+                                double a, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(a))
+    return x+mu+sigma+a;
+#endif
+  if (sigma < 0.0 || a < 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x == R_NegInf)
+    return 0.0;
+  if (x == R_PosInf)
+    return 1.0;
+  if (sigma == 0.0)
+    return R::punif(x, mu-a, mu+a, true, false);
+  if (a == 0.0)
+    return R::pnorm(x, mu, sigma, true, false);
+  double z = x-mu;
+  return sigma/(2.0*a) * (G((z+a)/sigma) - G((z-a)/sigma));
+}
+
+inline double rng_bhattacharjee(double mu, double sigma,
+                                double a, bool& throw_warning) {
+  if (ISNAN(mu) || ISNAN(sigma) || ISNAN(a) || sigma < 0.0 || a < 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  if (sigma == 0.0)
+    return rng_unif(mu-a, mu+a);
+  if (a == 0.0)
+    return rng_norm(mu, sigma);
+  return rng_unif(-a, a) + rng_norm() * sigma + mu;
+}
+
+}
+
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef EXTRADISTR_BIRNBAUM_SAUNDERS_DISTRIBUTION_H
+#define EXTRADISTR_BIRNBAUM_SAUNDERS_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+ * Birnbaum-Saunders (Fatigue Life) Distribution
+ * 
+ * Support:
+ * x > mu
+ * 
+ * Parameters:
+ * mu
+ * alpha > 0
+ * beta > 0
+ * 
+ * 
+ */
+
+inline double logpdf_fatigue(double x, double alpha, double beta,
+                             double mu, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta) || ISNAN(mu))
+    return x+alpha+beta+mu;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x <= mu || !R_FINITE(x))
+    return R_NegInf;
+  double z, zb, bz;
+  z = x-mu;
+  zb = std::sqrt(z/beta);
+  bz = std::sqrt(beta/z);
+  // (zb+bz)/(2.0*alpha*z) * phi((zb-bz)/alpha)
+  return std::log(zb+bz) - LOG_2F - std::log(alpha) - std::log(z) + lphi((zb-bz)/alpha);
+}
+
+inline double cdf_fatigue(double x, double alpha, double beta,
+                          double mu, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta) || ISNAN(mu))
+    return x+alpha+beta+mu;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x <= mu)
+    return 0.0;
+  double z, zb, bz;
+  z = x-mu;
+  zb = std::sqrt(z/beta);
+  bz = std::sqrt(beta/z);
+  return Phi((zb-bz)/alpha);
+}
+
+inline double invcdf_fatigue(double p, double alpha, double beta,
+                             double mu, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(alpha) || ISNAN(beta) || ISNAN(mu))
+    return p+alpha+beta+mu;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (p == 0.0)
+    return mu;
+  double Zp = InvPhi(p);
+  return std::pow(alpha/2.0*Zp + std::sqrt(std::pow(alpha/2.0*Zp, 2.0) + 1.0), 2.0) * beta + mu;
+}
+
+inline double rng_fatigue(double alpha, double beta,
+                          double mu, bool& throw_warning) {
+  if (ISNAN(alpha) || ISNAN(beta) || ISNAN(mu) || alpha <= 0.0 || beta <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double z = rng_norm();
+  return std::pow(alpha/2.0*z + std::sqrt(std::pow(alpha/2.0*z, 2.0) + 1.0), 2.0) * beta + mu;
+}
+
+}
+
+
+#endif
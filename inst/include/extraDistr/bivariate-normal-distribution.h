@@ -0,0 +1,58 @@
+#ifndef EXTRADISTR_BIVARIATE_NORMAL_DISTRIBUTION_H
+#define EXTRADISTR_BIVARIATE_NORMAL_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+*  Bivariate Normal distribution
+*
+*  Values:
+*  x, y
+*
+*  Parameters:
+*  mu1, mu2
+*  sigma1, sigma2 > 0
+*
+*  z1 = (x1 - mu1)/sigma1
+*  z2 = (x2 - mu2)/sigma2
+*
+*  f(x) = 1/(2*pi*std::sqrt(1-rho^2)*sigma1*sigma2) *
+*         std::exp(-(1/(2*(1-rho^2)*(z1^2 - 2*rho*z1*z2 + z2^2))))
+*
+*/
+
+
+inline double pdf_bnorm(double x, double y, double mu1, double mu2,
+                        double sigma1, double sigma2, double rho,
+                        bool& throw_warning) {
+  
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(y) || ISNAN(mu1) || ISNAN(mu2) ||
+      ISNAN(sigma1) || ISNAN(sigma2) || ISNAN(rho))
+    return x+y+mu1+mu2+sigma1+sigma2+rho;
+#endif
+  
+  if (sigma1 <= 0.0 || sigma2 <= 0.0 || rho <= -1.0 || rho >= 1.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  if (!R_FINITE(x) || !R_FINITE(y))
+    return 0.0;
+  
+  double z1 = (x - mu1)/sigma1;
+  double z2 = (y - mu2)/sigma2;
+  
+  double c1 = 1.0/(2.0*M_PI*std::sqrt(1.0 - (rho*rho))*sigma1*sigma2);
+  double c2 = -1.0/(2.0*(1.0 - (rho*rho)));
+  
+  return c1 * std::exp(c2 * ((z1*z1) - 2.0*rho*z1*z2 + (z2*z2)));
+}
+
+}
+
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef EXTRADISTR_BIVARIATE_POISSON_DISTRIBUTION_H
+#define EXTRADISTR_BIVARIATE_POISSON_DISTRIBUTION_H
+
+#include <vector>
+#include "shared.h"
+
+namespace extraDistr {
+
+
+inline double logpmf_bpois(double x, double y, double a, double b, double c,
+                           bool& throw_warning) {
+  
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(y) || ISNAN(a) || ISNAN(b) || ISNAN(c))
+    return x+y+a+b+c;
+#endif
+  
+  if (a < 0.0 || b < 0.0 || c < 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  if (!isInteger(x) || x < 0.0 || !R_FINITE(x) ||
+      !R_FINITE(y) || !isInteger(y)) {
+      return R_NegInf;
+  }
+  
+  if (y < 0.0)
+    return R_NegInf;
+  
+  // exp(-(a+b+c))
+  double tmp = -(a+b+c); 
+  // tmp *= (pow(a, x) / factorial(x)) * (pow(b, y) / factorial(y));
+  tmp += (std::log(a) * x - lfactorial(x)) + (std::log(b) * y - lfactorial(y));
+  
+  double minxy = static_cast<int>( (x < y) ? x : y );
+  // c_ab = c/(a*b)
+  double lc_ab = std::log(c) - std::log(a) - std::log(b);
+  
+  double dk;
+  double mx = R_NegInf;
+  std::vector<double> ls(minxy+1);
+  
+  for (int k = 0; k <= minxy; k++) {
+    dk = static_cast<double>(k);
+    // xy += R::choose(x, k) * R::choose(y, k) * factorial(k) * pow(c_ab, k);
+    ls[k] = lchoose_fn(x, dk) + lchoose_fn(y, dk) + lfactorial(dk) + lc_ab * dk;
+    if (ls[k] > mx)
+      mx = ls[k];
+  }
+  
+  double xy = 0.0;
+  
+  for (int k = 0; k <= minxy; k++)
+    xy += std::exp(ls[k] - mx);    // log-sum-exp trick
+  
+  xy = std::log(xy) + mx;
+  
+  return tmp + xy;
+}
+
+}
+
+
+#endif
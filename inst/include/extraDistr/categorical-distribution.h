@@ -0,0 +1,98 @@
+#ifndef EXTRADISTR_CATEGORICAL_DISTRIBUTION_H
+#define EXTRADISTR_CATEGORICAL_DISTRIBUTION_H
+
+#include <vector>
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+ * Alias table for sampling from categorical distribution
+ *
+ * Building the table takes O(k) time, then each draw takes O(1) time
+ * and two uniforms. The weights need to be non-negative, finite and not
+ * all zero, they do not need to be normalized.
+ *
+ * Walker, A.J. (1977). An Efficient Method for Generating Discrete Random
+ * Variables with General Distributions. ACM Transactions on Mathematical
+ * Software, 3(3), 253-256.
+ *
+ * Vose, M.D. (1991). A linear algorithm for generating random numbers
+ * with a given distribution. IEEE Transactions on Software Engineering,
+ * 17(9), 972-975.
+ *
+ */
+
+class AliasTable {
+
+  int k;
+  std::vector<double> prob;
+  std::vector<int> alias;
+
+public:
+
+  AliasTable() : k(0) {}
+
+  // weights are w[0], w[stride], ..., w[(k-1)*stride], so rows of
+  // column-major matrices can be used directly
+
+  void build(const double* w, int k, int stride = 1) {
+    
+    this->k = k;
+    prob.assign(k, 0.0);
+    alias.assign(k, 0);
+    
+    double total = 0.0;
+    for (int j = 0; j < k; j++)
+      total += w[j * stride];
+    
+    std::vector<double> q(k);
+    std::vector<int> small, large;
+    small.reserve(k);
+    large.reserve(k);
+    
+    for (int j = 0; j < k; j++) {
+      q[j] = w[j * stride] * k / total;
+      if (q[j] < 1.0)
+        small.push_back(j);
+      else
+        large.push_back(j);
+    }
+    
+    while (!small.empty() && !large.empty()) {
+      int s = small.back();
+      int l = large.back();
+      small.pop_back();
+      large.pop_back();
+      prob[s] = q[s];
+      alias[s] = l;
+      q[l] = (q[l] + q[s]) - 1.0;
+      if (q[l] < 1.0)
+        small.push_back(l);
+      else
+        large.push_back(l);
+    }
+    
+    // what is left has probability one, up to rounding errors
+    for (size_t j = 0; j < large.size(); j++)
+      prob[large[j]] = 1.0;
+    for (size_t j = 0; j < small.size(); j++)
+      prob[small[j]] = 1.0;
+  }
+
+  // 0-based index of the category
+
+  inline int draw() const {
+    int j = static_cast<int>(rng_unif() * k);
+    if (j >= k)
+      j = k - 1;
+    return (rng_unif() < prob[j]) ? j : alias[j];
+  }
+
+};
+
+}
+
+
+#endif
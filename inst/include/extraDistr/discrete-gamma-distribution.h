@@ -0,0 +1,41 @@
+#ifndef EXTRADISTR_DISCRETE_GAMMA_DISTRIBUTION_H
+#define EXTRADISTR_DISCRETE_GAMMA_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+* Discrete normal distribution
+* 
+* Values:
+* x
+* 
+* Parameters
+* mu
+* sigma > 0
+*  
+*/
+
+
+inline double pmf_dgamma(double x, double shape, double scale,
+                         bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(shape) || ISNAN(scale))
+    return x+shape+scale;
+#endif
+  if (shape <= 0.0 || scale <= 0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0 || !isInteger(x))
+    return 0.0;
+  return R::pgamma(x+1.0, shape, scale, true, false) -
+    R::pgamma(x, shape, scale, true, false);
+}
+
+}
+
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef EXTRADISTR_DISCRETE_LAPLACE_DISTRIBUTION_H
+#define EXTRADISTR_DISCRETE_LAPLACE_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+inline double logpmf_dlaplace(double x, double p, double mu,
+                              bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(p) || ISNAN(mu))
+    return x+p+mu;
+#endif
+  if (p <= 0.0 || p >= 1.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (!isInteger(x))
+    return R_NegInf;
+  // (1.0-p)/(1.0+p) * pow(p, abs(x-mu));
+  return log1p(-p) - log1p(p) + std::log(p) * std::abs(x-mu);
+} 
+
+inline double cdf_dlaplace(double x, double p, double mu,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(p) || ISNAN(mu))
+    return x+p+mu;
+#endif
+  if (p <= 0.0 || p >= 1.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0) {
+    // pow(p, -floor(x-mu))/(1.0+p);
+    return std::exp( (std::log(p) * -std::floor(x-mu)) - log1p(p) );
+  } else {
+    // 1.0 - (pow(p, floor(x-mu)+1.0)/(1.0+p))
+    return 1.0 - std::exp( std::log(p) * (std::floor(x-mu)+1.0) - log1p(p) );
+  }
+} 
+
+inline double rng_dlaplace(double p, double mu,
+                           bool& throw_warning) {
+  if (ISNAN(p) || ISNAN(mu) || p <= 0.0 || p >= 1.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double q, u, v;
+  q = 1.0 - p;
+  u = rng_geom(q); 
+  v = rng_geom(q); 
+  return u-v + mu;
+}
+
+}
+
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef EXTRADISTR_DISCRETE_NORMAL_DISTRIBUTION_H
+#define EXTRADISTR_DISCRETE_NORMAL_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+* Discrete normal distribution
+* 
+* Values:
+* x
+* 
+* Parameters
+* mu
+* sigma > 0
+*  
+*/
+
+
+inline double pmf_dnorm(double x, double mu, double sigma,
+                        bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
+    return x+mu+sigma;
+#endif
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (!isInteger(x))
+    return 0.0;
+  return Phi((x+1.0-mu)/sigma) - Phi((x-mu)/sigma);
+}
+
+}
+
+
+#endif
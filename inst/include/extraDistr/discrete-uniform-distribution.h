@@ -0,0 +1,88 @@
+#ifndef EXTRADISTR_DISCRETE_UNIFORM_DISTRIBUTION_H
+#define EXTRADISTR_DISCRETE_UNIFORM_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+ * Discrete uniform distribution
+ * 
+ * Values:
+ * a <= x <= b
+ * 
+ * f(x) = 1/(b-a+1)
+ * F(x) = (std::floor(x)-a+1)/b-a+1
+ *  
+ */
+
+
+inline double pmf_dunif(double x, double min, double max,
+                        bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(min) || ISNAN(max))
+    return x+min+max;
+#endif
+  if (min > max || !R_FINITE(min) || !R_FINITE(max) ||
+      !isInteger(min, false) || !isInteger(max, false)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < min || x > max || !isInteger(x))
+    return 0.0;
+  return 1.0/(max-min+1.0);
+}
+
+
+inline double cdf_dunif(double x, double min, double max,
+                        bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(min) || ISNAN(max))
+    return x+min+max;
+#endif
+  if (min > max || !R_FINITE(min) || !R_FINITE(max) ||
+      !isInteger(min, false) || !isInteger(max, false)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < min)
+    return 0.0;
+  else if (x >= max)
+    return 1.0;
+  return (std::floor(x)-min+1.0)/(max-min+1.0);
+}
+
+inline double invcdf_dunif(double p, double min, double max,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(min) || ISNAN(max))
+    return p+min+max;
+#endif
+  if (min > max || !R_FINITE(min) || !R_FINITE(max) ||
+      !isInteger(min, false) || !isInteger(max, false) ||
+      !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (p == 0 || min == max)
+    return min;
+  return std::ceil( p*(max-min+1.0)+min-1.0 );
+}
+
+inline double rng_dunif(double min, double max, bool& throw_warning) {
+  if (ISNAN(min) || ISNAN(max) ||
+      min > max || !R_FINITE(min) || !R_FINITE(max) ||
+      !isInteger(min, false) || !isInteger(max, false)) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  if (min == max)
+    return min;
+  return std::ceil(rng_unif(min - 1.0, max));
+}
+
+}
+
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef EXTRADISTR_DISCRETE_WEIBULL_DISTRIBUTION_H
+#define EXTRADISTR_DISCRETE_WEIBULL_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+*  Discrete Weibull distribution
+*
+*  Values:
+*  x >= 0
+*
+*  Parameters:
+*  0 < q < 1
+*  beta
+*
+*  f(x)    = q^x^beta - q^(x+1)^beta
+*  F(x)    = 1-q^(x+1)^beta
+*  F^-1(p) = ceiling(std::pow(std::log(1-p)/std::log(q), 1/beta) - 1)
+*
+*  Nakagawa and Osaki (1975), "The Discrete Weibull Distribution",
+*  IEEE Transactions on Reliability, R-24, pp. 300-301.
+*
+*/
+
+inline double pdf_dweibull(double x, double q, double beta,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(q) || ISNAN(beta))
+    return x+q+beta;
+#endif
+  if (q <= 0.0 || q >= 1.0 || beta <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (!isInteger(x) || x < 0.0)
+    return 0.0;
+  return std::pow(q, std::pow(x, beta)) - std::pow(q, std::pow(x+1.0, beta));
+}
+
+inline double cdf_dweibull(double x, double q, double beta,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(q) || ISNAN(beta))
+    return x+q+beta;
+#endif
+  if (q <= 0.0 || q >= 1.0 || beta <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0)
+    return 0.0;
+  // 1.0 - pow(q, pow(x+1.0, beta))
+  return 1.0 - std::exp(std::log(q) * std::exp(log1p(x) * beta));
+}
+
+inline double invcdf_dweibull(double p, double q, double beta,
+                              bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(q) || ISNAN(beta))
+    return p+q+beta;
+#endif
+  if (q <= 0.0 || q >= 1.0 || beta <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (p == 0.0)
+    return 0.0;
+  return std::ceil(std::pow(std::log(1.0 - p)/std::log(q), 1.0/beta) - 1.0);
+}
+
+inline double rng_dweibull(double q, double beta,
+                           bool& throw_warning) {
+  if (ISNAN(q) || ISNAN(beta) || q <= 0.0 || q >= 1.0 ||
+      beta <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double u = rng_unif();
+  return std::ceil(std::pow(std::log(u)/std::log(q), 1.0/beta) - 1.0);
+}
+
+}
+
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef EXTRADISTR_FRECHET_DISTRIBUTION_H
+#define EXTRADISTR_FRECHET_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+ *  Frechet distribution
+ *
+ *  Values:
+ *  x > mu
+ *
+ *  Parameters:
+ *  lambda > 0
+ *  mu
+ *  sigma > 0
+ *
+ *  z       = (x-mu)/sigma
+ *  f(x)    = lambda/sigma * z^{-1-lambda} * std::exp(-z^-lambda)
+ *  F(x)    = std::exp(-z^-lambda)
+ *  F^-1(p) = mu + sigma * -std::log(p)^{-1/lambda}
+ *
+ */
+
+
+inline double logpdf_frechet(double x, double lambda, double mu,
+                             double sigma, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(lambda) || ISNAN(mu) || ISNAN(sigma))
+    return x+lambda+mu+sigma;
+#endif
+  if (lambda <= 0.0 || sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x <= mu)
+    return R_NegInf;
+  double z = (x-mu)/sigma;
+  // lambda/sigma * pow(z, -1.0-lambda) * exp(-pow(z, -lambda));
+  return std::log(lambda) - std::log(sigma) + std::log(z) * (-1.0-lambda) - std::exp(std::log(z) * -lambda);
+}
+
+inline double cdf_frechet(double x, double lambda, double mu,
+                          double sigma, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(lambda) || ISNAN(mu) || ISNAN(sigma))
+    return x+lambda+mu+sigma;
+#endif
+  if (lambda <= 0.0 || sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x <= mu)
+    return 0.0;
+  double z = (x-mu)/sigma;
+  return std::exp(-std::pow(z, -lambda));
+}
+
+inline double invcdf_frechet(double p, double lambda, double mu,
+                             double sigma, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(lambda) || ISNAN(mu) || ISNAN(sigma))
+    return p+lambda+mu+sigma;
+#endif
+  if (lambda <= 0.0 || sigma <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (p == 1.0)
+    return R_PosInf;
+  return mu + sigma * std::pow(-std::log(p), -1.0/lambda);
+}
+
+inline double rng_frechet(double lambda, double mu,
+                          double sigma, bool& throw_warning) {
+  if (ISNAN(lambda) || ISNAN(mu) || ISNAN(sigma) ||
+      lambda <= 0.0 || sigma <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double u = rng_unif();
+  return mu + sigma * std::pow(-std::log(u), -1.0/lambda);
+}
+
+}
+
+
+#endif
@@ -0,0 +1,157 @@
+#ifndef EXTRADISTR_GAMMA_POISSON_DISTRIBUTION_H
+#define EXTRADISTR_GAMMA_POISSON_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+*  Gamma-Poisson distribution
+*
+*  Values:
+*  x >= 0
+*
+*  Parameters:
+*  alpha > 0
+*  beta > 0
+*
+*/
+
+inline double logpmf_gpois(double x, double alpha, double beta,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta))
+    return x+alpha+beta;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (!isInteger(x) || x < 0.0 || !R_FINITE(x))
+    return R_NegInf;
+  // p = beta/(1.0+beta);
+  double p = std::exp( std::log(beta) - log1p(beta) );
+  return lgamma_fn(alpha+x) - lfactorial(x) - lgamma_fn(alpha) +
+    std::log(p)*x + std::log(1.0-p)*alpha;
+}
+
+#ifndef EXTRADISTR_STANDALONE
+
+// Gamma-Poisson is the negative binomial distribution with size = alpha
+// and prob = 1/(1+beta), so the cdf is the regularized incomplete beta
+// function, as in R's pnbinom
+
+inline double cdf_gpois(double x, double alpha, double beta,
+                        bool lower_tail, bool log_p, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta))
+    return x+alpha+beta;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0 || x == R_PosInf) {
+    bool one = (x == R_PosInf) == lower_tail;
+    if (log_p)
+      return one ? 0.0 : R_NegInf;
+    return one ? 1.0 : 0.0;
+  }
+  return R::pbeta(1.0/(1.0+beta), alpha, std::floor(x) + 1.0,
+                  lower_tail, log_p);
+}
+
+// the search starts from the normal approximation
+
+inline double invcdf_gpois(double p, double alpha, double beta,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(alpha) || ISNAN(beta))
+    return p+alpha+beta;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (p == 0.0)
+    return 0.0;
+  if (p == 1.0)
+    return R_PosInf;
+  
+  double mu = alpha * beta;
+  double sigma = std::sqrt(alpha * beta * (1.0 + beta));
+  
+  return discrete_quantile(p, mu + sigma * InvPhi(p), 0.0, R_PosInf,
+                           [&](double x) {
+    return cdf_gpois(x, alpha, beta, true, false, throw_warning);
+  });
+}
+
+#endif
+
+inline double rng_gpois(double alpha, double beta,
+                        bool& throw_warning) {
+  if (ISNAN(alpha) || ISNAN(beta) || alpha <= 0.0 || beta <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double lambda = rng_gamma(alpha, beta);
+  return rng_pois(lambda);
+}
+
+
+/*
+ * Gamma-Poisson distribution with fixed parameters
+ *
+ * The parameters are validated and log(gamma(alpha)) and the logs of
+ * the probabilities are computed once, when the object is created. The
+ * results are the same as from logpmf_gpois.
+ *
+ */
+
+class GpoisFrozen {
+
+  double alpha, beta;
+  bool nan_param, invalid;
+  double lgamma_a, log_p, alpha_log_q;
+
+public:
+
+  GpoisFrozen(double alpha, double beta)
+    : alpha(alpha), beta(beta) {
+    nan_param = ISNAN(alpha) || ISNAN(beta);
+    invalid = nan_param || alpha <= 0.0 || beta <= 0.0;
+    if (invalid) {
+      lgamma_a = log_p = alpha_log_q = NAN;
+    } else {
+      double p = std::exp( std::log(beta) - log1p(beta) );
+      lgamma_a = lgamma_fn(alpha);
+      log_p = std::log(p);
+      alpha_log_q = std::log(1.0-p)*alpha;
+    }
+  }
+
+  inline double pdf(double x, bool log_prob, bool& throw_warning) const {
+    double lp;
+#ifdef IEEE_754
+    if (ISNAN(x) || nan_param)
+      return x+alpha+beta;
+#endif
+    if (invalid) {
+      throw_warning = true;
+      return NAN;
+    }
+    if (!isInteger(x) || x < 0.0 || !R_FINITE(x))
+      lp = R_NegInf;
+    else
+      lp = lgamma_fn(alpha+x) - lfactorial(x) - lgamma_a +
+        log_p*x + alpha_log_q;
+    return log_prob ? lp : std::exp(lp);
+  }
+
+};
+}
+
+
+#endif
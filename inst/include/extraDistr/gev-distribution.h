@@ -0,0 +1,118 @@
+#ifndef EXTRADISTR_GEV_DISTRIBUTION_H
+#define EXTRADISTR_GEV_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+ *  Generalized extreme value distribution
+ *
+ *  Values:
+ *  x
+ *
+ *  Parameters:
+ *  mu
+ *  sigma > 0
+ *  xi
+ *
+ *  z = (x-mu)/sigma
+ *  where 1+xi*z > 0
+ * 
+ *  f(x)    = { 1/sigma * (1+xi*z)^{-1/xi-1} * std::exp(-(1+xi*z)^{-1/xi})     if xi != 0
+ *            { 1/sigma * std::exp(-z) * std::exp(-std::exp(-z))                         otherwise
+ *  F(x)    = { std::exp(-(1+xi*z)^{1/xi})                                     if xi != 0
+ *            { std::exp(-std::exp(-z))                                             otherwise
+ *  F^-1(p) = { mu - sigma/xi * (1 - (-std::log(1-p))^xi)                      if xi != 0
+ *            { mu - sigma * std::log(-std::log(1-p))                               otherwise
+ *
+ */
+
+
+inline double logpdf_gev(double x, double mu, double sigma,
+                         double xi, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
+    return x+mu+sigma+xi;
+#endif
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  double z = (x-mu)/sigma;
+  if (1.0+xi*z > 0.0) {
+    if (xi != 0.0) {
+      // 1.0/sigma * pow(1.0+xi*z, -1.0-(1.0/xi)) * exp(-pow(1.0+xi*z, -1.0/xi));
+      return -std::log(sigma) + log1p(xi*z) * (-1.0-(1.0/xi)) -
+        std::exp(log1p(xi*z) * (-1.0/xi) );
+    } else {
+      // 1.0/sigma * exp(-z) * exp(-exp(-z));
+      return -std::log(sigma) - z - std::exp(-z);
+    }
+  } else {
+    return R_NegInf;
+  }
+}
+
+inline double cdf_gev(double x, double mu, double sigma,
+                      double xi, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
+    return x+mu+sigma+xi;
+#endif
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  double z = (x-mu)/sigma;
+  if (1.0+xi*z > 0.0) {
+    if (xi != 0.0) {
+      // exp(-pow(1.0+xi*z, -1.0/xi));
+      return std::exp(-std::exp(log1p(xi*z) * (-1.0/xi)));
+    } else {
+      return std::exp(-std::exp(-z));
+    }
+  } else {
+    if (z > 0 && z >= -1/xi)
+      return 1.0;
+    else
+      return 0.0;
+  }
+}
+
+inline double invcdf_gev(double p, double mu, double sigma,
+                         double xi, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
+    return p+mu+sigma+xi;
+#endif
+  if (sigma <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (p == 1.0)
+    return R_PosInf;
+  if (xi != 0.0)
+    return mu - sigma/xi * (1.0 - std::pow(-std::log(p), -xi));
+  else
+    return mu - sigma * std::log(-std::log(p));
+}
+
+inline double rng_gev(double mu, double sigma, double xi,
+                      bool& throw_warning) {
+  if (ISNAN(mu) || ISNAN(sigma) || ISNAN(xi) || sigma <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double u = rng_exp(); // -log(rng_unif())
+  if (xi != 0.0)
+    return mu + sigma/xi * (std::pow(u, -xi) - 1.0);
+  else
+    return mu - sigma * std::log(u);
+}
+
+}
+
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef EXTRADISTR_GOMPERTZ_DISTRIBUTION_H
+#define EXTRADISTR_GOMPERTZ_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+*  Gompertz distribution
+*
+*  Values:
+*  x >= 0
+*
+*  Parameters:
+*  a > 0
+*  b > 0
+*
+*  f(x)    = a*std::exp(b*x - a/b * (std::exp(bx)-1))
+*  F(x)    = 1-std::exp(-a/b * (std::exp(bx)-1))
+*  F^-1(p) = 1/b * std::log(1 - b/a * std::log(1-p))
+*
+* References:
+*
+* Lenart, A. (2012). The Gompertz distribution and Maximum Likelihood Estimation
+* of its parameters - a revision. MPIDR WORKING PAPER WP 2012-008.
+*
+*/
+
+
+inline double logpdf_gompertz(double x, double a, double b,
+                              bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(a) || ISNAN(b))
+    return x+a+b;
+#endif
+  if (a <= 0.0 || b <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0 || !R_FINITE(x))
+    return R_NegInf;
+  // a * exp(b*x - a/b * (exp(b*x) - 1.0));
+  return std::log(a) + (b*x - a/b * (std::exp(b*x) - 1.0));
+}
+
+inline double cdf_gompertz(double x, double a, double b,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(a) || ISNAN(b))
+    return x+a+b;
+#endif
+  if (a <= 0.0 || b <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0)
+    return 0.0;
+  if (!R_FINITE(x))
+    return 1.0;
+  return 1.0 - std::exp(-a/b * (std::exp(b*x) - 1.0));
+}
+
+inline double invcdf_gompertz(double p, double a, double b,
+                              bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(a) || ISNAN(b))
+    return p+a+b;
+#endif
+  if (a <= 0.0 || b <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  return std::log(1.0 - b/a * std::log(1.0-p)) / b;
+}
+
+inline double rng_gompertz(double a, double b, bool& throw_warning) {
+  if (ISNAN(a) || ISNAN(b) || a <= 0.0 || b <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double u = rng_unif();
+  return std::log(1.0 - b/a * std::log(u)) / b;
+}
+
+}
+
+
+#endif
@@ -0,0 +1,157 @@
+#ifndef EXTRADISTR_GPD_DISTRIBUTION_H
+#define EXTRADISTR_GPD_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+ *  Generalized Pareto distribution
+ *
+ *  Values:
+ *  x
+ *
+ *  Parameters:
+ *  mu
+ *  sigma > 0
+ *  xi
+ *
+ *  z = (x-mu)/sigma
+ *  where 1+xi*z > 0
+ *
+ *  f(x)    = { (1+xi*z)^{-(xi+1)/xi}/sigma       if xi != 0
+ *            { std::exp(-z)/sigma                     otherwise
+ *  F(x)    = { 1-(1+xi*z)^{-1/xi}                if xi != 0
+ *            { 1-std::exp(-z)                         otherwise
+ *  F^-1(p) = { mu + sigma * ((1-p)^{-xi}-1)/xi   if xi != 0
+ *            { mu - sigma * std::log(1-p)             otherwise
+ *
+ */
+
+inline double logpdf_gpd(double x, double mu, double sigma, double xi,
+                         bool &throw_warning)
+{
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
+    return x + mu + sigma + xi;
+#endif
+  if (sigma <= 0.0)
+  {
+    throw_warning = true;
+    return NAN;
+  }
+  double z = (x - mu) / sigma;
+  if (xi != 0.0)
+  {
+    if (z > 0 && 1.0 + xi * z > 0.0)
+    {
+      // pow(1.0+xi*z, -(xi+1.0)/xi)/sigma;
+      return log1p(xi * z) * (-(xi + 1.0) / xi) - std::log(sigma);
+    }
+    else
+    {
+      return R_NegInf;
+    }
+  }
+  else
+  {
+    if (z > 0 && 1.0 + xi * z > 0.0)
+    {
+      // exp(-z)/sigma;
+      return -z - std::log(sigma);
+    }
+    else
+    {
+      return R_NegInf;
+    }
+  }
+}
+
+inline double cdf_gpd(double x, double mu, double sigma, double xi,
+                      bool &throw_warning)
+{
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
+    return x + mu + sigma + xi;
+#endif
+  if (sigma <= 0.0)
+  {
+    throw_warning = true;
+    return NAN;
+  }
+  double z = (x - mu) / sigma;
+  if (xi != 0.0)
+  {
+    if (z > 0 && 1.0 + xi * z > 0.0)
+    {
+      // 1.0 - pow(1.0+xi*z, -1.0/xi);
+      return 1.0 - std::exp(log1p(xi * z) * (-1.0 / xi));
+    }
+    else
+    {
+      if (z > 0 && z >= -1 / xi)
+        return 1.0;
+      else
+        return 0.0;
+    }
+  }
+  else
+  {
+    if (z > 0 && 1.0 + xi * z > 0.0)
+    {
+      return 1.0 - std::exp(-z);
+    }
+    else
+    {
+      if (z > 0 && z >= -1 / xi)
+        return 1.0;
+      else
+        return 0.0;
+    }
+  }
+}
+
+inline double invcdf_gpd(double p, double mu, double sigma, double xi,
+                         bool &throw_warning)
+{
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
+    return p + mu + sigma + xi;
+#endif
+  if (sigma <= 0.0 || !VALID_PROB(p))
+  {
+    throw_warning = true;
+    return NAN;
+  }
+  if (xi != 0.0)
+    return mu + sigma * (std::pow(1.0 - p, -xi) - 1.0) / xi;
+  else
+    return mu - sigma * std::log(1.0 - p);
+}
+
+inline double rng_gpd(double mu, double sigma, double xi,
+                      bool &throw_warning)
+{
+  if (ISNAN(mu) || ISNAN(sigma) || ISNAN(xi) || sigma <= 0.0)
+  {
+    throw_warning = true;
+    return NA_REAL;
+  }
+
+  if (xi != 0.0)
+  {
+    double u = rng_unif();
+    return mu + sigma * (std::pow(u, -xi) - 1.0) / xi;
+  }
+  else
+  {
+    double v = rng_exp(); // -log(rng_unif())
+    return mu + sigma * v;
+  }
+}
+
+}
+
+
+#endif
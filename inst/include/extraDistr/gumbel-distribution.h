@@ -0,0 +1,84 @@
+#ifndef EXTRADISTR_GUMBEL_DISTRIBUTION_H
+#define EXTRADISTR_GUMBEL_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+ *  Gumbel distribution
+ *
+ *  Values:
+ *  x
+ *
+ *  Parameters:
+ *  mu
+ *  sigma > 0
+ *
+ *  z       = (x-mu)/sigma
+ *  f(x)    = 1/sigma * std::exp(-(z+std::exp(-z)))
+ *  F(x)    = std::exp(-std::exp(-z))
+ *  F^-1(p) = mu - sigma * std::log(-std::log(p))
+ *
+ */
+
+inline double logpdf_gumbel(double x, double mu, double sigma,
+                            bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
+    return x+mu+sigma;
+#endif
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (!R_FINITE(x))
+    return R_NegInf;
+  double z = (x-mu)/sigma;
+  // exp(-(z+exp(-z)))/sigma;
+  return -(z+std::exp(-z)) - std::log(sigma);
+}
+
+
+inline double cdf_gumbel(double x, double mu, double sigma,
+                         bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
+    return x+mu+sigma;
+#endif
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  double z = (x-mu)/sigma;
+  return std::exp(-std::exp(-z));
+}
+
+inline double invcdf_gumbel(double p, double mu, double sigma,
+                            bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma))
+    return p+mu+sigma;
+#endif
+  if (sigma <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  return mu - sigma * std::log(-std::log(p));
+}
+
+inline double rng_gumbel(double mu, double sigma,
+                         bool& throw_warning) {
+  if (ISNAN(mu) || ISNAN(sigma) || sigma <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double u = rng_exp(); // -log(rng_unif())
+  return mu - sigma * std::log(u);
+}
+
+}
+
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef EXTRADISTR_HALF_CAUCHY_DISTRIBUTION_H
+#define EXTRADISTR_HALF_CAUCHY_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+inline double logpdf_hcauchy(double x, double sigma,
+                             bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(sigma))
+    return x+sigma;
+#endif
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0)
+    return R_NegInf;
+  // 2.0/(M_PI*(1.0 + pow(x/sigma, 2.0)))/sigma;
+  return LOG_2F - std::log(M_PI) - log1p(std::exp( (std::log(x)-std::log(sigma)) * 2.0 )) - std::log(sigma);
+}
+
+inline double cdf_hcauchy(double x, double sigma, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(sigma))
+    return x+sigma;
+#endif
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0)
+    return 0.0;
+  return 2.0/M_PI * atan(x/sigma);
+}
+
+inline double invcdf_hcauchy(double p, double sigma,
+                             bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(sigma))
+    return p+sigma;
+#endif
+  if (sigma <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  return sigma * tan((M_PI*p)/2.0);
+}
+
+inline double rng_hcauchy(double sigma, bool& throw_warning) {
+  if (ISNAN(sigma) || sigma <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  // same as abs(R::rcauchy(0.0, sigma))
+  return std::abs(sigma * tan(M_PI * rng_unif()));
+}
+
+}
+
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef EXTRADISTR_HALF_NORMAL_DISTRIBUTION_H
+#define EXTRADISTR_HALF_NORMAL_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+inline double logpdf_hnorm(double x, double sigma,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(sigma))
+    return x+sigma;
+#endif
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0)
+    return R_NegInf;
+  return LOG_2F + lphi(x/sigma) - std::log(sigma);
+}
+
+inline double cdf_hnorm(double x, double sigma, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(sigma))
+    return x+sigma;
+#endif
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0)
+    return 0.0;
+  return 2.0 * Phi(x/sigma) - 1.0;
+}
+
+inline double invcdf_hnorm(double p, double sigma, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(sigma))
+    return p+sigma;
+#endif
+  if (sigma <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  return InvPhi((p+1.0)/2.0) * sigma;
+}
+
+inline double rng_hnorm(double sigma, bool& throw_warning) {
+  if (ISNAN(sigma) || sigma <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  return std::abs(rng_norm()) * sigma;
+}
+
+}
+
+
+#endif
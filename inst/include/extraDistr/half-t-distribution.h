@@ -0,0 +1,76 @@
+#ifndef EXTRADISTR_HALF_T_DISTRIBUTION_H
+#define EXTRADISTR_HALF_T_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+ * 
+ * x >= 0
+ * 
+ * Parameters:
+ * nu > 0
+ * sigma > 0
+ * 
+ * with nu = 1   returns half-Cauchy
+ * with nu = Inf returns half-normal
+ * 
+ */
+
+inline double logpdf_ht(double x, double nu, double sigma,
+                        bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(nu) || ISNAN(sigma))
+    return x+nu+sigma;
+#endif
+  if (sigma <= 0.0 || nu <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0)
+    return R_NegInf;
+  return LOG_2F + R::dt(x/sigma, nu, true) - std::log(sigma);
+}
+
+inline double cdf_ht(double x, double nu, double sigma,
+                     bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(nu) || ISNAN(sigma))
+    return x+nu+sigma;
+#endif
+  if (sigma <= 0.0 || nu <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0)
+    return 0.0;
+  return 2.0 * R::pt(x/sigma, nu, true, false) - 1.0;
+}
+
+inline double invcdf_ht(double p, double nu, double sigma,
+                        bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(nu) || ISNAN(sigma))
+    return p+nu+sigma;
+#endif
+  if (sigma <= 0.0 || nu <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  return R::qt((p+1.0)/2.0, nu, true, false) * sigma;
+}
+
+inline double rng_ht(double nu, double sigma, bool& throw_warning) {
+  if (ISNAN(nu) || ISNAN(sigma) || sigma <= 0.0 || nu <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  return std::abs(rng_t(nu) * sigma);
+}
+
+}
+
+
+#endif
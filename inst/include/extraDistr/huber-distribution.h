@@ -0,0 +1,242 @@
+#ifndef EXTRADISTR_HUBER_DISTRIBUTION_H
+#define EXTRADISTR_HUBER_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+inline double logpdf_huber(double x, double mu, double sigma,
+                           double c, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(c))
+    return x+mu+sigma+c;
+#endif
+  if (sigma <= 0.0 || c <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  double z, A, rho;
+  z = std::abs((x - mu)/sigma);
+  // A = 2.0*SQRT_2_PI * (Phi(c) + phi(c)/c - 0.5);
+  A = LOG_2F + std::log(SQRT_2_PI) + std::log(Phi(c) + phi(c)/c - 0.5);
+
+  if (z <= c) {
+    rho = (z*z)/2.0;
+  } else {
+    rho = c*z - (c*c)/2.0;
+  }
+
+  // exp(-rho)/A/sigma;
+  return -rho - A - std::log(sigma);
+}
+
+inline double cdf_huber(double x, double mu, double sigma, double c,
+                        bool lower_tail, bool log_p, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(c))
+    return x+mu+sigma+c;
+#endif
+  if (sigma <= 0.0 || c <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+
+  double A, z, az, p;
+  A = 2.0*(phi(c)/c - Phi(-c) + 0.5);
+  z = (x - mu)/sigma;
+  az = -std::abs(z);
+  
+  if (az <= -c) 
+    p = std::exp((c*c)/2.0)/c * std::exp(c*az) / SQRT_2_PI/A;
+  else
+    p = (phi(c)/c + Phi(az) - Phi(-c))/A;
+  
+  // p is the probability of the smaller tail
+  if ((z <= 0.0) == lower_tail)
+    return log_p ? std::log(p) : p;
+  else
+    return log_p ? log1p(-p) : 1.0 - p;
+}
+
+inline double invcdf_huber(double p, double mu, double sigma, double c,
+                           bool lower_tail, bool log_p, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma) || ISNAN(c))
+    return p+mu+sigma+c;
+#endif
+  if (sigma <= 0.0 || c <= 0.0 || (log_p ? p > 0.0 : !VALID_PROB(p))) {
+    throw_warning = true;
+    return NAN;
+  }
+
+  double x, pt, pm, A;
+  A = 2.0 * SQRT_2_PI * (Phi(c) + phi(c)/c - 0.5);
+  pt = log_p ? std::exp(p) : p;
+  pm = std::min(pt, log_p ? -std::expm1(p) : 1.0 - p);
+
+  if (pm <= SQRT_2_PI * phi(c)/(c*A))
+    x = std::log(c*pm*A)/c - c/2.0;
+  else
+    x = InvPhi(std::abs(1.0 - Phi(c) + pm*A/SQRT_2_PI - phi(c)/c));
+
+  if ((pt < 0.5) == lower_tail)
+    return mu + x*sigma;
+  else
+    return mu - x*sigma;
+}
+
+inline double rng_huber(double mu, double sigma, double c,
+                        bool& throw_warning) {
+  if (ISNAN(mu) || ISNAN(sigma) || ISNAN(c) ||
+      sigma <= 0.0 || c <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  
+  double x, pm, A, u;
+  u = rng_unif();
+  A = 2.0 * SQRT_2_PI * (Phi(c) + phi(c)/c - 0.5);
+  pm = std::min(u, 1.0 - u);
+  
+  if (pm <= SQRT_2_PI * phi(c)/(c*A))
+    x = std::log(c*pm*A)/c - c/2.0;
+  else
+    x = InvPhi(std::abs(1.0 - Phi(c) + pm*A/SQRT_2_PI - phi(c)/c));
+  
+  if (u < 0.5)
+    return mu + x*sigma;
+  else
+    return mu - x*sigma;
+}
+
+
+
+/*
+ * Huber density with fixed parameters
+ *
+ * The normalizing constants, that depend only on c, are computed once,
+ * when the object is created. The results are the same as from
+ * logpdf_huber, cdf_huber, invcdf_huber and rng_huber.
+ *
+ */
+
+class HuberFrozen {
+
+  double mu, sigma, c;
+  bool nan_param, invalid;
+  double log_A, log_sigma, c_sq_half;   // logpdf
+  double A_cdf, exp_c, phi_c, Phi_mc;   // cdf
+  double A_inv, Phi_c, pm_tail;         // invcdf and rng
+
+  inline double std_invcdf(double pm) const {
+    if (pm <= pm_tail)
+      return std::log(c*pm*A_inv)/c - c/2.0;
+    else
+      return InvPhi(std::abs(1.0 - Phi_c + pm*A_inv/SQRT_2_PI - phi_c));
+  }
+
+public:
+
+  HuberFrozen(double mu, double sigma, double c)
+    : mu(mu), sigma(sigma), c(c) {
+    nan_param = ISNAN(mu) || ISNAN(sigma) || ISNAN(c);
+    invalid = nan_param || sigma <= 0.0 || c <= 0.0;
+    log_A = log_sigma = c_sq_half = NAN;
+    A_cdf = exp_c = phi_c = Phi_mc = NAN;
+    A_inv = Phi_c = pm_tail = NAN;
+    if (invalid)
+      return;
+    log_A = LOG_2F + std::log(SQRT_2_PI) + std::log(Phi(c) + phi(c)/c - 0.5);
+    log_sigma = std::log(sigma);
+    c_sq_half = (c*c)/2.0;
+    A_cdf = 2.0*(phi(c)/c - Phi(-c) + 0.5);
+    exp_c = std::exp((c*c)/2.0)/c;
+    phi_c = phi(c)/c;
+    Phi_mc = Phi(-c);
+    A_inv = 2.0 * SQRT_2_PI * (Phi(c) + phi(c)/c - 0.5);
+    Phi_c = Phi(c);
+    pm_tail = SQRT_2_PI * phi(c)/(c*A_inv);
+  }
+
+  inline double pdf(double x, bool log_prob, bool& throw_warning) const {
+#ifdef IEEE_754
+    if (ISNAN(x) || nan_param)
+      return x+mu+sigma+c;
+#endif
+    if (invalid) {
+      throw_warning = true;
+      return NAN;
+    }
+    double z, rho, lp;
+    z = std::abs((x - mu)/sigma);
+    if (z <= c)
+      rho = (z*z)/2.0;
+    else
+      rho = c*z - c_sq_half;
+    lp = -rho - log_A - log_sigma;
+    return log_prob ? lp : std::exp(lp);
+  }
+
+  inline double cdf(double x, bool lower_tail, bool log_p,
+                    bool& throw_warning) const {
+#ifdef IEEE_754
+    if (ISNAN(x) || nan_param)
+      return x+mu+sigma+c;
+#endif
+    if (invalid) {
+      throw_warning = true;
+      return NAN;
+    }
+    double z, az, p;
+    z = (x - mu)/sigma;
+    az = -std::abs(z);
+    if (az <= -c) 
+      p = exp_c * std::exp(c*az) / SQRT_2_PI/A_cdf;
+    else
+      p = (phi_c + Phi(az) - Phi_mc)/A_cdf;
+    // p is the probability of the smaller tail
+    if ((z <= 0.0) == lower_tail)
+      return log_p ? std::log(p) : p;
+    else
+      return log_p ? log1p(-p) : 1.0 - p;
+  }
+
+  inline double invcdf(double p, bool lower_tail, bool log_p,
+                       bool& throw_warning) const {
+#ifdef IEEE_754
+    if (ISNAN(p) || nan_param)
+      return p+mu+sigma+c;
+#endif
+    if (invalid || (log_p ? p > 0.0 : !VALID_PROB(p))) {
+      throw_warning = true;
+      return NAN;
+    }
+    double pt = log_p ? std::exp(p) : p;
+    double pm = std::min(pt, log_p ? -std::expm1(p) : 1.0 - p);
+    double x = std_invcdf(pm);
+    if ((pt < 0.5) == lower_tail)
+      return mu + x*sigma;
+    else
+      return mu - x*sigma;
+  }
+
+  inline double rng(bool& throw_warning) const {
+    if (invalid) {
+      throw_warning = true;
+      return NA_REAL;
+    }
+    double u = rng_unif();
+    double x = std_invcdf(std::min(u, 1.0 - u));
+    if (u < 0.5)
+      return mu + x*sigma;
+    else
+      return mu - x*sigma;
+  }
+
+};
+}
+
+
+#endif
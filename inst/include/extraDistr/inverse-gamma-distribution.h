@@ -0,0 +1,115 @@
+#ifndef EXTRADISTR_INVERSE_GAMMA_DISTRIBUTION_H
+#define EXTRADISTR_INVERSE_GAMMA_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+*  Inverse-Gamma distribution
+*
+*  Values:
+*  x
+*
+*  Parameters:
+*  alpha > 0
+*  beta > 0
+*
+*  f(k) = (x^(-alpha-1) * std::exp(-1/(beta*x))) / (Gamma(alpha)*beta^alpha)
+*  F(x) = gamma(alpha, 1/(beta*x)) / Gamma(alpha)
+*
+*  V. Witkovsky (2001) Computing the distribution of a linear
+*  combination of inverted gamma variables, Kybernetika 37(1), 79-90
+*
+*/
+
+
+inline double logpdf_invgamma(double x, double alpha, double beta,
+                              bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta))
+    return x+alpha+beta;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x <= 0.0)
+    return R_NegInf;
+  
+  return std::log(beta) * -alpha - lgamma_fn(alpha) + std::log(x) *
+           (-alpha-1.0) - 1.0/(beta*x);
+}
+
+inline double cdf_invgamma(double x, double alpha, double beta,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta))
+    return x+alpha+beta;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x <= 0.0)
+    return 0.0;
+  return R::pgamma(1.0/x, alpha, 1.0/beta, false, false);
+}
+
+inline double rng_invgamma(double alpha, double beta,
+                           bool& throw_warning) {
+  if (ISNAN(alpha) || ISNAN(beta) || alpha <= 0.0 || beta <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  return 1.0 / rng_gamma(alpha, 1.0/beta);
+}
+
+
+/*
+ * Inverse-gamma distribution with fixed parameters
+ *
+ * The parameters are validated and the normalizing constant
+ * -alpha*log(beta) - log(gamma(alpha)) is computed once, when the object
+ * is created. The results are the same as from logpdf_invgamma.
+ *
+ */
+
+class InvgammaFrozen {
+
+  double alpha, beta;
+  bool nan_param, invalid;
+  double lconst;
+
+public:
+
+  InvgammaFrozen(double alpha, double beta)
+    : alpha(alpha), beta(beta) {
+    nan_param = ISNAN(alpha) || ISNAN(beta);
+    invalid = nan_param || alpha <= 0.0 || beta <= 0.0;
+    lconst = invalid ? NAN : std::log(beta) * -alpha - lgamma_fn(alpha);
+  }
+
+  inline double pdf(double x, bool log_prob, bool& throw_warning) const {
+    double lp;
+#ifdef IEEE_754
+    if (ISNAN(x) || nan_param)
+      return x+alpha+beta;
+#endif
+    if (invalid) {
+      throw_warning = true;
+      return NAN;
+    }
+    if (x <= 0.0)
+      lp = R_NegInf;
+    else
+      lp = lconst + std::log(x) * (-alpha-1.0) - 1.0/(beta*x);
+    return log_prob ? lp : std::exp(lp);
+  }
+
+};
+}
+
+
+#endif
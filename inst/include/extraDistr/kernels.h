@@ -0,0 +1,91 @@
+#ifndef EXTRADISTR_KERNELS_H
+#define EXTRADISTR_KERNELS_H
+
+/*
+ * Scalar kernels of the extraDistr distributions
+ *
+ * Packages that have extraDistr in LinkingTo can include this header and
+ * call the per-value functions directly, e.g. inside an MCMC loop:
+ *
+ *   #include <extraDistr/kernels.h>
+ *
+ *   bool throw_warning = false;
+ *   double lp = extraDistr::logpmf_bbinom(k, n, a, b, throw_warning);
+ *   double z  = extraDistr::rng_tnorm(mu, sigma, lo, hi, throw_warning);
+ *
+ * All the functions are inline, take and return doubles and do not
+ * allocate (except for logpmf_bpois, that keeps a buffer of min(x, y)+1
+ * terms). Invalid parameters set throw_warning to true and return NaN,
+ * as in the vectorized R functions. The rng_* functions draw from R's
+ * generator, so they need to be called with the RNG scope active (as in
+ * any Rcpp exported function). Special functions come from R's math
+ * library unless compiled with -DEDCPP_NATIVE_MATH.
+ *
+ * With -DEXTRADISTR_STANDALONE the header does not need R at all (see
+ * standalone.h and the CMake build of the core library), the random
+ * generation functions then draw from per-thread Philox streams seeded
+ * by extraDistr::set_seed(). Setting extraDistr::rng_norm_kind() to
+ * NORM_ZIGGURAT switches the normal and exponential draws to the ziggurat
+ * samplers (see ziggurat.h).
+ *
+ */
+
+#include "shared.h"
+
+#include "bernoulli-distribution.h"
+#include "beta-binomial-distribution.h"
+#include "beta-negative-binomial-distribution.h"
+#include "birnbaum-saunders-distribution.h"
+#include "bivariate-normal-distribution.h"
+#include "bivariate-poisson-distribution.h"
+#include "categorical-distribution.h"
+#include "discrete-laplace-distribution.h"
+#include "discrete-normal-distribution.h"
+#include "discrete-uniform-distribution.h"
+#include "discrete-weibull-distribution.h"
+#include "frechet-distribution.h"
+#include "gamma-poisson-distribution.h"
+#include "gev-distribution.h"
+#include "gompertz-distribution.h"
+#include "gpd-distribution.h"
+#include "gumbel-distribution.h"
+#include "half-cauchy-distribution.h"
+#include "half-normal-distribution.h"
+#include "huber-distribution.h"
+#include "kumaraswamy-distribution.h"
+#include "laplace-distribution.h"
+#include "logarithmic-series-distribution.h"
+#include "lomax-distribution.h"
+#include "negative-hypergeometric-distribution.h"
+#include "pareto-distribution.h"
+#include "power-distribution.h"
+#include "rayleigh-distribution.h"
+#include "shifted-gompertz-distribution.h"
+#include "skellam-distribution.h"
+#include "slash-distribution.h"
+#include "triangular-distribution.h"
+#include "truncated-normal-distribution.h"
+#include "tuckey-lambda-distribution.h"
+#include "wald-distribution.h"
+
+// the kernels below call R's distribution functions (pbeta, qt, ppois, etc.),
+// so they are not available without R
+
+#ifndef EXTRADISTR_STANDALONE
+#include "beta-prime-distribution.h"
+#include "bhattacharjee-distribution.h"
+#include "discrete-gamma-distribution.h"
+#include "half-t-distribution.h"
+#include "inverse-gamma-distribution.h"
+#include "location-scale-t-distribution.h"
+#include "non-standart-beta-distribution.h"
+#include "proportion-distribution.h"
+#include "truncated-binomial-distribution.h"
+#include "truncated-poisson-distribution.h"
+#include "zero-inflated-binomial-distribution.h"
+#include "zero-inflated-negative-binomial-distribution.h"
+#include "zero-inflated-poisson-distribution.h"
+#endif
+
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef EXTRADISTR_KUMARASWAMY_DISTRIBUTION_H
+#define EXTRADISTR_KUMARASWAMY_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+*  Kumaraswamy distribution
+*
+*  Values:
+*  x in [0, 1]
+*
+*  Parameters:
+*  a > 0
+*  b > 0
+*
+*  f(x)    = a*b*x^{a-1}*(1-x^a)^{b-1}
+*  F(x)    = 1-(1-x^a)^b
+*  F^-1(p) = 1-(1-p^{1/b})^{1/a}
+*
+*/
+
+inline double pdf_kumar(double x, double a, double b,
+                        bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(a) || ISNAN(b))
+    return x+a+b;
+#endif
+  if (a <= 0.0 || b <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0 || x > 1.0)
+    return 0.0;
+  // is the support [0,1] or (0,1) ?
+  // log(a) + log(b) + log(x)*(a-1.0) + log1p(-pow(x, a))*(b-1.0);
+  return a*b * std::pow(x, a-1.0) * std::pow(1.0-std::pow(x, a), b-1.0);
+}
+
+inline double cdf_kumar(double x, double a, double b,
+                        bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(a) || ISNAN(b))
+    return x+a+b;
+#endif
+  if (a <= 0.0 || b <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0)
+    return 0.0;
+  if (x >= 1.0)
+    return 1.0;
+  return 1.0 - std::pow(1.0 - std::pow(x, a), b);
+}
+
+inline double invcdf_kumar(double p, double a, double b,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(a) || ISNAN(b))
+    return p+a+b;
+#endif
+  if (a <= 0.0 || b <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  return std::pow(1.0 - std::pow(1.0 - p, 1.0/b), 1.0/a);
+}
+
+inline double rng_kumar(double a, double b, bool& throw_warning) {
+  if (ISNAN(a) || ISNAN(b) || a <= 0.0 || b <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double u = rng_unif();
+  return std::pow(1.0 - std::pow(u, 1.0/b), 1.0/a);
+}
+
+}
+
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef EXTRADISTR_LAPLACE_DISTRIBUTION_H
+#define EXTRADISTR_LAPLACE_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+ *  Laplace distribution
+ *
+ *  Values:
+ *  x
+ *
+ *  Parameters:
+ *  mu
+ *  sigma > 0
+ *
+ *  z = (x-mu)/sigma
+ *  f(x)    = 1/(2*sigma) * std::exp(-|z|)
+ *  F(x)    = { 1/2 * std::exp(z)                 if   x < mu
+ *            { 1 - 1/2 * std::exp(z)             otherwise
+ *  F^-1(p) = { mu + sigma * std::log(2*p)        if p <= 0.5
+ *            { mu - sigma * std::log(2*(1-p))    otherwise
+ *
+ */
+
+inline double logpdf_laplace(double x, double mu, double sigma,
+                             bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
+    return x+mu+sigma;
+#endif
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  double z = std::abs(x-mu)/sigma;
+  // exp(-z)/(2.0*sigma);
+  return -z - LOG_2F - std::log(sigma);
+}
+
+inline double cdf_laplace(double x, double mu, double sigma,
+                          bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
+    return x+mu+sigma;
+#endif
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  double z = (x-mu)/sigma;
+  if (x < mu)
+    return std::exp(z - LOG_2F); // exp(z)/2.0
+  else
+    return 1.0 - std::exp(-z - LOG_2F); // 1.0 - exp(-z)/2.0
+}
+
+inline double invcdf_laplace(double p, double mu, double sigma,
+                             bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma))
+    return p+mu+sigma;
+#endif
+  if (sigma <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (p < 0.5)
+    return mu + sigma * std::log(2.0*p);
+  else
+    return mu - sigma * std::log(2.0*(1.0-p));
+}
+
+inline double rng_laplace(double mu, double sigma, bool& throw_warning) {
+  if (ISNAN(mu) || ISNAN(sigma) || sigma <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  // this is slower
+  // double u = rng_unif(-0.5, 0.5);
+  // return mu + sigma * R::sign(u) * log(1.0 - 2.0*abs(u));
+  double u = rng_exp();
+  double s = rng_sign();
+  return u*s * sigma + mu;
+}
+
+}
+
+
+#endif
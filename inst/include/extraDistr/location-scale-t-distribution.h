@@ -0,0 +1,76 @@
+#ifndef EXTRADISTR_LOCATION_SCALE_T_DISTRIBUTION_H
+#define EXTRADISTR_LOCATION_SCALE_T_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+*  Non-standard t-distribution
+*
+*  Values:
+*  x
+*
+*  Parameters:
+*  nu > 0
+*  mu
+*  sigma > 0
+*
+*/
+
+inline double pdf_lst(double x, double nu, double mu, double sigma,
+                      bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(nu) || ISNAN(mu) || ISNAN(sigma))
+    return x+nu+mu+sigma;
+#endif
+  if (nu <= 0.0 || sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  double z = (x - mu)/sigma;
+  return R::dt(z, nu, false)/sigma;
+}
+
+inline double cdf_lst(double x, double nu, double mu, double sigma,
+                      bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(nu) || ISNAN(mu) || ISNAN(sigma))
+    return x+nu+mu+sigma;
+#endif
+  if (nu <= 0.0 || sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  double z = (x - mu)/sigma;
+  return R::pt(z, nu, true, false);
+}
+
+inline double invcdf_lst(double p, double nu, double mu, double sigma,
+                         bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(nu) || ISNAN(mu) || ISNAN(sigma))
+    return p+nu+mu+sigma;
+#endif
+  if (nu <= 0.0 || sigma <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  return R::qt(p, nu, true, false)*sigma + mu;
+}
+
+inline double rng_lst(double nu, double mu, double sigma,
+                      bool& throw_warning) {
+  if (ISNAN(nu) || ISNAN(mu) || ISNAN(sigma) ||
+      nu <= 0.0 || sigma <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  return rng_t(nu)*sigma + mu;
+}
+
+}
+
+
+#endif
@@ -0,0 +1,349 @@
+#ifndef EXTRADISTR_LOGARITHMIC_SERIES_DISTRIBUTION_H
+#define EXTRADISTR_LOGARITHMIC_SERIES_DISTRIBUTION_H
+
+#include "shared.h"
+#include <limits>
+#include <algorithm>
+
+namespace extraDistr {
+
+
+/*
+*  Logarithmic Series distribution
+*
+*  Values:
+*  x
+*
+*  Parameters:
+*  0 < theta < 1
+*
+*  f(x) = (-1/std::log(1-theta)*theta^x) / x
+*  F(x) = -1/std::log(1-theta) * sum((theta^x)/x)
+*
+*/
+
+
+inline double logpdf_lgser(double x, double theta, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(theta))
+    return x+theta;
+#endif
+  if (theta <= 0.0 || theta >= 1.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (!isInteger(x) || x < 1.0)
+    return R_NegInf;
+  // a = -1.0/log(1.0 - theta);
+  double a = -1.0/log1p(-theta);
+  // a * pow(theta, x) / x;
+  return std::log(a) + (std::log(theta) * x) - std::log(x);
+}
+
+// The cdf is the sum of the probabilities for the first LGSER_DIRECT
+// values, further it is evaluated from the upper tail (see lgser_tail),
+// so the cost does not grow with x.
+
+static const int LGSER_DIRECT = 64;
+
+// exp(z) * E1(z), the scaled exponential integral for z > 0, from the
+// power series for z <= 1 and the continued fraction otherwise
+
+inline double scaled_expint_e1(double z) {
+  const double eps = std::numeric_limits<double>::epsilon();
+  if (z <= 1.0) {
+    double sum = 0.0, term = 1.0, dk;
+    for (int k = 1; k < 100; k++) {
+      dk = to_dbl(k);
+      term *= -z / dk;
+      sum += term / dk;
+      if (std::abs(term / dk) < eps * 1e-2)
+        break;
+    }
+    // -Euler's constant - log(z) - sum
+    return std::exp(z) * (-0.5772156649015328606065 - std::log(z) - sum);
+  }
+  double b = z + 1.0;
+  double c = 1.0 / std::numeric_limits<double>::min();
+  double d = 1.0 / b;
+  double h = d, an, del;
+  for (int i = 1; i < 1000; i++) {
+    an = -to_dbl(i) * to_dbl(i);
+    b += 2.0;
+    d = 1.0 / (an * d + b);
+    c = b + an / c;
+    del = c * d;
+    h *= del;
+    if (std::abs(del - 1.0) < eps)
+      break;
+  }
+  return h;
+}
+
+// sum(theta^k / k) for k >= y, where y > LGSER_DIRECT
+//
+// For theta <= 1/2 the terms decrease at least geometrically, so they
+// are added up until the rest is negligible. Otherwise, with s0 = -log(theta),
+// the sum is the integral of exp(-y*s) / (1 - exp(-s)) over s > s0, and
+// expanding 1/(1 - exp(-s)) = 1/s + 1/2 + sum(B[2k] s^(2k-1) / (2k)!)
+// gives
+//
+//   E1(y*s0) + exp(-y*s0) * (1/(2y) + sum(B[2k]/(2k) * P(2k, y*s0) / y^(2k)))
+//
+// where P(n, z) = sum(z^i / i!, i < n). The series is asymptotic in y,
+// with error of order exp(-2*pi*y), so negligible for y > LGSER_DIRECT.
+
+inline double lgser_tail(double y, double theta, double log_theta) {
+  
+  const double eps = std::numeric_limits<double>::epsilon();
+  double u, z, term;
+  
+  if (theta <= 0.5) {
+    // relative to theta^y / y
+    u = 0.0;
+    term = 1.0;
+    for (double j = 0.0; j < 1000.0; j += 1.0) {
+      u += term;
+      term *= theta * (y + j) / (y + j + 1.0);
+      if (term * theta / (1.0 - theta) < eps * u)
+        break;
+    }
+    return std::exp(y * log_theta - std::log(y)) * u;
+  }
+  
+  // B[2k] / (2k)
+  static const double bern[] = {
+    1.0/12.0, -1.0/120.0, 1.0/252.0, -1.0/240.0, 1.0/132.0,
+    -691.0/32760.0, 1.0/12.0, -3617.0/8160.0, 43867.0/14364.0,
+    -174611.0/6600.0
+  };
+  
+  z = -log_theta * y;
+  if (z > 750.0)
+    return 0.0;
+  
+  double zi = 1.0;         // z^i / i!
+  double pk = 0.0;         // P(2k, z)
+  double inv_y2 = 1.0 / (y * y);
+  double scale = 1.0;      // 1 / y^(2k)
+  
+  u = scaled_expint_e1(z) + 0.5 / y;
+  for (int k = 1; k <= 10; k++) {
+    pk += zi;
+    zi *= z / to_dbl(2*k - 1);
+    pk += zi;
+    zi *= z / to_dbl(2*k);
+    scale *= inv_y2;
+    term = bern[k-1] * pk * scale;
+    u += term;
+    if (std::abs(term) < eps * u)
+      break;
+  }
+  
+  return std::exp(-z) * u;
+}
+
+inline double cdf_lgser(double x, double theta, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(theta))
+    return x+theta;
+#endif
+  if (theta <= 0.0 || theta >= 1.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 1.0)
+    return 0.0;
+  if (!R_FINITE(x))
+    return 1.0;
+  
+  double a = -1.0/log1p(-theta);
+  double ix = std::floor(x);
+  
+  if (ix > to_dbl(LGSER_DIRECT))
+    return 1.0 - a * lgser_tail(ix + 1.0, theta, std::log(theta));
+  
+  // theta^k / k added in the same order as in LgserFrozen
+  double pk = theta;
+  double b = theta;
+  
+  for (int k = 2; k <= static_cast<int>(ix); k++) {
+    pk *= theta;
+    b += pk / to_dbl(k);
+  }
+  
+  return a * b;
+}
+
+inline double invcdf_lgser(double p, double theta, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(theta))
+    return p+theta;
+#endif
+  if (theta <= 0.0 || theta >= 1.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (p == 0.0)
+    return 1.0;
+  if (p == 1.0)
+    return R_PosInf;
+  
+  double a = -1.0/log1p(-theta);
+  double pk = theta;
+  double b = theta;
+  
+  if (p <= a * b)
+    return 1.0;
+  
+  for (int k = 2; k <= LGSER_DIRECT; k++) {
+    pk *= theta;
+    b += pk / to_dbl(k);
+    if (p <= a * b)
+      return to_dbl(k);
+  }
+  
+  double log_theta = std::log(theta);
+  double x0 = to_dbl(LGSER_DIRECT + 1);
+  
+  return discrete_quantile(p, x0, x0, R_PosInf, [&](double x) {
+    return 1.0 - a * lgser_tail(x + 1.0, theta, log_theta);
+  });
+}
+
+// Kemp's (1981) algorithm LK, that takes two uniform values per draw
+// at most, whatever the theta is
+
+inline double rng_lgser_kemp(double theta, double log_1m_theta) {
+  double v = rng_unif();
+  if (v >= theta)
+    return 1.0;
+  double q = -std::expm1(rng_unif() * log_1m_theta);
+  if (v <= q * q)
+    return std::floor(1.0 + std::log(v) / std::log(q));
+  if (v <= q)
+    return 2.0;
+  return 1.0;
+}
+
+inline double rng_lgser(double theta, bool& throw_warning) {
+  if (ISNAN(theta) || theta <= 0.0 || theta >= 1.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  return rng_lgser_kemp(theta, log1p(-theta));
+}
+
+
+
+/*
+ * Logarithmic series distribution with fixed parameter
+ *
+ * -1/log(1-theta), log(theta) and the cumulative probabilities of the
+ * first LGSER_DIRECT values are computed once, when the object is
+ * created. The results are the same as from logpdf_lgser, cdf_lgser,
+ * invcdf_lgser and rng_lgser.
+ *
+ */
+
+class LgserFrozen {
+
+  double theta;
+  bool nan_param, invalid;
+  double a, log_a, log_theta, log_1m_theta;
+  double cdf_table[LGSER_DIRECT];   // F(k) for k = 1, ..., LGSER_DIRECT
+
+public:
+
+  LgserFrozen(double theta) : theta(theta) {
+    nan_param = ISNAN(theta);
+    invalid = nan_param || theta <= 0.0 || theta >= 1.0;
+    a = log_a = log_theta = log_1m_theta = NAN;
+    if (invalid)
+      return;
+    a = -1.0/log1p(-theta);
+    log_a = std::log(a);
+    log_theta = std::log(theta);
+    log_1m_theta = log1p(-theta);
+    double pk = theta;
+    double b = theta;
+    cdf_table[0] = a * b;
+    for (int k = 2; k <= LGSER_DIRECT; k++) {
+      pk *= theta;
+      b += pk / to_dbl(k);
+      cdf_table[k-1] = a * b;
+    }
+  }
+
+  inline double pdf(double x, bool log_prob, bool& throw_warning) const {
+    double lp;
+#ifdef IEEE_754
+    if (ISNAN(x) || nan_param)
+      return x+theta;
+#endif
+    if (invalid) {
+      throw_warning = true;
+      return NAN;
+    }
+    if (!isInteger(x) || x < 1.0)
+      lp = R_NegInf;
+    else
+      lp = log_a + (log_theta * x) - std::log(x);
+    return log_prob ? lp : std::exp(lp);
+  }
+
+  inline double cdf(double x, bool& throw_warning) const {
+#ifdef IEEE_754
+    if (ISNAN(x) || nan_param)
+      return x+theta;
+#endif
+    if (invalid) {
+      throw_warning = true;
+      return NAN;
+    }
+    if (x < 1.0)
+      return 0.0;
+    if (!R_FINITE(x))
+      return 1.0;
+    double ix = std::floor(x);
+    if (ix > to_dbl(LGSER_DIRECT))
+      return 1.0 - a * lgser_tail(ix + 1.0, theta, log_theta);
+    return cdf_table[static_cast<int>(ix) - 1];
+  }
+
+  inline double invcdf(double p, bool& throw_warning) const {
+#ifdef IEEE_754
+    if (ISNAN(p) || nan_param)
+      return p+theta;
+#endif
+    if (invalid || !VALID_PROB(p)) {
+      throw_warning = true;
+      return NAN;
+    }
+    if (p == 0.0)
+      return 1.0;
+    if (p == 1.0)
+      return R_PosInf;
+    const double* it =
+      std::lower_bound(cdf_table, cdf_table + LGSER_DIRECT, p);
+    if (it != cdf_table + LGSER_DIRECT)
+      return to_dbl(static_cast<int>(it - cdf_table) + 1);
+    double x0 = to_dbl(LGSER_DIRECT + 1);
+    return discrete_quantile(p, x0, x0, R_PosInf, [&](double x) {
+      return 1.0 - a * lgser_tail(x + 1.0, theta, log_theta);
+    });
+  }
+
+  inline double rng(bool& throw_warning) const {
+    if (invalid) {
+      throw_warning = true;
+      return NA_REAL;
+    }
+    return rng_lgser_kemp(theta, log_1m_theta);
+  }
+
+};
+}
+
+
+#endif
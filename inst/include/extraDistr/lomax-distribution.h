@@ -0,0 +1,83 @@
+#ifndef EXTRADISTR_LOMAX_DISTRIBUTION_H
+#define EXTRADISTR_LOMAX_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+*  Lomax distribution
+*
+*  Values:
+*  x > 0
+*
+*  Parameters:
+*  lambda > 0
+*  kappa > 0
+*
+*  f(x)    = lambda*kappa / (1+lambda*x)^(kappa+1)
+*  F(x)    = 1-(1+lambda*x)^-kappa
+*  F^-1(p) = ((1-p)^(-1/kappa)-1) / lambda
+*
+*/
+
+
+inline double logpdf_lomax(double x, double lambda, double kappa,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(lambda) || ISNAN(kappa))
+    return x+lambda+kappa;
+#endif
+  if (lambda <= 0.0 || kappa <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x <= 0.0)
+    return R_NegInf;
+  // lambda*kappa / pow(1.0+lambda*x, kappa+1.0);
+  return std::log(lambda) + std::log(kappa) - log1p(lambda*x)*(kappa+1.0);
+}
+
+inline double cdf_lomax(double x, double lambda, double kappa,
+                        bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(lambda) || ISNAN(kappa))
+    return x+lambda+kappa;
+#endif
+  if (lambda <= 0.0 || kappa <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x <= 0.0)
+    return 0.0;
+  // 1.0 - pow(1.0+lambda*x, -kappa);
+  return 1.0 - std::exp(log1p(lambda*x) * (-kappa));
+}
+
+inline double invcdf_lomax(double p, double lambda, double kappa,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(lambda) || ISNAN(kappa))
+    return p+lambda+kappa;
+#endif
+  if (lambda <= 0.0 || kappa <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  return (std::pow(1.0-p, -1.0/kappa)-1.0) / lambda;
+}
+
+inline double rng_lomax(double lambda, double kappa, bool& throw_warning) {
+  if (ISNAN(lambda) || ISNAN(kappa) || lambda <= 0.0 || kappa <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double u = rng_unif();
+  return (std::pow(u, -1.0/kappa)-1.0) / lambda;
+}
+
+}
+
+
+#endif
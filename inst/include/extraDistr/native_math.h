@@ -0,0 +1,370 @@
+#ifndef EXTRADISTR_NATIVE_MATH_H
+#define EXTRADISTR_NATIVE_MATH_H
+
+#include <cmath>
+#include <limits>
+
+/*
+ * Native implementations of the special functions
+ *
+ * They do not depend on R, so they can be inlined and called from multiple
+ * threads. The special cases (NaN's, infinities, non-integer arguments)
+ * are handled in the same way as in R's math library, but no warnings are
+ * issued. They are used instead of R's functions by the helpers in
+ * shared_inline.h when the package is compiled with EDCPP_NATIVE_MATH
+ * defined.
+ *
+ */
+
+namespace extraDistr {
+namespace native {
+
+static const double LN_SQRT_2PI = 0.918938533204672741780329736406; // log(sqrt(2*pi))
+static const double ONE_SQRT_2PI = 0.398942280401432677939946059934; // 1/sqrt(2*pi)
+static const double PI = 3.141592653589793238462643383280;
+
+inline bool is_int(double x) {
+  return std::abs(x - std::nearbyint(x)) <= 1e-7 * std::fmax(1.0, std::abs(x));
+}
+
+
+// Stirling's series for log(gamma(x)) - ((x-0.5)*log(x) - x + log(sqrt(2*pi))),
+// accurate to double precision for x >= 10
+
+inline double lgammacor(double x) {
+  double z = 1.0/(x*x);
+  return (1.0/12.0 + z*(-1.0/360.0 + z*(1.0/1260.0 + z*(-1.0/1680.0 +
+          z*(1.0/1188.0 + z*(-691.0/360360.0 + z*(1.0/156.0 +
+          z*(-3617.0/122400.0)))))))) / x;
+}
+
+// log(gamma(1+a)) for |a| < 0.5, see lgamma1p in pgamma.c of R's math
+// library (Abramowitz and Stegun 6.1.33):
+//
+// log(gamma(1+a)) = -(log(1+a) - a) - euler*a + a^2 * sum_n c_n (-a)^n
+//
+// where c_n = (zeta(n+2) - 1)/(n+2). The terms shrink faster than 4^-n,
+// so 40 of them reach double precision, and there is no cancellation
+// near the root at a = 0
+
+inline double lgamma1p(double a) {
+  static const double EULER = 0.577215664901532860606512090082; // Euler's constant
+  static const double coeffs[40] = {
+    3.22467033424113203033e-01, 6.73523010531981020099e-02,
+    2.05808084277845464161e-02, 7.38555102867398567679e-03,
+    2.89051033074152335933e-03, 1.19275391170326101886e-03,
+    5.09669524743042450139e-04, 2.23154758453579385793e-04,
+    9.94575127818085309803e-05, 4.49262367381331420460e-05,
+    2.05072127756706910667e-05, 9.43948827526839671519e-06,
+    4.37486678990748817440e-06, 2.03921575380136618969e-06,
+    9.55141213040741935301e-07, 4.49246919876456618549e-07,
+    2.12071848055546646449e-07, 1.00432248239680990840e-07,
+    4.76981016936398039829e-08, 2.27110946089431635043e-08,
+    1.08386592148969545929e-08, 5.18347504197004664423e-09,
+    2.48367454380247847524e-09, 1.19214014058609115474e-09,
+    5.73136724167886225144e-10, 2.75952288512423335590e-10,
+    1.33047643742444888200e-10, 6.42296456383809959886e-11,
+    3.10442477473222756339e-11, 1.50213840807541416646e-11,
+    7.27597448023907917455e-12, 3.52774247657591506519e-12,
+    1.71199179055961797854e-12, 8.31538584142028497931e-13,
+    4.04220052528944019226e-13, 1.96647563109661653113e-13,
+    9.57363038783855556605e-14, 4.66407602642837444320e-14,
+    2.27373696006597241735e-14, 1.10913994708345221759e-14
+  };
+  double lgam = 0.0;
+  for (int i = 39; i >= 0; i--)
+    lgam = coeffs[i] - a * lgam;
+  return (a * lgam - EULER) * a - (std::log1p(a) - a);
+}
+
+// log(abs(gamma(x)))
+
+inline double lgamma(double x) {
+  if (std::isnan(x))
+    return x;
+  if (x <= 0.0 && x == std::trunc(x))
+    return std::numeric_limits<double>::infinity();
+  if (std::isinf(x))
+    return std::numeric_limits<double>::infinity();
+  // near the roots at 1 and 2, shifting x up to 10 would cancel
+  if (x >= 0.5 && x < 1.5)
+    return lgamma1p(x - 1.0);
+  if (x >= 1.5 && x < 2.5)
+    return std::log1p(x - 2.0) + lgamma1p(x - 2.0);
+
+  if (x < 0.0) {
+    // reflection formula, sin(pi*x) is evaluated on the fractional part
+    double s = std::sin(PI * (x - std::floor(x)));
+    return std::log(PI / std::abs(s)) - lgamma(1.0 - x);
+  }
+
+  if (x >= 10.0)
+    return (x - 0.5) * std::log(x) - x + LN_SQRT_2PI + lgammacor(x);
+
+  // gamma(x) = gamma(x+k) / (x*(x+1)*...*(x+k-1))
+  double prod = 1.0;
+  while (x < 10.0) {
+    prod *= x;
+    x += 1.0;
+  }
+  return (x - 0.5) * std::log(x) - x + LN_SQRT_2PI + lgammacor(x) -
+    std::log(prod);
+}
+
+inline double gamma(double x) {
+  if (std::isnan(x))
+    return x;
+  if (x == 0.0 || (x < 0.0 && x == std::trunc(x)))
+    return std::numeric_limits<double>::quiet_NaN();
+  return std::tgamma(x);
+}
+
+// log(beta(a, b)), see also lbeta.c in R's math library
+
+inline double lbeta(double a, double b) {
+  if (std::isnan(a) || std::isnan(b))
+    return a+b;
+
+  double p = std::fmin(a, b);
+  double q = std::fmax(a, b);
+
+  if (p < 0.0)
+    return std::numeric_limits<double>::quiet_NaN();
+  if (p == 0.0)
+    return std::numeric_limits<double>::infinity();
+  if (std::isinf(q))
+    return -std::numeric_limits<double>::infinity();
+
+  if (p >= 10.0) {
+    double corr = lgammacor(p) + lgammacor(q) - lgammacor(p + q);
+    return std::log(q) * -0.5 + LN_SQRT_2PI + corr + (p - 0.5) *
+      std::log(p / (p + q)) + q * std::log1p(-p / (p + q));
+  } else if (q >= 10.0) {
+    double corr = lgammacor(q) - lgammacor(p + q);
+    return lgamma(p) + corr + p - p * std::log(p + q) +
+      (q - 0.5) * std::log1p(-p / (p + q));
+  }
+  return lgamma(p) + lgamma(q) - lgamma(p + q);
+}
+
+// log(abs(choose(n, k))), see also choose.c in R's math library
+
+inline double lchoose(double n, double k) {
+  if (std::isnan(n) || std::isnan(k))
+    return n+k;
+
+  k = std::nearbyint(k);
+
+  if (k < 2.0) {
+    if (k < 0.0)
+      return -std::numeric_limits<double>::infinity();
+    if (k == 0.0)
+      return 0.0;
+    return std::log(std::abs(n));
+  }
+  if (n < 0.0)
+    return lchoose(-n + k - 1.0, k);
+  if (is_int(n)) {
+    n = std::nearbyint(n);
+    if (n < k)
+      return -std::numeric_limits<double>::infinity();
+    if (n - k < 2.0)
+      return lchoose(n, n - k);
+    return -std::log(n + 1.0) - lbeta(n - k + 1.0, k + 1.0);
+  }
+  if (n < k - 1.0)
+    return lgamma(n + 1.0) - lgamma(k + 1.0) - lgamma(n - k + 1.0);
+  return -std::log(n + 1.0) - lbeta(n - k + 1.0, k + 1.0);
+}
+
+
+// standard normal density
+
+inline double dnorm(double x) {
+  x = std::abs(x);
+  if (x >= 2.0 * std::sqrt(std::numeric_limits<double>::max()))
+    return 0.0;
+  if (x < 5.0)
+    return ONE_SQRT_2PI * std::exp(-0.5 * x * x);
+  // split x to avoid the rounding error of x*x
+  double x1 = std::ldexp(std::nearbyint(std::ldexp(x, 16)), -16);
+  double x2 = x - x1;
+  return ONE_SQRT_2PI * (std::exp(-0.5 * x1 * x1) *
+                         std::exp((-0.5 * x2 - x1) * x2));
+}
+
+inline double ldnorm(double x) {
+  return -(LN_SQRT_2PI + 0.5 * x * x);
+}
+
+// standard normal cumulative distribution function (lower tail)
+
+inline double pnorm(double x) {
+  return 0.5 * std::erfc(-x * 0.707106781186547524400844362105);
+}
+
+// standard normal quantile function
+//
+// Wichura, M.J. (1988). Algorithm AS 241: The Percentage Points of
+// the Normal Distribution. Applied Statistics, 37, 477-484.
+
+inline double qnorm(double p) {
+  if (std::isnan(p))
+    return p;
+  if (p < 0.0 || p > 1.0)
+    return std::numeric_limits<double>::quiet_NaN();
+  if (p == 0.0)
+    return -std::numeric_limits<double>::infinity();
+  if (p == 1.0)
+    return std::numeric_limits<double>::infinity();
+
+  double q = p - 0.5;
+  double r, val;
+
+  if (std::abs(q) <= 0.425) {
+    r = 0.180625 - q * q;
+    return q * (((((((r * 2509.0809287301226727 +
+               33430.575583588128105) * r + 67265.770927008700853) * r +
+               45921.953931549871457) * r + 13731.693765509461125) * r +
+               1971.5909503065514427) * r + 133.14166789178437745) * r +
+               3.387132872796366608) /
+      (((((((r * 5226.495278852545925 +
+      28729.085735721942674) * r + 39307.89580009271061) * r +
+      21213.794301586595867) * r + 5394.1960214247511077) * r +
+      687.1870074920579083) * r + 42.313330701600911252) * r + 1.0);
+  }
+
+  r = std::sqrt(-std::log(q < 0.0 ? p : 1.0 - p));
+
+  if (r <= 5.0) {
+    r -= 1.6;
+    val = (((((((r * 7.7454501427834140764e-4 +
+          0.0227238449892691845833) * r + 0.24178072517745061177) * r +
+          1.27045825245236838258) * r + 3.64784832476320460504) * r +
+          5.7694972214606914055) * r + 4.6303378461565452959) * r +
+          1.42343711074968357734) /
+      (((((((r * 1.05075007164441684324e-9 +
+      5.475938084995344946e-4) * r + 0.0151986665636164571966) * r +
+      0.14810397642748007459) * r + 0.68976733498510000455) * r +
+      1.6763848301838038494) * r + 2.05319162663775882187) * r + 1.0);
+  } else {
+    r -= 5.0;
+    val = (((((((r * 2.01033439929228813265e-7 +
+          2.71155556874348757815e-5) * r + 0.0012426609473880784386) * r +
+          0.026532189526576123093) * r + 0.29656057182850489123) * r +
+          1.7848265399172913358) * r + 5.4637849111641143699) * r +
+          6.6579046435011037772) /
+      (((((((r * 2.04426310338993978564e-15 +
+      1.4215117583164458887e-7) * r + 1.8463183175100546818e-5) * r +
+      7.868691311456132591e-4) * r + 0.0148753612908506148525) * r +
+      0.13692988092273580531) * r + 0.59983220655588793769) * r + 1.0);
+  }
+
+  return q < 0.0 ? -val : val;
+}
+
+
+// log of the standard normal cumulative distribution function (lower
+// tail), erfc keeps its relative precision down to x = -30, below the
+// asymptotic expansion of the Mills ratio is used
+//
+//   Phi(x) = phi(x)/|x| * (1 - 1/x^2 + 3/x^4 - 15/x^6 + ...)
+
+inline double lpnorm(double x) {
+  if (std::isnan(x))
+    return x;
+  if (x > 0.0)
+    return std::log1p(-0.5 * std::erfc(x * 0.707106781186547524400844362105));
+  if (x > -30.0)
+    return std::log(0.5 * std::erfc(-x * 0.707106781186547524400844362105));
+  if (x == -std::numeric_limits<double>::infinity())
+    return x;
+  double z = 1.0/(x*x);
+  double s = 1.0 - z*(1.0 - z*(3.0 - z*(15.0 - z*(105.0 - z*(945.0 -
+             z*10395.0)))));
+  return ldnorm(x) - std::log(-x) + std::log(s);
+}
+
+// standard normal quantile function for log-probabilities, qnorm() is
+// used while exp(lp) does not underflow, below it is refined by Newton's
+// method on lpnorm()
+
+inline double qnorm_log(double lp) {
+  if (std::isnan(lp))
+    return lp;
+  if (lp > 0.0)
+    return std::numeric_limits<double>::quiet_NaN();
+  if (lp > -0.693147180559945309417232121458)
+    return -qnorm(-std::expm1(lp));
+  if (lp > -700.0)
+    return qnorm(std::exp(lp));
+  if (lp == -std::numeric_limits<double>::infinity())
+    return lp;
+  // lp ~ -x^2/2 - log(-x) - log(sqrt(2*pi))
+  double t = -2.0 * (lp + LN_SQRT_2PI);
+  double x = -std::sqrt(t - std::log(t));
+  for (int i = 0; i < 10; i++) {
+    double lx = lpnorm(x);
+    double dx = (lx - lp) / std::exp(ldnorm(x) - lx);
+    x -= dx;
+    if (std::abs(dx) <= 1e-15 * std::abs(x))
+      break;
+  }
+  return x;
+}
+
+
+// Modified Bessel function of the first kind I_nu(x), multiplied by
+// exp(-x) if expo == 2, for x >= 0 and nu >= 0 or integer nu
+//
+// The power series is summed starting from its largest term, all the
+// terms are positive, so there is no cancellation.
+
+inline double bessel_i(double x, double nu, double expo) {
+  if (std::isnan(x) || std::isnan(nu))
+    return x + nu;
+  if (x < 0.0)
+    return std::numeric_limits<double>::quiet_NaN();
+  if (nu < 0.0) {
+    if (nu != std::trunc(nu))
+      return std::numeric_limits<double>::quiet_NaN();
+    nu = -nu;  // I_{-n}(x) = I_n(x)
+  }
+  if (x == 0.0)
+    return (nu == 0.0) ? 1.0 : 0.0;
+  if (std::isinf(x))
+    return (expo == 2.0) ? 0.0 : x;
+
+  const double eps = std::numeric_limits<double>::epsilon();
+  double hx2 = 0.25 * x * x;
+  double m0 = std::floor(0.5 * (std::sqrt(nu * nu + x * x) - nu));
+  double sum = 1.0;
+  double t = 1.0;
+
+  for (double m = m0; ; m += 1.0) {
+    t *= hx2 / ((m + 1.0) * (m + nu + 1.0));
+    sum += t;
+    if (t < eps * sum)
+      break;
+  }
+
+  t = 1.0;
+  for (double m = m0; m > 0.0; m -= 1.0) {
+    t *= m * (m + nu) / hx2;
+    sum += t;
+    if (t < eps * sum)
+      break;
+  }
+
+  double lterm = (2.0 * m0 + nu) * std::log(0.5 * x) -
+    lgamma(m0 + 1.0) - lgamma(m0 + nu + 1.0);
+  if (expo == 2.0)
+    lterm -= x;
+  return std::exp(lterm + std::log(sum));
+}
+
+}
+}
+
+
+#endif
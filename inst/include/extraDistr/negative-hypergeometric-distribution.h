@@ -0,0 +1,48 @@
+#ifndef EXTRADISTR_NEGATIVE_HYPERGEOMETRIC_DISTRIBUTION_H
+#define EXTRADISTR_NEGATIVE_HYPERGEOMETRIC_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+*  Negative hypergeometric distribution
+*
+*  Values:
+*  r <= x <= n+r
+*
+*  Parameters:
+*  n >= 0 (integer)
+*  m >= 0 (integer)
+*  0 <= r <= m (integer)
+*
+*  f(x) = choose(x-1, r-1)*choose(m+n-x, m-r)/choose(m+n, n)
+*
+*/
+
+inline double logpmf_nhyper(double x, double n, double m, double r,
+                            bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(n) || ISNAN(m) || ISNAN(r))
+    return x+n+m+r;
+#endif
+  if (r > m || n < 0.0 || m < 0.0 || r < 0.0 ||
+      !isInteger(n, false) || !isInteger(m, false) ||
+      !isInteger(r, false)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (!isInteger(x) || x < r || x > n+r)
+    return R_NegInf;
+  // with r = 0 nothing needs to be drawn, so x = 0
+  if (r == 0.0)
+    return (x == 0.0) ? 0.0 : R_NegInf;
+  return lchoose_fn(x-1.0, r-1.0) + lchoose_fn(m+n-x, m-r) -
+    lchoose_fn(m+n, n);
+}
+
+
+}
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef EXTRADISTR_NON_STANDART_BETA_DISTRIBUTION_H
+#define EXTRADISTR_NON_STANDART_BETA_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+*  Non-standard beta distribution
+*
+*  Values:
+*  x
+*
+*  Parameters:
+*  0 <= beta <= 1
+*  alpha > 0
+*  lower < upper
+*
+*/
+
+inline double pdf_nsbeta(double x, double alpha, double beta, double l,
+                         double u, bool log_p, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta) || ISNAN(l) || ISNAN(u))
+    return x+alpha+beta+l+u;
+#endif
+  if (l >= u || alpha < 0.0 || beta < 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  double r = u-l;
+  double p = R::dbeta((x-l)/r, alpha, beta, log_p);
+  if (log_p) 
+    return p-std::log(r);
+  else
+    return p/r;
+}
+
+inline double cdf_nsbeta(double x, double alpha, double beta, double l,
+                         double u, bool lower_tail, bool log_p, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta) || ISNAN(l) || ISNAN(u))
+    return x+alpha+beta+l+u;
+#endif
+  if (l >= u || alpha < 0.0 || beta < 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  return R::pbeta((x-l)/(u-l), alpha, beta, lower_tail, log_p);
+}
+
+inline double invcdf_nsbeta(double p, double alpha, double beta, double l,
+                            double u, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(alpha) || ISNAN(beta) || ISNAN(l) || ISNAN(u))
+    return p+alpha+beta+l+u;
+#endif
+  if (l >= u || alpha < 0.0 || beta < 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  return R::qbeta(p, alpha, beta, true, false) * (u-l) + l;
+}
+
+inline double rng_nsbeta(double alpha, double beta, double l, double u,
+                         bool& throw_warning) {
+  if (ISNAN(alpha) || ISNAN(beta) || ISNAN(l) || ISNAN(u) ||
+      l >= u || alpha < 0.0 || beta < 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  return rng_beta(alpha, beta) * (u-l) + l;
+}
+
+}
+
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef EXTRADISTR_PARETO_DISTRIBUTION_H
+#define EXTRADISTR_PARETO_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+ *  Pareto distribution
+ *
+ *  Values:
+ *  x
+ *
+ *  Parameters:
+ *  a, b > 0
+ *
+ *  f(x)    = (a*b^a) / x^{a+1}
+ *  F(x)    = 1 - (b/x)^a
+ *  F^-1(p) = b/(1-p)^{1-a}
+ *
+ */
+
+inline double logpdf_pareto(double x, double a, double b,
+                            bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(a) || ISNAN(b))
+    return x+a+b;
+#endif
+  if (a <= 0.0 || b <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < b)
+    return R_NegInf;
+  // a * pow(b, a) / pow(x, a+1.0);
+  return std::log(a) + std::log(b)*a - std::log(x)*(a+1.0);
+}
+
+inline double cdf_pareto(double x, double a, double b,
+                         bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(a) || ISNAN(b))
+    return x+a+b;
+#endif
+  if (a <= 0.0 || b <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < b)
+    return 0.0;
+  return 1.0 - std::pow(b/x, a);
+}
+
+inline double invcdf_pareto(double p, double a, double b,
+                            bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(a) || ISNAN(b))
+    return p+a+b;
+#endif
+  if (a <= 0.0 || b <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  return b / std::pow(1.0-p, 1.0/a);
+}
+
+inline double rng_pareto(double a, double b, bool& throw_warning) {
+  if (ISNAN(a) || ISNAN(b) || a <= 0.0 || b <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double u = rng_unif();
+  return b / std::pow(u, 1.0/a);
+}
+
+}
+
+
+#endif
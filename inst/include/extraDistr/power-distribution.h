@@ -0,0 +1,87 @@
+#ifndef EXTRADISTR_POWER_DISTRIBUTION_H
+#define EXTRADISTR_POWER_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+*  Power distribution
+*
+*  Values:
+*  0 < x < alpha
+*
+*  Parameters:
+*  alpha > 0
+*  beta > 0
+*
+*  f(x)    = (beta*x^(beta-1)) / (alpha^beta)
+*  F(x)    = x^beta / alpha^beta
+*  F^-1(p) = alpha * p^(1/beta)
+*
+*/
+
+
+inline double logpdf_power(double x, double alpha, double beta,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta))
+    return x+alpha+beta;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x <= 0.0 || x >= alpha)
+    return R_NegInf;
+  // beta * pow(x, beta-1.0) / pow(alpha, beta);
+  return std::log(beta) + std::log(x)*(beta-1.0) - std::log(alpha)*beta;
+}
+
+inline double cdf_power(double x, double alpha, double beta,
+                        bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta))
+    return x+alpha+beta;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x <= 0.0)
+    return 0.0;
+  if (x >= alpha)
+    return 1.0;
+  // pow(x, beta) / pow(alpha, beta);
+  return std::exp( std::log(x)*beta - std::log(alpha)*beta );
+}
+
+inline double invcdf_power(double p, double alpha, double beta,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(alpha) || ISNAN(beta))
+    return p+alpha+beta;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  return alpha * std::pow(p, 1.0/beta);
+}
+
+inline double rng_power(double alpha, double beta,
+                        bool& throw_warning) {
+  if (ISNAN(alpha) || ISNAN(beta) ||
+      alpha <= 0.0 || beta <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double u = rng_unif();
+  return alpha * std::pow(u, 1.0/beta);
+}
+
+}
+
+
+#endif
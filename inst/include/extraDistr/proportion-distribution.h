@@ -0,0 +1,74 @@
+#ifndef EXTRADISTR_PROPORTION_DISTRIBUTION_H
+#define EXTRADISTR_PROPORTION_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+*  Re-parametrized beta distribution
+*
+*  Values:
+*  x
+*
+*  Parameters:
+*  0 <= mean <= 1
+*  size > 0
+*  prior >= 0
+*
+*/
+
+inline double pdf_prop(double x, double size, double mean, double prior,
+                       bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(size) || ISNAN(mean) || ISNAN(prior))
+    return x+size+mean+prior;
+#endif
+  if (size <= 0.0 || mean <= 0.0 || mean >= 1.0 || prior < 0) {
+    throw_warning = true;
+    return NAN;
+  }
+  return R::dbeta(x, size*mean+prior, size*(1.0-mean)+prior, false);
+}
+
+inline double cdf_prop(double x, double size, double mean, double prior,
+                       bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(size) || ISNAN(mean) || ISNAN(prior))
+    return x+size+mean+prior;
+#endif
+  if (size <= 0.0 || mean <= 0.0 || mean >= 1.0 || prior < 0) {
+    throw_warning = true;
+    return NAN;
+  }
+  return R::pbeta(x, size*mean+prior, size*(1.0-mean)+prior, true, false);
+}
+
+inline double invcdf_prop(double p, double size, double mean, double prior,
+                          bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(size) || ISNAN(mean) || ISNAN(prior))
+    return p+size+mean+prior;
+#endif
+  if (size <= 0.0 || mean <= 0.0 || mean >= 1.0 || prior < 0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  return R::qbeta(p, size*mean+prior, size*(1.0-mean)+prior, true, false);
+}
+
+inline double rng_prop(double size, double mean, double prior,
+                       bool& throw_warning) {
+  if (ISNAN(size) || ISNAN(mean) || ISNAN(prior) ||
+      size <= 0.0 || mean <= 0.0 || mean >= 1.0 || prior < 0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  return rng_beta(size*mean+prior, size*(1.0-mean)+prior);
+}
+
+}
+
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef EXTRADISTR_RAYLEIGH_DISTRIBUTION_H
+#define EXTRADISTR_RAYLEIGH_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+ *  Rayleigh distribution
+ *
+ *  Values:
+ *  x >= 0
+ *
+ *  Parameters:
+ *  sigma > 0
+ *
+ *  f(x)    = x/sigma^2 * std::exp(-(x^2 / 2*sigma^2))
+ *  F(x)    = 1 - std::exp(-x^2 / 2*sigma^2)
+ *  F^-1(p) = sigma * std::sqrt(-2 * std::log(1-p))
+ *
+ */
+
+
+inline double logpdf_rayleigh(double x, double sigma,
+                              bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(sigma))
+    return x+sigma;
+#endif
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x <= 0.0 || !R_FINITE(x))
+    return R_NegInf;
+  // x/(sigma*sigma) * exp(-(x*x) / (2.0*(sigma*sigma)));
+  double lsigsq = 2.0 * std::log(sigma);
+  double lxsq = 2.0 * std::log(x);
+  return std::log(x) - lsigsq - std::exp( lxsq - LOG_2F - lsigsq );
+}
+
+inline double cdf_rayleigh(double x, double sigma,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(sigma))
+    return x+sigma;
+#endif
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0)
+    return 0.0;
+  if (!R_FINITE(x))
+    return 1.0;
+  return 1.0 - std::exp(-(x*x) / (2.0*(sigma*sigma)));
+}
+
+inline double invcdf_rayleigh(double p, double sigma,
+                              bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(sigma))
+    return p+sigma;
+#endif
+  if (!VALID_PROB(p) || sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  return std::sqrt(-2.0*(sigma*sigma) * std::log(1.0-p));
+}
+
+inline double rng_rayleigh(double sigma, bool& throw_warning) {
+  if (ISNAN(sigma) || sigma <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double u = rng_unif();
+  return std::sqrt(-2.0*(sigma*sigma) * std::log(u));
+}
+
+}
+
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef EXTRADISTR_RNG_H
+#define EXTRADISTR_RNG_H
+
+#include <cstdint>
+#include <cstddef>
+
+namespace extraDistr {
+
+/*
+ * Philox4x32-10 counter-based random number generator
+ *
+ * Each stream is identified by the (seed, stream id) pair and the values
+ * are a pure function of (seed, stream id, position in the stream), so
+ * streams can be used independently from any thread.
+ *
+ * Salmon, J.K., Moraes, M.A., Dror, R.O., and Shaw, D.E. (2011).
+ * Parallel random numbers: as easy as 1, 2, 3. [In:] Proceedings
+ * of the International Conference for High Performance Computing,
+ * Networking, Storage and Analysis (SC '11).
+ *
+ */
+
+class PhiloxStream {
+
+  uint32_t key[2];
+  uint32_t ctr[4];
+  uint32_t buf[4];
+  int pos;
+
+  inline static void round(uint32_t* c, const uint32_t* k) {
+    uint64_t p0 = static_cast<uint64_t>(0xD2511F53u) * c[0];
+    uint64_t p1 = static_cast<uint64_t>(0xCD9E8D57u) * c[2];
+    uint32_t c1 = c[1], c3 = c[3];
+    c[0] = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k[0];
+    c[1] = static_cast<uint32_t>(p1);
+    c[2] = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k[1];
+    c[3] = static_cast<uint32_t>(p0);
+  }
+
+  inline void refill() {
+    uint32_t k[2] = { key[0], key[1] };
+    for (int j = 0; j < 4; j++)
+      buf[j] = ctr[j];
+    for (int r = 0; r < 10; r++) {
+      if (r > 0) {
+        k[0] += 0x9E3779B9u;
+        k[1] += 0xBB67AE85u;
+      }
+      round(buf, k);
+    }
+    if (++ctr[0] == 0)
+      ctr[1]++;
+    pos = 0;
+  }
+
+public:
+
+  PhiloxStream(uint64_t seed, uint64_t stream) {
+    key[0] = static_cast<uint32_t>(seed);
+    key[1] = static_cast<uint32_t>(seed >> 32);
+    ctr[0] = ctr[1] = 0;
+    ctr[2] = static_cast<uint32_t>(stream);
+    ctr[3] = static_cast<uint32_t>(stream >> 32);
+    pos = 4;
+  }
+
+  inline uint32_t next32() {
+    if (pos == 4)
+      refill();
+    return buf[pos++];
+  }
+
+  // 53-bit uniform on the open (0, 1) interval
+  inline double unif() {
+    uint32_t a = next32() >> 5;
+    uint32_t b = next32() >> 6;
+    return (a * 67108864.0 + b + 0.5) / 9007199254740992.0;
+  }
+
+  // 52-bit uniform on the open (0, 1) interval and 8 random bits,
+  // disjoint from the bits of the uniform (used by the ziggurat samplers)
+  inline double unif_byte(int& byte) {
+    uint64_t w = static_cast<uint64_t>(next32()) << 32;
+    w |= next32();
+    byte = static_cast<int>(w & 0xFF);
+    return ((w >> 12) + 0.5) / 4503599627370496.0;
+  }
+
+};
+
+
+#ifdef EXTRADISTR_STANDALONE
+
+// without R there is no global generator, by default each thread draws
+// from its own stream, set_seed() re-seeds the stream of the calling
+// thread (both are defined in the core library)
+
+PhiloxStream& default_stream();
+void set_seed(uint64_t seed, uint64_t stream = 0);
+
+inline PhiloxStream*& rng_stream() {
+  static thread_local PhiloxStream* stream = &default_stream();
+  return stream;
+}
+
+#else
+
+// stream used by rng_unif() and friends in the current thread,
+// NULL means that R's generator is used
+
+inline PhiloxStream*& rng_stream() {
+  static thread_local PhiloxStream* stream = NULL;
+  return stream;
+}
+
+#endif
+
+}
+
+
+#endif
@@ -0,0 +1,552 @@
+#ifndef EXTRADISTR_SAMPLERS_H
+#define EXTRADISTR_SAMPLERS_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+/*
+ * Samplers for the standard distributions
+ *
+ * With R's generator (rng_stream() is NULL) the R samplers are called, so the
+ * results are the same as in base R. Otherwise the native implementations
+ * below are used, they draw only through rng_unif(), rng_norm() and rng_exp()
+ * and do not call R, so they can be used from multiple threads. Invalid
+ * parameters are handled in the same way as in R.
+ *
+ */
+
+
+// Marsaglia, G. and Tsang, W.W. (2000). A Simple Method for Generating
+// Gamma Variables. ACM Transactions on Mathematical Software, 26(3), 363-372.
+//
+// GammaSampler keeps the constants for a fixed shape, so that drawing many
+// values with the same shape (e.g. the rows of a Dirichlet sample) does not
+// recompute them. For shape < 1 the draws are boosted, G(a) = G(a+1) U^(1/a),
+// log_draw() returns log G(a) = log G(a+1) + log(U)/a, that does not underflow
+// even when G(a) itself would be rounded to zero (for a = 0.001 about half of
+// the draws are below the smallest double).
+//
+// The shape must be positive, draw() and log_draw() use R's sampler with
+// R's generator, native_draw() and native_log_draw() always the native one.
+
+class GammaSampler {
+
+  double shape;
+  double inv_shape;
+  bool boost;
+  double d, c;      // constants for shape (or shape+1 if boosted)
+
+  inline double mt_draw() const {
+    double x, v, u;
+    for (;;) {
+      do {
+        x = rng_norm();
+        v = 1.0 + c*x;
+      } while (v <= 0.0);
+      v = v*v*v;
+      u = rng_unif();
+      if (u < 1.0 - 0.0331 * (x*x)*(x*x))
+        return d*v;
+      if (std::log(u) < 0.5*x*x + d*(1.0 - v + std::log(v)))
+        return d*v;
+    }
+  }
+
+public:
+
+  GammaSampler(double shape)
+    : shape(shape), inv_shape(1.0/shape), boost(shape < 1.0) {
+    d = (boost ? 1.0 + shape : shape) - 1.0/3.0;
+    c = 1.0/std::sqrt(9.0*d);
+  }
+
+  inline double native_draw() const {
+    if (boost) {
+      double u = rng_unif();
+      return mt_draw() * std::pow(u, inv_shape);
+    }
+    return mt_draw();
+  }
+
+  inline double native_log_draw() const {
+    if (boost) {
+      double u = rng_unif();
+      return std::log(mt_draw()) + std::log(u) * inv_shape;
+    }
+    return std::log(mt_draw());
+  }
+
+  inline double draw() const {
+#ifndef EXTRADISTR_STANDALONE
+    if (rng_stream() == NULL)
+      return R::rgamma(shape, 1.0);
+#endif
+    return native_draw();
+  }
+
+  // with R's generator the scale is passed to R::rgamma, so the values
+  // are the same as from rng_gamma(shape, scale)
+  inline double draw(double scale) const {
+#ifndef EXTRADISTR_STANDALONE
+    if (rng_stream() == NULL)
+      return R::rgamma(shape, scale);
+#endif
+    return native_draw() * scale;
+  }
+
+  inline double log_draw() const {
+#ifndef EXTRADISTR_STANDALONE
+    if (rng_stream() == NULL) {
+      if (boost)
+        return std::log(R::rgamma(1.0 + shape, 1.0)) - rng_exp() * inv_shape;
+      return std::log(R::rgamma(shape, 1.0));
+    }
+#endif
+    return native_log_draw();
+  }
+
+};
+
+inline double native_gamma(double shape) {
+  return GammaSampler(shape).native_draw();
+}
+
+inline double native_beta(double a, double b) {
+  if (a < 1.0 || b < 1.0) {
+    // in log scale, x/(x+y) is 0/0 when both gammas underflow
+    double lx = GammaSampler(a).native_log_draw();
+    double ly = GammaSampler(b).native_log_draw();
+    return 1.0 / (1.0 + std::exp(ly - lx));
+  }
+  double x = native_gamma(a);
+  double y = native_gamma(b);
+  return x/(x+y);
+}
+
+
+// Inversion for small means, otherwise the transformed rejection
+// with squeeze (PTRS) algorithm
+//
+// Hormann, W. (1993). The transformed rejection method for generating
+// Poisson random variables. Insurance: Mathematics and Economics,
+// 12(1), 39-45.
+
+inline double native_pois(double lambda) {
+
+  if (lambda < 10.0) {
+    double enl = std::exp(-lambda);
+    double prod = rng_unif();
+    double k = 0.0;
+    while (prod > enl) {
+      prod *= rng_unif();
+      k += 1.0;
+    }
+    return k;
+  }
+
+  double slam = std::sqrt(lambda);
+  double loglam = std::log(lambda);
+  double b = 0.931 + 2.53*slam;
+  double a = -0.059 + 0.02483*b;
+  double inv_alpha = 1.1239 + 1.1328/(b - 3.4);
+  double vr = 0.9277 - 3.6224/(b - 2.0);
+  double u, v, us, k;
+
+  for (;;) {
+    u = rng_unif() - 0.5;
+    v = rng_unif();
+    us = 0.5 - std::abs(u);
+    k = std::floor((2.0*a/us + b)*u + lambda + 0.43);
+    if (us >= 0.07 && v <= vr)
+      return k;
+    if (k < 0.0 || (us < 0.013 && v > us))
+      continue;
+    if (std::log(v) + std::log(inv_alpha) - std::log(a/(us*us) + b) <=
+        -lambda + k*loglam - lgamma_fn(k + 1.0))
+      return k;
+  }
+}
+
+
+// Inversion for small n*p, otherwise the BTPE algorithm (triangle,
+// parallelograms and exponential tails as the majorizing function,
+// with squeezes), as in R's rbinom, p is replaced by min(p, 1-p)
+//
+// BinomSampler holds the setup constants for a fixed (n, p), native_binom()
+// keeps the last one per thread, so consecutive draws with the same
+// parameters (e.g. rbinom-like loops over scalar parameters) skip the setup.
+// The cache depends only on the parameters, so it does not change the
+// values drawn from the streams.
+//
+// Kachitvichyanukul, V. and Schmeiser, B.W. (1988). Binomial random variate
+// generation. Communications of the ACM, 31(2), 216-222.
+
+class BinomSampler {
+
+  double n, p;          // parameters, p as given
+  double r, q;          // r = min(p, 1-p), q = 1-r
+  bool flip;            // p > 0.5, return n - x
+  bool inversion;       // n*r < 30
+
+  // inversion
+  double s, a, r0;
+
+  // BTPE
+  double m, xm, xl, xr, c, laml, lamr, p1, p2, p3, p4, nrq;
+
+  inline double draw_inversion() const {
+    for (;;) {
+      double f = r0;
+      double u = rng_unif();
+      double k = 0.0;
+      while (u > f) {
+        u -= f;
+        k += 1.0;
+        if (k > n)
+          break;
+        f *= a/k - s;
+      }
+      if (k <= n)
+        return k;
+    }
+  }
+
+  // Stirling's series of log(k!) - (k+1/2)log(k+1) + (k+1) - log(2pi)/2,
+  // up to the term of order 1/k^9
+  inline static double stirling_tail(double z) {
+    double z2 = z*z;
+    return (13860.0 - (462.0 - (132.0 - (99.0 - 140.0/z2)/z2)/z2)/z2)/z/166320.0;
+  }
+
+  inline double draw_btpe() const {
+    double u, v, x, y, k;
+    for (;;) {
+
+      u = rng_unif() * p4;
+      v = rng_unif();
+
+      // triangular region, accept at once
+      if (u <= p1)
+        return std::floor(xm - p1*v + u);
+
+      if (u <= p2) {
+        // parallelograms
+        x = xl + (u - p1)/c;
+        v = v*c + 1.0 - std::abs(m - x + 0.5)/p1;
+        if (v > 1.0)
+          continue;
+        y = std::floor(x);
+      } else if (u <= p3) {
+        // left exponential tail
+        y = std::floor(xl + std::log(v)/laml);
+        if (y < 0.0 || v == 0.0)
+          continue;
+        v *= (u - p2)*laml;
+      } else {
+        // right exponential tail
+        y = std::floor(xr - std::log(v)/lamr);
+        if (y > n || v == 0.0)
+          continue;
+        v *= (u - p3)*lamr;
+      }
+
+      k = std::abs(y - m);
+
+      if (k <= 20.0 || k >= nrq/2.0 - 1.0) {
+        // explicit evaluation of f(y)/f(m) by the recursive formula
+        double f = 1.0;
+        if (m < y) {
+          for (double i = m + 1.0; i <= y; i++)
+            f *= a/i - s;
+        } else if (m > y) {
+          for (double i = y + 1.0; i <= m; i++)
+            f /= a/i - s;
+        }
+        if (v <= f)
+          return y;
+        continue;
+      }
+
+      // squeezing using the bounds on log(f(y)/f(m))
+      double rho = (k/nrq) * ((k*(k/3.0 + 0.625) + 0.1666666666666)/nrq + 0.5);
+      double t = -k*k/(2.0*nrq);
+      double lv = std::log(v);
+      if (lv < t - rho)
+        return y;
+      if (lv > t + rho)
+        continue;
+
+      // final acceptance test, Stirling's formula for the factorials
+      double x1 = y + 1.0;
+      double f1 = m + 1.0;
+      double z = n + 1.0 - m;
+      double w = n - y + 1.0;
+      if (lv <= xm*std::log(f1/x1) + (n - m + 0.5)*std::log(z/w) +
+                (y - m)*std::log(w*r/(x1*q)) + stirling_tail(f1) +
+                stirling_tail(z) + stirling_tail(x1) + stirling_tail(w))
+        return y;
+    }
+  }
+
+public:
+
+  BinomSampler() : n(NAN), p(NAN) {}
+
+  BinomSampler(double n, double p) : n(n), p(p) {
+    r = std::min(p, 1.0 - p);
+    q = 1.0 - r;
+    flip = p > 0.5;
+    inversion = n*r < 30.0;
+    s = r/q;
+    a = (n + 1.0)*s;
+    if (inversion) {
+      r0 = std::pow(q, n);
+      return;
+    }
+    double fm = n*r + r;
+    m = std::floor(fm);
+    nrq = n*r*q;
+    p1 = std::floor(2.195*std::sqrt(nrq) - 4.6*q) + 0.5;
+    xm = m + 0.5;
+    xl = xm - p1;
+    xr = xm + p1;
+    c = 0.134 + 20.5/(15.3 + m);
+    double al = (fm - xl)/(fm - xl*r);
+    laml = al*(1.0 + al/2.0);
+    double ar = (xr - fm)/(xr*q);
+    lamr = ar*(1.0 + ar/2.0);
+    p2 = p1*(1.0 + 2.0*c);
+    p3 = p2 + c/laml;
+    p4 = p3 + c/lamr;
+  }
+
+  inline bool same(double nn, double pp) const {
+    return n == nn && p == pp;
+  }
+
+  // n is a non-negative integer and 0 < p < 1
+  inline double draw() const {
+    double x = inversion ? draw_inversion() : draw_btpe();
+    return flip ? n - x : x;
+  }
+
+};
+
+inline double native_binom(double n, double p) {
+
+  if (n == 0.0 || p == 0.0)
+    return 0.0;
+  if (p == 1.0)
+    return n;
+
+  static thread_local BinomSampler last;
+  if (!last.same(n, p))
+    last = BinomSampler(n, p);
+  return last.draw();
+}
+
+
+// Inversion by sequential search starting from the mode
+
+inline double native_hyper(double nr, double nb, double n) {
+
+  double lo = std::max(0.0, n - nb);
+  double hi = std::min(n, nr);
+  double mode = std::floor((n + 1.0)*(nr + 1.0)/(nr + nb + 2.0));
+  mode = std::min(std::max(mode, lo), hi);
+
+  double fm = std::exp(lchoose_fn(nr, mode) + lchoose_fn(nb, n - mode) -
+                       lchoose_fn(nr + nb, n));
+
+  for (;;) {
+    double u = rng_unif() - fm;
+    if (u <= 0.0)
+      return mode;
+
+    double down = mode, up = mode;
+    double fd = fm, fu = fm;
+
+    while (down > lo || up < hi) {
+      if (down > lo) {
+        fd *= down*(nb - n + down) / ((nr - down + 1.0)*(n - down + 1.0));
+        down -= 1.0;
+        u -= fd;
+        if (u <= 0.0)
+          return down;
+      }
+      if (up < hi) {
+        fu *= (nr - up)*(n - up) / ((up + 1.0)*(nb - n + up + 1.0));
+        up += 1.0;
+        u -= fu;
+        if (u <= 0.0)
+          return up;
+      }
+    }
+    // only possible due to rounding errors
+  }
+}
+
+
+inline double rng_gamma(double shape, double scale) {
+#ifndef EXTRADISTR_STANDALONE
+  if (rng_stream() == NULL)
+    return R::rgamma(shape, scale);
+#endif
+  if (ISNAN(shape) || ISNAN(scale))
+    return NAN;
+  if (shape <= 0.0 || scale <= 0.0) {
+    if (scale == 0.0 || shape == 0.0)
+      return 0.0;
+    return NAN;
+  }
+  if (!R_FINITE(shape) || !R_FINITE(scale))
+    return R_PosInf;
+  return native_gamma(shape) * scale;
+}
+
+inline double rng_log_gamma(double shape) {
+  if (ISNAN(shape))
+    return shape;
+  if (shape <= 0.0)
+    return (shape == 0.0) ? R_NegInf : NAN;
+  if (!R_FINITE(shape))
+    return R_PosInf;
+  return GammaSampler(shape).log_draw();
+}
+
+inline double rng_beta(double a, double b) {
+#ifndef EXTRADISTR_STANDALONE
+  if (rng_stream() == NULL)
+    return R::rbeta(a, b);
+#endif
+  if (ISNAN(a) || ISNAN(b) || a < 0.0 || b < 0.0)
+    return NAN;
+  if (!R_FINITE(a) && !R_FINITE(b))
+    return 0.5;
+  if (a == 0.0 && b == 0.0)
+    return (rng_unif() < 0.5) ? 0.0 : 1.0;
+  if (!R_FINITE(a) || b == 0.0)
+    return 1.0;
+  if (!R_FINITE(b) || a == 0.0)
+    return 0.0;
+  return native_beta(a, b);
+}
+
+inline double rng_pois(double lambda) {
+#ifndef EXTRADISTR_STANDALONE
+  if (rng_stream() == NULL)
+    return R::rpois(lambda);
+#endif
+  if (!R_FINITE(lambda) || lambda < 0.0)
+    return NAN;
+  if (lambda == 0.0)
+    return 0.0;
+  return native_pois(lambda);
+}
+
+inline double rng_binom(double n, double p) {
+#ifndef EXTRADISTR_STANDALONE
+  if (rng_stream() == NULL)
+    return R::rbinom(n, p);
+#endif
+  if (!R_FINITE(n) || !R_FINITE(p))
+    return NAN;
+  double r = std::nearbyint(n);
+  if (r != n || r < 0.0 || p < 0.0 || p > 1.0)
+    return NAN;
+  return native_binom(r, p);
+}
+
+// Binomial variables with fixed parameters, e.g. the first conditional
+// binomial of a multinomial sample (see cpp_rmnom). With the native
+// sampler the BTPE setup is done once, when the object is created, rather
+// than each time the parameters differ from the previous draw of the
+// thread. The values are the same as from rng_binom(n, p).
+
+class BinomFrozen {
+
+  double n, p;
+  bool trivial;         // invalid, or n == 0, p == 0 or p == 1
+  BinomSampler sampler;
+
+public:
+
+  BinomFrozen() : n(NAN), p(NAN), trivial(true) {}
+
+  BinomFrozen(double n, double p) : n(n), p(p) {
+    trivial = !R_FINITE(n) || !R_FINITE(p) || std::nearbyint(n) != n ||
+              n <= 0.0 || p <= 0.0 || p >= 1.0;
+    if (!trivial)
+      sampler = BinomSampler(n, p);
+  }
+
+  inline double rng() const {
+    if (trivial)
+      return rng_binom(n, p);
+#ifndef EXTRADISTR_STANDALONE
+    if (rng_stream() == NULL)
+      return R::rbinom(n, p);
+#endif
+    return sampler.draw();
+  }
+
+};
+
+inline double rng_nbinom(double size, double prob) {
+#ifndef EXTRADISTR_STANDALONE
+  if (rng_stream() == NULL)
+    return R::rnbinom(size, prob);
+#endif
+  if (!R_FINITE(prob) || ISNAN(size) || size <= 0.0 ||
+      prob <= 0.0 || prob > 1.0)
+    return NAN;
+  if (!R_FINITE(size))
+    size = std::numeric_limits<double>::max() / 2.0;
+  if (prob == 1.0)
+    return 0.0;
+  return rng_pois(rng_gamma(size, (1.0 - prob)/prob));
+}
+
+inline double rng_geom(double p) {
+#ifndef EXTRADISTR_STANDALONE
+  if (rng_stream() == NULL)
+    return R::rgeom(p);
+#endif
+  if (!R_FINITE(p) || p <= 0.0 || p > 1.0)
+    return NAN;
+  return rng_pois(rng_gamma(1.0, (1.0 - p)/p));
+}
+
+inline double rng_hyper(double nr, double nb, double n) {
+#ifndef EXTRADISTR_STANDALONE
+  if (rng_stream() == NULL)
+    return R::rhyper(nr, nb, n);
+#endif
+  if (!R_FINITE(nr) || !R_FINITE(nb) || !R_FINITE(n))
+    return NAN;
+  nr = std::nearbyint(nr);
+  nb = std::nearbyint(nb);
+  n = std::nearbyint(n);
+  if (nr < 0.0 || nb < 0.0 || n < 0.0 || n > nr + nb)
+    return NAN;
+  return native_hyper(nr, nb, n);
+}
+
+inline double rng_t(double df) {
+#ifndef EXTRADISTR_STANDALONE
+  if (rng_stream() == NULL)
+    return R::rt(df);
+#endif
+  if (ISNAN(df) || df <= 0.0)
+    return NAN;
+  if (!R_FINITE(df))
+    return rng_norm();
+  double z = rng_norm();
+  return z / std::sqrt(rng_gamma(df/2.0, 2.0) / df);
+}
+
+}
+
+
+#endif
@@ -0,0 +1,195 @@
+#ifndef EXTRADISTR_SHARED_H
+#define EXTRADISTR_SHARED_H
+
+#ifdef EXTRADISTR_STANDALONE
+#include "standalone.h"
+#else
+#ifndef STRICT_R_HEADERS
+#define STRICT_R_HEADERS
+#endif
+#include <Rcpp.h>
+#endif
+
+#include <cstdio>
+#include "rng.h"
+#include "native_math.h"
+
+#define VALID_PROB(p)   ((p >= 0.0) && (p <= 1.0))
+
+namespace extraDistr {
+
+// Constants
+
+static const double SQRT_2_PI    = 2.506628274631000241612;  // sqrt(2*pi)
+static const double PHI_0        = 0.3989422804014327028632; // dnorm(0)
+static const double LOG_2F       = 0.6931471805599452862268; // log(2)
+
+static const double MIN_DIFF_EPS = 1e-8;
+
+// Warnings raised from inside the kernels go through kernel_warning(),
+// by default it calls Rcpp::warning() (without R the warnings are dropped),
+// the package replaces the handler while running multithreaded loops
+// (see src/parallel.cpp)
+
+typedef void (*warning_handler_t)(const char* msg);
+
+inline warning_handler_t& kernel_warning_handler() {
+  static warning_handler_t handler = NULL;
+  return handler;
+}
+
+inline void kernel_warning(const char* msg) {
+  warning_handler_t handler = kernel_warning_handler();
+  if (handler != NULL) {
+    handler(msg);
+    return;
+  }
+#ifndef EXTRADISTR_STANDALONE
+  Rcpp::warning(msg);
+#endif
+}
+
+// Errors that cannot be reported by returning NaN
+
+inline void kernel_error(const char* msg) {
+#ifdef EXTRADISTR_STANDALONE
+  throw std::domain_error(msg);
+#else
+  Rcpp::stop(msg);
+#endif
+}
+
+// Samplers of the standard normal and exponential distributions used
+// by rng_norm() and rng_exp():
+//
+// NORM_INVERSION  R's norm_rand() and exp_rand() with R's generator (so the
+//                 values are the same as from rnorm() and rexp()),
+//                 inversion of the uniforms with the Philox streams
+// NORM_ZIGGURAT   ziggurat method (Marsaglia and Tsang, 2000, in the
+//                 variant of Doornik, 2005), with either generator
+
+enum norm_kind_t { NORM_INVERSION = 0, NORM_ZIGGURAT = 1 };
+
+inline int& rng_norm_kind() {
+  static int kind = NORM_INVERSION;
+  return kind;
+}
+
+// functions
+
+inline bool isInteger(double x, bool warn = true);
+inline double rng_unif();         // standard uniform
+inline double rng_norm();         // standard normal
+inline double rng_exp();          // standard exponential
+inline double rng_unif_byte(int& byte);  // uniform and 8 random bits
+inline double rng_norm_zig();     // ziggurat samplers (see ziggurat.h)
+inline double rng_exp_zig();
+
+// samplers, same as R::rgamma, R::rbeta, etc. (see samplers.h)
+
+inline double rng_gamma(double shape, double scale);
+inline double rng_log_gamma(double shape);  // log of Gamma(shape, 1)
+inline double rng_beta(double a, double b);
+inline double rng_pois(double lambda);
+inline double rng_binom(double n, double p);
+inline double rng_nbinom(double size, double prob);
+inline double rng_geom(double p);
+inline double rng_hyper(double nr, double nb, double n);
+inline double rng_t(double df);
+
+// special functions, by default R's math library is used, when compiled
+// with -DEDCPP_NATIVE_MATH the native implementations from native_math.h
+
+inline bool tol_equal(double x, double y);
+inline double phi(double x);
+inline double lphi(double x);
+inline double Phi(double x);
+inline double InvPhi(double x);
+inline double lPhi(double x);
+inline double InvPhiLog(double lp);
+inline double factorial(double x);
+inline double lfactorial(double x);
+inline double lgamma_fn(double x);
+inline double lbeta_fn(double a, double b);
+inline double lchoose_fn(double n, double k);
+inline double bessel_i_fn(double x, double nu, double expo);
+inline double rng_sign();
+inline double rng_unif(double a, double b);
+inline double rng_norm(double mu, double sigma);
+inline bool is_large_int(double x); 
+inline double to_dbl(int x);
+inline int to_pos_int(double x);
+inline double trunc_p(double x);
+inline double log_add_exp(double x, double y);
+inline double log_sub_exp(double x, double y);
+
+
+inline bool isInteger(double x, bool warn) {
+  if (ISNAN(x))
+    return false;
+  if (((x < 0.0) ? std::ceil(x) : std::floor(x)) != x) {
+    if (warn) {
+      char msg[55];
+      std::snprintf(msg, sizeof(msg), "non-integer: %f", x);
+      kernel_warning(msg);
+    }
+    return false;
+  }
+  return true;
+}
+
+inline double rng_unif() {
+#ifndef EXTRADISTR_STANDALONE
+  if (rng_stream() == NULL) {
+    double u;
+    // same as in base R
+    do {
+      u = R::unif_rand();
+    } while (u <= 0.0 || u >= 1.0);
+    return u;
+  }
+#endif
+  return rng_stream()->unif();
+}
+
+// R's uniforms have 32 random bits, too few to take the byte from the
+// same draw, so with R's generator these are two draws
+
+inline double rng_unif_byte(int& byte) {
+#ifndef EXTRADISTR_STANDALONE
+  if (rng_stream() == NULL) {
+    byte = static_cast<int>(R::unif_rand() * 256.0) & 0xFF;
+    return rng_unif();
+  }
+#endif
+  return rng_stream()->unif_byte(byte);
+}
+
+inline double rng_norm() {
+  if (rng_norm_kind() == NORM_ZIGGURAT)
+    return rng_norm_zig();
+#ifndef EXTRADISTR_STANDALONE
+  if (rng_stream() == NULL)
+    return R::norm_rand();
+#endif
+  return InvPhi(rng_stream()->unif());
+}
+
+inline double rng_exp() {
+  if (rng_norm_kind() == NORM_ZIGGURAT)
+    return rng_exp_zig();
+#ifndef EXTRADISTR_STANDALONE
+  if (rng_stream() == NULL)
+    return R::exp_rand();
+#endif
+  return -std::log(rng_stream()->unif());
+}
+
+}
+
+#include "shared_inline.h"
+#include "ziggurat.h"
+#include "samplers.h"
+
+
+#endif
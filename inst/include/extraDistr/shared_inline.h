@@ -0,0 +1,265 @@
+
+#ifndef EXTRADISTR_SHARED_INLINE_H
+#define EXTRADISTR_SHARED_INLINE_H
+
+#include "shared.h"
+#include <utility>
+
+namespace extraDistr {
+
+inline bool tol_equal(double x, double y) {
+  return std::abs(x - y) < MIN_DIFF_EPS;
+}
+
+inline double phi(double x) {
+#ifdef EDCPP_NATIVE_MATH
+  return native::dnorm(x);
+#else
+  return R::dnorm(x, 0.0, 1.0, false);
+#endif
+}
+
+inline double lphi(double x) {
+#ifdef EDCPP_NATIVE_MATH
+  return native::ldnorm(x);
+#else
+  return R::dnorm(x, 0.0, 1.0, true);
+#endif
+}
+
+inline double Phi(double x) {
+#ifdef EDCPP_NATIVE_MATH
+  return native::pnorm(x);
+#else
+  return R::pnorm(x, 0.0, 1.0, true, false);
+#endif
+}
+
+inline double InvPhi(double x) {
+#ifdef EDCPP_NATIVE_MATH
+  return native::qnorm(x);
+#else
+  return R::qnorm(x, 0.0, 1.0, true, false);
+#endif
+}
+
+// log(Phi(x)), accurate also far in the lower tail
+inline double lPhi(double x) {
+#ifdef EDCPP_NATIVE_MATH
+  return native::lpnorm(x);
+#else
+  return R::pnorm(x, 0.0, 1.0, true, true);
+#endif
+}
+
+// inverse of lPhi()
+inline double InvPhiLog(double lp) {
+#ifdef EDCPP_NATIVE_MATH
+  return native::qnorm_log(lp);
+#else
+  return R::qnorm(lp, 0.0, 1.0, true, true);
+#endif
+}
+
+inline double factorial(double x) {
+#ifdef EDCPP_NATIVE_MATH
+  return native::gamma(x + 1.0);
+#else
+  return R::gammafn(x + 1.0);
+#endif
+}
+
+inline double lfactorial(double x) {
+  return lgamma_fn(x + 1.0);
+}
+
+inline double lgamma_fn(double x) {
+#ifdef EDCPP_NATIVE_MATH
+  return native::lgamma(x);
+#else
+  return R::lgammafn(x);
+#endif
+}
+
+inline double lbeta_fn(double a, double b) {
+#ifdef EDCPP_NATIVE_MATH
+  return native::lbeta(a, b);
+#else
+  return R::lbeta(a, b);
+#endif
+}
+
+inline double lchoose_fn(double n, double k) {
+#ifdef EDCPP_NATIVE_MATH
+  return native::lchoose(n, k);
+#else
+  return R::lchoose(n, k);
+#endif
+}
+
+inline double bessel_i_fn(double x, double nu, double expo) {
+#ifdef EDCPP_NATIVE_MATH
+  return native::bessel_i(x, nu, expo);
+#else
+  return R::bessel_i(x, nu, expo);
+#endif
+}
+
+inline double rng_sign() {
+  double u = rng_unif();
+  return (u > 0.5) ? 1.0 : -1.0;
+}
+
+// same as R::runif(a, b)
+inline double rng_unif(double a, double b) {
+  if (!R_FINITE(a) || !R_FINITE(b) || b < a)
+    return NAN;
+  if (a == b)
+    return a;
+  return a + (b - a) * rng_unif();
+}
+
+// same as R::rnorm(mu, sigma)
+inline double rng_norm(double mu, double sigma) {
+  if (ISNAN(mu) || !R_FINITE(sigma) || sigma < 0.0)
+    return NAN;
+  if (sigma == 0.0 || !R_FINITE(mu))
+    return mu;
+  return mu + sigma * rng_norm();
+}
+
+inline bool is_large_int(double x) {
+  if (x > std::numeric_limits<int>::max())
+    return true;
+  return false;
+}
+
+inline double to_dbl(int x) {
+  return static_cast<double>(x);
+}
+
+inline int to_pos_int(double x) {
+  if (x < 0.0 || ISNAN(x))
+    kernel_error("value cannot be coerced to integer");
+  if (is_large_int(x))
+    kernel_error("value out of integer range");
+  return static_cast<int>(x);
+}
+
+inline double trunc_p(double x) {
+  return x < 0.0 ? 0.0 : (x > 1.0 ? 1.0 : x); 
+}
+
+// log(exp(x) + exp(y))
+inline double log_add_exp(double x, double y) {
+  if (x < y)
+    std::swap(x, y);
+  if (y == R_NegInf)
+    return x;
+  return x + log1p(std::exp(y - x));
+}
+
+// log(exp(x) - exp(y)) for x >= y
+inline double log_sub_exp(double x, double y) {
+  if (y == R_NegInf)
+    return x;
+  double d = y - x;
+  return x + ((d > -LOG_2F) ? std::log(-std::expm1(d)) : log1p(-std::exp(d)));
+}
+
+// Smallest integer x in [lower, upper] such that cdf(x) >= p, where cdf
+// is non-decreasing and cdf(upper) = 1 > p. Starting from the guess x0,
+// steps of doubling length outwards bracket the quantile, then it is
+// found by bisection, so it takes O(log |x - x0|) evaluations of cdf.
+// Above 2^53 not all the integers are representable, the bisection then
+// stops at the smallest representable value found to have cdf(x) >= p.
+
+template <typename Cdf>
+inline double discrete_quantile(double p, double x0, double lower,
+                                double upper, Cdf cdf) {
+  
+  double lo, hi, step = 1.0;
+  
+  x0 = std::floor(x0);
+  if (ISNAN(x0) || x0 < lower)
+    x0 = lower;
+  if (x0 > upper)
+    x0 = upper;
+  
+  // invariant: cdf(lo) < p <= cdf(hi), lo = lower-1 is below the support
+  
+  if (cdf(x0) >= p) {
+    hi = x0;
+    for (;;) {
+      double x = hi - step;
+      if (x < lower) {
+        lo = lower - 1.0;
+        break;
+      }
+      if (cdf(x) >= p) {
+        hi = x;
+        step *= 2.0;
+      } else {
+        lo = x;
+        break;
+      }
+    }
+  } else {
+    lo = x0;
+    for (;;) {
+      double x = lo + step;
+      if (!R_FINITE(x))
+        return R_PosInf;
+      if (x >= upper) {
+        hi = upper;
+        break;
+      }
+      if (cdf(x) >= p) {
+        hi = x;
+        break;
+      } else {
+        lo = x;
+        step *= 2.0;
+      }
+    }
+  }
+  
+  while (hi - lo > 1.0) {
+    double mid = std::floor(lo + (hi - lo) / 2.0);
+    if (mid <= lo || mid >= hi)
+      break;
+    if (cdf(mid) >= p)
+      hi = mid;
+    else
+      lo = mid;
+  }
+  
+  return hi;
+}
+
+// Rejection sampling for a discrete distribution on x0, x0+dir, x0+2*dir,
+// ..., up to limit (dir is 1 or -1), whose probabilities decrease at least
+// as fast as r^k moving away from x0, where log_r = log(r) < 0. The
+// envelope is the geometric distribution, so each value is accepted with
+// probability of at least 1-r.
+
+template <typename LogPmf>
+inline double rng_geometric_envelope(double x0, double dir, double limit,
+                                     double log_r, LogPmf logpmf) {
+  if (log_r == R_NegInf)
+    return x0;
+  double lf0 = logpmf(x0);
+  for (;;) {
+    double k = std::floor(std::log(rng_unif()) / log_r);
+    double x = x0 + dir * k;
+    if (dir * (x - limit) > 0.0)
+      continue;
+    if (std::log(rng_unif()) <= logpmf(x) - lf0 - k * log_r)
+      return x;
+  }
+}
+
+}
+
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef EXTRADISTR_SHIFTED_GOMPERTZ_DISTRIBUTION_H
+#define EXTRADISTR_SHIFTED_GOMPERTZ_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+*  Gompertz distribution
+*
+*  Values:
+*  x >= 0
+*
+*  Parameters:
+*  b > 0
+*  eta > 0
+*
+*  f(x)    = b*std::exp(-b*x) * std::exp(-eta*std::exp(-b*x)) * (1 + eta*(1 - std::exp(-b*x)))
+*  F(x)    = (1-std::exp(-b*x)) * std::exp(-eta*std::exp(-b*x))
+*
+* References:
+*
+* Bemmaor, A.C. (1994).
+* Modeling the Diffusion of New Durable Goods: Word-of-Mouth Effect Versus Consumer Heterogeneity.
+* [In:] G. Laurent, G.L. Lilien & B. Pras. Research Traditions in Marketing.
+* Boston: Kluwer Academic Publishers. pp. 201-223.
+* 
+* Jimenez, T.F., Jodra, P. (2009).
+* A Note on the Moments and Computer Generation of the Shifted Gompertz Distribution.
+* Communications in Statistics - Theory and Methods, 38(1), 78-89.
+* 
+* Jimenez T.F. (2014).
+* Estimation of the Parameters of the Shifted Gompertz Distribution,
+* Using Least Squares, Maximum Likelihood and Moments Methods.
+* Journal of Computational and Applied Mathematics, 255(1), 867-877.
+*
+*/
+
+
+inline double logpdf_sgomp(double x, double b, double eta,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(b) || ISNAN(eta))
+    return x+b+eta;
+#endif
+  if (b <= 0.0 || eta <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0 || !R_FINITE(x))
+    return R_NegInf;
+  double ebx = std::exp(-b*x);
+  // b*ebx * exp(-eta*ebx) * (1+eta*(1-ebx));
+  return std::log(b) + std::log(ebx) - eta*ebx + log1p(eta*(1-ebx));
+}
+
+inline double cdf_sgomp(double x, double b, double eta,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(b) || ISNAN(eta))
+    return x+b+eta;
+#endif
+  if (b <= 0.0 || eta <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0)
+    return 0.0;
+  if (x == R_PosInf)
+    return 1.0;
+  double ebx = std::exp(-b*x);
+  // (1-ebx) * exp(-eta*ebx)
+  return std::exp(log1p(-ebx) - eta*ebx);
+}
+
+inline double rng_sgomp(double b, double eta, bool& throw_warning) {
+  if (ISNAN(b) || ISNAN(eta) || b <= 0.0 || eta <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double u, v, rg, re;
+  u = rng_exp(); // -log(rng_unif())
+  v = rng_exp(); // -log(rng_unif())
+  rg = -std::log(u/eta) / b;
+  re = v / b;
+  return (rg>re) ? rg : re;
+}
+
+}
+
+
+#endif
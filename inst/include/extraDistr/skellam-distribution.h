@@ -0,0 +1,45 @@
+#ifndef EXTRADISTR_SKELLAM_DISTRIBUTION_H
+#define EXTRADISTR_SKELLAM_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+ * Skellam distribution
+ * 
+ * mu1 >= 0
+ * mu2 >= 0
+ * 
+ */
+
+inline double pmf_skellam(double x, double mu1, double mu2,
+                          bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu1) || ISNAN(mu2))
+    return x+mu1+mu2;
+#endif
+  if (mu1 < 0.0 || mu2 < 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (!isInteger(x) || !R_FINITE(x))
+    return 0.0;
+  return std::exp(-(mu1+mu2)) * std::pow(mu1/mu2, x/2.0) *
+    bessel_i_fn(2.0*std::sqrt(mu1*mu2), x, 1.0);
+}
+
+inline double rng_skellam(double mu1, double mu2,
+                          bool& throw_warning) {
+  if (ISNAN(mu1) || ISNAN(mu2) || mu1 < 0.0 || mu2 < 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  return rng_pois(mu1) - rng_pois(mu2);
+}
+
+}
+
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef EXTRADISTR_SLASH_DISTRIBUTION_H
+#define EXTRADISTR_SLASH_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+ * Location-scale slash distribution
+ * 
+ * Parameters:
+ * mu
+ * sigma > 0
+ * 
+ * 
+ */
+
+
+inline double pdf_slash(double x, double mu, double sigma,
+                        bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
+    return x+mu+sigma;
+#endif
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  double z = (x - mu)/sigma;
+  if (z == 0.0)
+    return 0.19947114020071635; // 1.0/(2.0 * SQRT_2_PI);
+  return ((PHI_0 - phi(z))/(z*z))/sigma;
+}
+
+inline double cdf_slash(double x, double mu, double sigma,
+                        bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
+    return x+mu+sigma;
+#endif
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  double z = (x - mu)/sigma;
+  if (z == 0.0)
+    return 0.5;
+  return Phi(z) - (PHI_0 - phi(z))/z;
+}
+
+inline double rng_slash(double mu, double sigma,
+                        bool& throw_warning) {
+  if (ISNAN(mu) || ISNAN(sigma) || sigma <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double z = rng_norm();
+  double u = rng_unif();
+  return z/u*sigma + mu;
+}
+
+}
+
+
+#endif
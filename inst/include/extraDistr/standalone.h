@@ -0,0 +1,40 @@
+#ifndef EXTRADISTR_STANDALONE_H
+#define EXTRADISTR_STANDALONE_H
+
+/*
+ * Definitions otherwise coming from R's headers, used when the kernels
+ * are compiled without R (with -DEXTRADISTR_STANDALONE, see the CMake
+ * build in the top-level directory of the package sources)
+ *
+ */
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#ifndef IEEE_754
+#define IEEE_754 1
+#endif
+
+#define ISNAN(x)      (std::isnan(x))
+#define R_FINITE(x)   (std::isfinite(x))
+#define R_PosInf      (std::numeric_limits<double>::infinity())
+#define R_NegInf      (-std::numeric_limits<double>::infinity())
+#define NA_REAL       (std::numeric_limits<double>::quiet_NaN())
+
+#ifndef M_PI
+#define M_PI          3.141592653589793238462643383280
+#endif
+
+#ifndef M_E
+#define M_E           2.718281828459045235360287471353
+#endif
+
+// the special functions come from native_math.h
+
+#ifndef EDCPP_NATIVE_MATH
+#define EDCPP_NATIVE_MATH
+#endif
+
+
+#endif
@@ -0,0 +1,110 @@
+#ifndef EXTRADISTR_TRIANGULAR_DISTRIBUTION_H
+#define EXTRADISTR_TRIANGULAR_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+*  Triangular distribution
+*
+*  Values:
+*  x
+*
+*  Parameters:
+*  a
+*  b > a
+*  a <= c <= b
+*
+*  f(x)    = { (2*(x-a)) / ((b-a)*(c-a))  x < c
+*            { 2/(b-a)                    x = c
+*            { (2*(b-x)) / ((b-a)*(b-c))  x > c
+*  F(x)    = { (x-a)^2 / ((b-a)*(c-a))
+*            { 1 - ((b-x)^2 / ((b-a)*(b-c)))
+*  F^-1(p) = { a + std::sqrt(p*(b-a)*(c-a))    p < (c-a)/(b-a)
+*            { b - std::sqrt((1-p)*(b-a)*(b-c));
+*/
+
+inline double logpdf_triangular(double x, double a, double b,
+                                double c, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(a) || ISNAN(b) || ISNAN(c))
+    return x+a+b+c;
+#endif
+  if (a > c || c > b || a == b) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < a || x > b) {
+    return R_NegInf;
+  } else if (x < c) {
+    // 2.0*(x-a) / ((b-a)*(c-a));
+    return LOG_2F + std::log(x-a) - std::log(b-a) - std::log(c-a);
+  } else if (x > c) {
+    // 2.0*(b-x) / ((b-a)*(b-c));
+    return LOG_2F + std::log(b-x) - std::log(b-a) - std::log(b-c);
+  } else {
+    // 2.0/(b-a);
+    return LOG_2F - std::log(b-a);
+  }
+}
+
+inline double cdf_triangular(double x, double a, double b,
+                             double c, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(a) || ISNAN(b) || ISNAN(c))
+    return x+a+b+c;
+#endif
+  if (a > c || c > b || a == b) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < a) {
+    return 0.0;
+  } else if (x >= b) {
+    return 1.0;
+  } else if (x <= c) {
+    // ((x-a)*(x-a)) / ((b-a)*(c-a));
+    return std::exp( std::log(x-a) * 2.0 - std::log(b-a) - std::log(c-a) );
+  } else {
+    // 1.0 - (((b-x)*(b-x)) / ((b-a)*(b-c)));
+    return 1.0 - std::exp( std::log(b-x) * 2.0 - std::log(b-a) - std::log(b-c) );
+  }
+}
+
+inline double invcdf_triangular(double p, double a, double b,
+                                double c, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(a) || ISNAN(b) || ISNAN(c))
+    return p+a+b+c;
+#endif
+  if (a > c || c > b || a == b || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  double fc = (c-a)/(b-a);
+  if (p < fc)
+    return a + std::sqrt(p*(b-a)*(c-a));
+  return b - std::sqrt((1.0-p)*(b-a)*(b-c));
+}
+
+inline double rng_triangular(double a, double b, double c,
+                             bool& throw_warning) {
+  if (ISNAN(a) || ISNAN(b) || ISNAN(c) ||
+      a > c || c > b || a == b) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double u, v, r, cc;
+  r = b - a;
+  cc = (c-a)/r;
+  u = rng_unif();
+  v = rng_unif();
+  return ((1.0-cc) * std::min(u, v) + cc * std::max(u, v)) * r + a;
+}
+
+}
+
+
+#endif
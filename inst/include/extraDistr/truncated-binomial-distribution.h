@@ -0,0 +1,170 @@
+#ifndef EXTRADISTR_TRUNCATED_BINOMIAL_DISTRIBUTION_H
+#define EXTRADISTR_TRUNCATED_BINOMIAL_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+ * As for the truncated Poisson distribution, the probabilities of the
+ * window a < x <= b are computed in log scale, from the upper tail when
+ * the window lies above the mean, and the windows far in the tails are
+ * sampled by rejection from the geometric envelope.
+ *
+ */
+
+inline double tbinom_log_mass(double size, double prob, double a, double b) {
+  if (a >= size * prob)
+    return log_sub_exp(R::pbinom(a, size, prob, false, true),
+                       R::pbinom(b, size, prob, false, true));
+  return log_sub_exp(R::pbinom(b, size, prob, true, true),
+                     R::pbinom(a, size, prob, true, true));
+}
+
+inline double tbinom_quantile(double p, double size, double prob,
+                              double a, double b, double log_mass) {
+  double lo = std::max(std::floor(a) + 1.0, 0.0);
+  double hi = std::min(std::floor(b), size);
+  if (a >= size * prob) {
+    double lqa = R::pbinom(a, size, prob, false, true);
+    return discrete_quantile(p, lo, lo, hi, [&](double x) {
+      return std::exp(log_sub_exp(lqa, R::pbinom(x, size, prob, false, true)) -
+                      log_mass);
+    });
+  }
+  if (b <= size * prob) {
+    double lpa = R::pbinom(a, size, prob, true, true);
+    return discrete_quantile(p, hi, lo, hi, [&](double x) {
+      return std::exp(log_sub_exp(R::pbinom(x, size, prob, true, true), lpa) -
+                      log_mass);
+    });
+  }
+  double pa = R::pbinom(a, size, prob, true, false);
+  double x = R::qbinom(pa + p * std::exp(log_mass), size, prob, true, false);
+  return std::min(std::max(x, lo), hi);
+}
+
+inline double logpdf_tbinom(double x, double size, double prob, double a,
+                            double b, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(size) || ISNAN(prob) || ISNAN(a) || ISNAN(b))
+    return x+size+prob+a+b;
+#endif
+  if (size < 0.0 || !VALID_PROB(prob) || b < a || !isInteger(size, false)) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  if (!isInteger(x) || x < 0.0 || x <= a || x > b || x > size)
+    return R_NegInf;
+  
+  return R::dbinom(x, size, prob, true) - tbinom_log_mass(size, prob, a, b);
+}
+
+inline double cdf_tbinom(double x, double size, double prob, double a,
+                         double b, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(size) || ISNAN(prob) || ISNAN(a) || ISNAN(b))
+    return x+size+prob+a+b;
+#endif
+  if (size < 0.0 || !VALID_PROB(prob) || b < a ||
+      !isInteger(size, false)) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  if (x < 0.0 || x <= a)
+    return 0.0;
+  if (x > b || x >= size)
+    return 1.0;
+  
+  double lp;
+  
+  if (a >= size * prob) {
+    lp = log_sub_exp(R::pbinom(a, size, prob, false, true),
+                     R::pbinom(x, size, prob, false, true));
+  } else {
+    lp = log_sub_exp(R::pbinom(x, size, prob, true, true),
+                     R::pbinom(a, size, prob, true, true));
+  }
+  
+  return std::exp(lp - tbinom_log_mass(size, prob, a, b));
+}
+
+inline double invcdf_tbinom(double p, double size, double prob,
+                            double a, double b, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(size) || ISNAN(prob) || ISNAN(a) || ISNAN(b))
+    return p+size+prob+a+b;
+#endif
+  if (size < 0.0 || !VALID_PROB(prob) || b < a ||
+      !isInteger(size, false) || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  if (p == 0.0)
+    return std::max(a, 0.0);
+  if (p == 1.0)
+    return std::min(size, b);
+  
+  double log_mass = tbinom_log_mass(size, prob, a, b);
+  
+  if (log_mass == R_NegInf) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  return tbinom_quantile(p, size, prob, a, b, log_mass);
+}
+
+inline double rng_tbinom(double size, double prob, double a,
+                         double b, bool& throw_warning) {
+  if (ISNAN(size) || ISNAN(prob) || ISNAN(a) || ISNAN(b) ||
+      size < 0.0 || !VALID_PROB(prob) || b < a ||
+      !isInteger(size, false)) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  
+  double log_mass = tbinom_log_mass(size, prob, a, b);
+  
+  if (log_mass == R_NegInf) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  
+  if (prob > 0.0 && prob < 1.0) {
+    
+    double lo = std::max(std::floor(a) + 1.0, 0.0);
+    double hi = std::min(std::floor(b), size);
+    double odds = prob / (1.0 - prob);
+    
+    // f(x+1)/f(x) = (size-x)/(x+1) * odds
+    double r = (size - lo) / (lo + 1.0) * odds;
+    if (r <= 0.5) {
+      return rng_geometric_envelope(lo, 1.0, hi, std::log(r),
+                                    [&](double x) {
+        return R::dbinom(x, size, prob, true);
+      });
+    }
+    
+    // f(x-1)/f(x) = x/(size-x+1) / odds
+    r = hi / (size - hi + 1.0) / odds;
+    if (r <= 0.5) {
+      return rng_geometric_envelope(hi, -1.0, lo, std::log(r),
+                                    [&](double x) {
+        return R::dbinom(x, size, prob, true);
+      });
+    }
+    
+  }
+  
+  return tbinom_quantile(rng_unif(), size, prob, a, b, log_mass);
+}
+
+}
+
+
+#endif
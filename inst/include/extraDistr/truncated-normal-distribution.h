@@ -0,0 +1,538 @@
+#ifndef EXTRADISTR_TRUNCATED_NORMAL_DISTRIBUTION_H
+#define EXTRADISTR_TRUNCATED_NORMAL_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+*  Truncated Normal distribution
+*
+*  Values:
+*  x
+*
+*  Parameters:
+*  mu
+*  sigma > 0
+*  a, b
+*
+*  z = (x-mu)/sigma
+*
+*  f(x)    = phi(z) / (Phi((b-mu)/sigma) - Phi((mu-a)/sigma))
+*  F(x)    = (Phi(z) - Phi((mu-a)/sigma)) / (Phi((b-mu)/sigma) - Phi((a-mu)/sigma))
+*  F^-1(p) = Phi^-1(Phi((mu-a)/sigma) + p * (Phi((b-mu)/sigma) - Phi((a-mu)/sigma)))
+*
+*  where phi() is PDF for N(0, 1) and Phi() is CDF for N(0, 1)
+*
+*/
+
+
+/*
+ * For truncation points far in the tails Phi(zb) - Phi(za) cancels, so
+ * the probabilities are computed in log scale, from the lower tail
+ * when za <= 0 and from the upper tail (reflecting the interval to
+ * (-zb, -za)) when 0 < za. lPhi() uses the Mills ratio in the far
+ * tail, so neither side loses precision.
+ *
+ */
+
+// lambda(z) = phi(z)/(1 - Phi(z)) and v(z) = 1 + z*lambda - lambda^2, the
+// mean and variance of N(0, 1) truncated to (z, Inf). For z >= 4 they
+// cancel, so they come from the continued fraction
+//
+//   lambda(z) - z = c_1,  c_k = k/(z + c_{k+1}),  v(z) = (c_2 - c_1)/(z + c_2)
+
+inline void tnorm_upper_moments(double z, double& lambda, double& v) {
+  if (z == R_NegInf) {
+    lambda = 0.0;
+    v = 1.0;
+  } else if (z < 4.0) {
+    lambda = std::exp(lphi(z) - lPhi(-z));
+    v = 1.0 + z*lambda - lambda*lambda;
+  } else {
+    double c1 = 0.0, c2 = 0.0;
+    for (int k = 40; k >= 1; k--) {
+      c2 = c1;
+      c1 = k / (z + c1);
+    }
+    lambda = z + c1;
+    v = (c2 - c1) / (z + c2);
+  }
+}
+
+class TnormTails {
+
+  bool upper;          // interval above the mean, reflected
+  double wa, wb;       // (za, zb) or (-zb, -za) if upper
+  double lPa, lPb;     // lPhi(wa), lPhi(wb)
+
+  // Phi(w) = Phi(wa) + pa * mass = Phi(wb) - pb * mass, given
+  // lpa = log(pa) and lpb = log(pb)
+  inline double lower_quantile(double lpa, double lpb) const {
+    double lp;
+    if (lpa <= -LOG_2F)
+      lp = log_add_exp(lPa, lpa + log_mass);
+    else
+      lp = log_sub_exp(lPb, lpb + log_mass);
+    return std::min(std::max(InvPhiLog(lp), wa), wb);
+  }
+
+public:
+
+  double log_mass;     // log(Phi(zb) - Phi(za))
+
+  TnormTails() : upper(false), wa(NAN), wb(NAN), lPa(NAN), lPb(NAN),
+                 log_mass(NAN) {}
+
+  TnormTails(double za, double zb) : upper(0.0 < za) {
+    wa = upper ? -zb : za;
+    wb = upper ? -za : zb;
+    lPa = lPhi(wa);
+    lPb = lPhi(wb);
+    log_mass = log_sub_exp(lPb, lPa);
+  }
+
+  // log P(za < Z <= z | za < Z < zb), or log P(z < Z < zb | za < Z < zb)
+  // if !lower_tail, for za < z < zb
+  inline double log_cdf(double z, bool lower_tail) const {
+    double lw = lPhi(upper ? -z : z);
+    double lp = (upper == lower_tail) ? log_sub_exp(lPb, lw) :
+                                        log_sub_exp(lw, lPa);
+    return std::min(lp - log_mass, 0.0);
+  }
+
+  // P(za < Z <= z | za < Z < zb) for za < z < zb
+  inline double cdf(double z) const {
+    return std::exp(log_cdf(z, true));
+  }
+
+  // standardized quantile for 0 < p < 1
+  inline double invcdf(double p) const {
+    double lp = std::log(p), lq = std::log(1.0 - p);
+    return upper ? -lower_quantile(lq, lp) : lower_quantile(lp, lq);
+  }
+
+  // standardized quantile for the log-probability -Inf < lp < 0 of the
+  // lower tail, or of the upper tail if !lower_tail
+  inline double log_invcdf(double lp, bool lower_tail) const {
+    double lq = (lp > -LOG_2F) ? std::log(-std::expm1(lp)) : log1p(-std::exp(lp));
+    if (!lower_tail)
+      std::swap(lp, lq);
+    return upper ? -lower_quantile(lq, lp) : lower_quantile(lp, lq);
+  }
+
+  // standardized mean and variance, computed on (ua, ub) = (za, zb) or
+  // (-zb, -za), so that the interval lies in the upper tail, from the
+  // moments of the intervals (ua, Inf) and (ub, Inf) weighted by
+  // r = P(Z > ub)/P(Z > ua); narrow intervals (where these cancel) are
+  // integrated by the 8-point Gauss-Legendre rule
+  inline void moments(double& mean, double& var) const {
+    static const double gl_x[4] = {
+      0.1834346424956498, 0.5255324099163290,
+      0.7966664774136267, 0.9602898564975363
+    };
+    static const double gl_w[4] = {
+      0.3626837833783620, 0.3137066458778873,
+      0.2223810344533745, 0.1012285362903763
+    };
+    double ua = -wb, ub = -wa;
+    double m, v;
+    if ((ub - ua) * std::max(1.0, std::max(std::abs(ua), std::abs(ub))) <= 0.5) {
+      double c = (ua + ub) / 2.0, h = (ub - ua) / 2.0;
+      double z[8], f[8], sf = 0.0;
+      for (int i = 0; i < 4; i++) {
+        z[2*i] = c - h*gl_x[i];
+        z[2*i+1] = c + h*gl_x[i];
+        f[2*i] = gl_w[i] * std::exp((c*c - z[2*i]*z[2*i]) / 2.0);
+        f[2*i+1] = gl_w[i] * std::exp((c*c - z[2*i+1]*z[2*i+1]) / 2.0);
+        sf += f[2*i] + f[2*i+1];
+      }
+      m = 0.0;
+      for (int i = 0; i < 8; i++)
+        m += f[i] * (z[i] - c);
+      m /= sf;
+      v = 0.0;
+      for (int i = 0; i < 8; i++)
+        v += f[i] * (z[i] - c - m) * (z[i] - c - m);
+      v /= sf;
+      m += c;
+    } else {
+      double la, va, lb, vb;
+      double r = std::exp(lPa - lPb);
+      double q = std::exp(log_mass - lPb);    // 1 - r
+      tnorm_upper_moments(ua, la, va);
+      if (r > 0.0) {
+        tnorm_upper_moments(ub, lb, vb);
+        m = (la - r*lb) / q;
+        v = (va - r*vb) / q - r * ((lb - la) / q) * ((lb - la) / q);
+      } else {
+        m = la;
+        v = va;
+      }
+    }
+    mean = upper ? m : -m;
+    var = v;
+  }
+
+};
+
+inline double pdf_tnorm(double x, double mu, double sigma,
+                        double a, double b, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(a) || ISNAN(b))
+    return x+mu+sigma+a+b;
+#endif
+  if (sigma <= 0.0 || b <= a) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  if (a == R_NegInf && b == R_PosInf)
+    return phi((x-mu)/sigma)/sigma;
+  
+  if (x > a && x < b) {
+    TnormTails tails((a-mu)/sigma, (b-mu)/sigma);
+    return std::exp(lphi((x-mu)/sigma) - tails.log_mass) / sigma;
+  } else {
+    return 0.0;
+  }
+}
+
+inline double cdf_tnorm(double x, double mu, double sigma,
+                        double a, double b, bool lower_tail, bool log_p,
+                        bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(a) || ISNAN(b))
+    return x+mu+sigma+a+b;
+#endif
+  if (sigma <= 0.0 || b <= a) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  if (a == R_NegInf && b == R_PosInf) {
+    double z = lower_tail ? (x-mu)/sigma : (mu-x)/sigma;
+    return log_p ? lPhi(z) : Phi(z);
+  }
+  
+  double lp;
+  if (x > a && x < b) {
+    TnormTails tails((a-mu)/sigma, (b-mu)/sigma);
+    lp = tails.log_cdf((x-mu)/sigma, lower_tail);
+  } else {
+    lp = ((x >= b) == lower_tail) ? 0.0 : R_NegInf;
+  }
+  return log_p ? lp : std::exp(lp);
+}
+
+inline double invcdf_tnorm(double p, double mu, double sigma,
+                           double a, double b, bool lower_tail, bool log_p,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma) || ISNAN(a) || ISNAN(b))
+    return p+mu+sigma+a+b;
+#endif
+  if (sigma <= 0.0 || b <= a || (log_p ? p > 0.0 : !VALID_PROB(p))) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  if (a == R_NegInf && b == R_PosInf) {
+    double z = log_p ? InvPhiLog(p) : InvPhi(p);
+    return (lower_tail ? z : -z) * sigma + mu;
+  }
+  
+  double lp = log_p ? p : std::log(p);
+  if (lp == R_NegInf)
+    return lower_tail ? a : b;
+  if (lp == 0.0)
+    return lower_tail ? b : a;
+  
+  TnormTails tails((a-mu)/sigma, (b-mu)/sigma);
+  if (lower_tail && !log_p)
+    return tails.invcdf(p) * sigma + mu;
+  return tails.log_invcdf(lp, lower_tail) * sigma + mu;
+}
+
+// mean, variance and log(P(a < X < b)) of the truncated normal distribution
+
+inline void moments_tnorm(double mu, double sigma, double a, double b,
+                          double& mean, double& var, double& log_prob,
+                          bool& throw_warning) {
+  if (ISNAN(mu) || ISNAN(sigma) || ISNAN(a) || ISNAN(b)) {
+    mean = var = log_prob = mu+sigma+a+b;
+    return;
+  }
+  if (sigma <= 0.0 || b <= a) {
+    throw_warning = true;
+    mean = var = log_prob = NAN;
+    return;
+  }
+  
+  if (a == R_NegInf && b == R_PosInf) {
+    mean = mu;
+    var = sigma*sigma;
+    log_prob = 0.0;
+    return;
+  }
+  
+  double m, v;
+  TnormTails tails((a-mu)/sigma, (b-mu)/sigma);
+  tails.moments(m, v);
+  mean = mu + sigma*m;
+  var = sigma*sigma*v;
+  log_prob = tails.log_mass;
+}
+
+// Sampling regimes of rng_tnorm, they depend only on the standardized
+// truncation points, so they can be chosen once for fixed parameters
+
+enum tnorm_regime_t {
+  TNORM_HALF_UPPER,   // |N(0, 1)|
+  TNORM_HALF_LOWER,   // -|N(0, 1)|
+  TNORM_NORMAL,       // rejection from N(0, 1)
+  TNORM_EXP_UPPER,    // rejection from exponential, upper tail
+  TNORM_EXP_LOWER,    // rejection from exponential, lower tail
+  TNORM_UNIF_UPPER,   // rejection from uniform, 0 < za
+  TNORM_UNIF_LOWER,   // rejection from uniform, zb < 0
+  TNORM_UNIF          // rejection from uniform, za <= 0 <= zb
+};
+
+inline tnorm_regime_t tnorm_regime(double za, double zb, double& aa) {
+  
+  double za_sq = za * za;
+  double zb_sq = zb * zb;
+  aa = 0.0;
+  
+  if (std::abs(za) <= 1e-16 && zb == R_PosInf) {
+    return TNORM_HALF_UPPER;
+  } else if (za == R_PosInf && std::abs(zb) <= 1e-16) {
+    return TNORM_HALF_LOWER;
+  } else if ((za < 0.0 && zb == R_PosInf) ||
+      (za == R_NegInf && zb > 0.0) ||
+      (za != R_PosInf && zb != R_PosInf &&
+       za < 0.0 && zb > 0.0 && zb-za > SQRT_2_PI)) {
+    return TNORM_NORMAL;
+  } else if (za >= 0.0 && (zb > za + 2.0*std::sqrt(M_E) / (za + std::sqrt(za_sq + 4.0))
+                      * std::exp((za*2.0 - za*std::sqrt(za_sq + 4.0)) / 4.0))) {
+    aa = (za + std::sqrt(za_sq + 4.0)) / 2.0;
+    return TNORM_EXP_UPPER;
+  } else if (zb <= 0.0 && (-za > -zb + 2.0*std::sqrt(M_E) / (-zb + std::sqrt(zb_sq + 4.0))
+                          * std::exp((zb*2.0 + zb*std::sqrt(zb_sq + 4.0)) / 4.0))) {
+    aa = (-zb + std::sqrt(zb_sq + 4.0)) / 2.0;
+    return TNORM_EXP_LOWER;
+  } else if (0.0 < za) {
+    return TNORM_UNIF_UPPER;
+  } else if (zb < 0.0) {
+    return TNORM_UNIF_LOWER;
+  }
+  return TNORM_UNIF;
+}
+
+// standardized draw, za and zb are the standardized truncation points,
+// aa comes from tnorm_regime()
+
+inline double tnorm_draw(tnorm_regime_t regime, double za, double zb,
+                         double aa) {
+  
+  double r, u;
+  bool stop = false;
+  
+  switch (regime) {
+  case TNORM_HALF_UPPER:
+    r = rng_norm();
+    if (r < 0.0)
+      r = -r;
+    break;
+  case TNORM_HALF_LOWER:
+    r = rng_norm();
+    if (r > 0.0)
+      r = -r;
+    break;
+  case TNORM_NORMAL:
+    do {
+      r = rng_norm();
+      if (r >= za && r <= zb)
+        stop = true;
+    } while (!stop);
+    break;
+  case TNORM_EXP_UPPER:
+    do {
+      r = rng_exp() / aa + za;
+      u = rng_unif();
+      if ((u <= std::exp(-((r-aa)*(r-aa)) / 2.0)) && (r <= zb))
+        stop = true;
+    } while (!stop);
+    break;
+  case TNORM_EXP_LOWER:
+    do {
+      r = rng_exp() / aa - zb;
+      u = rng_unif();
+      if ((u <= std::exp(-((r-aa)*(r-aa)) / 2.0)) && (r <= -za)) {
+        r = -r;
+        stop = true;
+      }
+    } while (!stop);
+    break;
+  case TNORM_UNIF_UPPER:
+    do {
+      r = rng_unif(za, zb);
+      u = rng_unif();
+      stop = (u <= std::exp((za*za - r*r)/2.0));
+    } while (!stop);
+    break;
+  case TNORM_UNIF_LOWER:
+    do {
+      r = rng_unif(za, zb);
+      u = rng_unif();
+      stop = (u <= std::exp((zb*zb - r*r)/2.0));
+    } while (!stop);
+    break;
+  default:
+    do {
+      r = rng_unif(za, zb);
+      u = rng_unif();
+      stop = (u <= std::exp(-(r*r)/2.0));
+    } while (!stop);
+  }
+  
+  return r;
+}
+
+inline double rng_tnorm(double mu, double sigma, double a,
+                        double b, bool& throw_warning) {
+  if (ISNAN(mu) || ISNAN(sigma) || ISNAN(a) || ISNAN(b) ||
+      sigma <= 0.0 || b <= a) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  
+  // non-truncated normal
+  if (a == R_NegInf && b == R_PosInf)
+    return rng_norm(mu, sigma);
+
+  double za, zb, aa;
+  za = (a-mu)/sigma;
+  zb = (b-mu)/sigma;
+  tnorm_regime_t regime = tnorm_regime(za, zb, aa);
+
+  return mu + sigma * tnorm_draw(regime, za, zb, aa);
+}
+
+
+/*
+ * Truncated normal distribution with fixed parameters
+ *
+ * The log-probabilities of the tails (TnormTails) and the sampling
+ * regime are computed once, when the object is created. The results are the same
+ * as from pdf_tnorm, cdf_tnorm, invcdf_tnorm and rng_tnorm.
+ *
+ */
+
+class TnormFrozen {
+
+  double mu, sigma, a, b;
+  bool nan_param, invalid, untruncated;
+  TnormTails tails;
+  double za, zb, aa;
+  tnorm_regime_t regime;
+
+public:
+
+  TnormFrozen(double mu, double sigma, double a, double b)
+    : mu(mu), sigma(sigma), a(a), b(b) {
+    nan_param = ISNAN(mu) || ISNAN(sigma) || ISNAN(a) || ISNAN(b);
+    invalid = nan_param || sigma <= 0.0 || b <= a;
+    untruncated = (a == R_NegInf && b == R_PosInf);
+    za = zb = aa = NAN;
+    regime = TNORM_UNIF;
+    if (invalid || untruncated)
+      return;
+    za = (a-mu)/sigma;
+    zb = (b-mu)/sigma;
+    tails = TnormTails(za, zb);
+    regime = tnorm_regime(za, zb, aa);
+  }
+
+  inline double pdf(double x, bool log_prob, bool& throw_warning) const {
+    double p;
+#ifdef IEEE_754
+    if (ISNAN(x) || nan_param)
+      return x+mu+sigma+a+b;
+#endif
+    if (invalid) {
+      throw_warning = true;
+      return NAN;
+    }
+    if (untruncated)
+      p = phi((x-mu)/sigma)/sigma;
+    else if (x > a && x < b)
+      p = std::exp(lphi((x-mu)/sigma) - tails.log_mass) / sigma;
+    else
+      p = 0.0;
+    return log_prob ? std::log(p) : p;
+  }
+
+  inline double cdf(double x, bool lower_tail, bool log_p,
+                    bool& throw_warning) const {
+#ifdef IEEE_754
+    if (ISNAN(x) || nan_param)
+      return x+mu+sigma+a+b;
+#endif
+    if (invalid) {
+      throw_warning = true;
+      return NAN;
+    }
+    if (untruncated) {
+      double z = lower_tail ? (x-mu)/sigma : (mu-x)/sigma;
+      return log_p ? lPhi(z) : Phi(z);
+    }
+    double lp;
+    if (x > a && x < b)
+      lp = tails.log_cdf((x-mu)/sigma, lower_tail);
+    else
+      lp = ((x >= b) == lower_tail) ? 0.0 : R_NegInf;
+    return log_p ? lp : std::exp(lp);
+  }
+
+  inline double invcdf(double p, bool lower_tail, bool log_p,
+                       bool& throw_warning) const {
+#ifdef IEEE_754
+    if (ISNAN(p) || nan_param)
+      return p+mu+sigma+a+b;
+#endif
+    if (invalid || (log_p ? p > 0.0 : !VALID_PROB(p))) {
+      throw_warning = true;
+      return NAN;
+    }
+    if (untruncated) {
+      double z = log_p ? InvPhiLog(p) : InvPhi(p);
+      return (lower_tail ? z : -z) * sigma + mu;
+    }
+    double lp = log_p ? p : std::log(p);
+    if (lp == R_NegInf)
+      return lower_tail ? a : b;
+    if (lp == 0.0)
+      return lower_tail ? b : a;
+    if (lower_tail && !log_p)
+      return tails.invcdf(p) * sigma + mu;
+    return tails.log_invcdf(lp, lower_tail) * sigma + mu;
+  }
+
+  inline double rng(bool& throw_warning) const {
+    if (invalid) {
+      throw_warning = true;
+      return NA_REAL;
+    }
+    if (untruncated)
+      return rng_norm(mu, sigma);
+    return mu + sigma * tnorm_draw(regime, za, zb, aa);
+  }
+
+};
+
+}
+
+
+#endif
@@ -0,0 +1,171 @@
+#ifndef EXTRADISTR_TRUNCATED_POISSON_DISTRIBUTION_H
+#define EXTRADISTR_TRUNCATED_POISSON_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+ * The probabilities of the window a < x <= b are computed in log scale,
+ * from the upper tail probabilities when the window lies above lambda
+ * (and from the lower tail otherwise), so they do not round to 0 or 1
+ * for windows far in the tails. Windows far enough in the tails, where
+ * the probabilities decrease at least twice with every step away from
+ * the nearer end, are sampled by rejection from the geometric envelope.
+ *
+ */
+
+inline double tpois_log_mass(double lambda, double a, double b) {
+  if (a >= lambda)
+    return log_sub_exp(R::ppois(a, lambda, false, true),
+                       R::ppois(b, lambda, false, true));
+  return log_sub_exp(R::ppois(b, lambda, true, true),
+                     R::ppois(a, lambda, true, true));
+}
+
+// Windows in the tails are searched using the cdf in log scale, as
+// R's qpois rounds the probabilities there
+
+inline double tpois_quantile(double p, double lambda, double a,
+                             double b, double log_mass) {
+  double lo = std::max(std::floor(a) + 1.0, 0.0);
+  double hi = std::floor(b);
+  if (a >= lambda) {
+    double lqa = R::ppois(a, lambda, false, true);
+    return discrete_quantile(p, lo, lo, hi, [&](double x) {
+      return std::exp(log_sub_exp(lqa, R::ppois(x, lambda, false, true)) -
+                      log_mass);
+    });
+  }
+  if (b <= lambda) {
+    double lpa = R::ppois(a, lambda, true, true);
+    return discrete_quantile(p, hi, lo, hi, [&](double x) {
+      return std::exp(log_sub_exp(R::ppois(x, lambda, true, true), lpa) -
+                      log_mass);
+    });
+  }
+  double pa = R::ppois(a, lambda, true, false);
+  double x = R::qpois(pa + p * std::exp(log_mass), lambda, true, false);
+  return std::min(std::max(x, lo), hi);
+}
+
+inline double logpdf_tpois(double x, double lambda, double a,
+                           double b, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(lambda) || ISNAN(a) || ISNAN(b))
+    return x+lambda+a+b;
+#endif
+  if (lambda < 0.0 || b < a) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  if (!isInteger(x) || x < 0.0 || x <= a || x > b || !R_FINITE(x))
+    return R_NegInf;
+  
+  // if (a == 0.0 && b == R_PosInf)
+  //   return pow(lambda, x) / (factorial(x) * (exp(lambda) - 1.0));
+  
+  return R::dpois(x, lambda, true) - tpois_log_mass(lambda, a, b);
+}
+
+inline double cdf_tpois(double x, double lambda, double a,
+                        double b, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(lambda) || ISNAN(a) || ISNAN(b))
+    return x+lambda+a+b;
+#endif
+  if (lambda <= 0.0 || b < a) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  if (x < 0.0 || x <= a)
+    return 0.0;
+  if (x > b || !R_FINITE(x))
+    return 1.0;
+  
+  // if (a == 0.0 && b == R_PosInf)
+  //   return R::ppois(x, lambda, true, false) / (1.0 - exp(-lambda));
+  
+  double lp;
+  
+  if (a >= lambda) {
+    lp = log_sub_exp(R::ppois(a, lambda, false, true),
+                     R::ppois(x, lambda, false, true));
+  } else {
+    lp = log_sub_exp(R::ppois(x, lambda, true, true),
+                     R::ppois(a, lambda, true, true));
+  }
+  
+  return std::exp(lp - tpois_log_mass(lambda, a, b));
+}
+
+inline double invcdf_tpois(double p, double lambda, double a,
+                           double b, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(lambda) || ISNAN(a) || ISNAN(b))
+    return p+lambda+a+b;
+#endif
+  if (lambda < 0.0 || b < a || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+
+  if (p == 0.0)
+    return std::max(a, 0.0);
+  if (p == 1.0)
+    return b;
+  
+  double log_mass = tpois_log_mass(lambda, a, b);
+  
+  if (log_mass == R_NegInf) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  return tpois_quantile(p, lambda, a, b, log_mass);
+}
+
+inline double rng_tpois(double lambda, double a, double b,
+                        bool& throw_warning) {
+  if (ISNAN(lambda) || ISNAN(a) || ISNAN(b) ||
+      lambda < 0.0 || b < a) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  
+  double log_mass = tpois_log_mass(lambda, a, b);
+  
+  if (log_mass == R_NegInf) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  
+  double lo = std::max(std::floor(a) + 1.0, 0.0);
+  double hi = std::floor(b);
+  
+  // f(x+1)/f(x) = lambda/(x+1)
+  if (lo + 1.0 >= 2.0 * lambda) {
+    return rng_geometric_envelope(lo, 1.0, hi, std::log(lambda / (lo + 1.0)),
+                                  [&](double x) {
+      return R::dpois(x, lambda, true);
+    });
+  }
+  
+  // f(x-1)/f(x) = x/lambda
+  if (hi <= 0.5 * lambda) {
+    return rng_geometric_envelope(hi, -1.0, lo, std::log(hi / lambda),
+                                  [&](double x) {
+      return R::dpois(x, lambda, true);
+    });
+  }
+  
+  return tpois_quantile(rng_unif(), lambda, a, b, log_mass);
+}
+
+}
+
+
+#endif
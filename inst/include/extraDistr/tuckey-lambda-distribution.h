@@ -0,0 +1,49 @@
+#ifndef EXTRADISTR_TUCKEY_LAMBDA_DISTRIBUTION_H
+#define EXTRADISTR_TUCKEY_LAMBDA_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+Joiner, B.L., & Rosenblatt, J.R. (1971).
+Some properties of the range in samples from Tukey's symmetric lambda distributions.
+Journal of the American Statistical Association, 66(334), 394-399.
+
+Hastings Jr, C., Mosteller, F., Tukey, J.W., & Winsor, C.P. (1947).
+Low moments for small samples: a comparative study of order statistics.
+The Annals of Mathematical Statistics, 413-426.
+*/
+
+
+inline double invcdf_tlambda(double p, double lambda,
+                             bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(lambda))
+    return p+lambda;
+#endif
+  if (!VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (lambda == 0.0)
+    return std::log(p) - std::log(1.0 - p);
+  return (std::pow(p, lambda) - std::pow(1.0 - p, lambda))/lambda;
+}
+
+inline double rng_tlambda(double lambda, bool& throw_warning) {
+  if (ISNAN(lambda)) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double u = rng_unif();
+  if (lambda == 0.0)
+    return std::log(u) - std::log(1.0 - u);
+  return (std::pow(u, lambda) - std::pow(1.0 - u, lambda))/lambda;
+}
+
+}
+
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef EXTRADISTR_WALD_DISTRIBUTION_H
+#define EXTRADISTR_WALD_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+ * Wald distribution
+ * 
+ * Parameters:
+ * mu > 0
+ * lambda > 0
+ * 
+ * Values:
+ * x > 0
+ *
+ * 
+ */
+
+inline double pdf_wald(double x, double mu, double lambda,
+                       bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(lambda))
+    return x+mu+lambda;
+#endif
+  if (mu <= 0.0 || lambda <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x <= 0.0 || !R_FINITE(x))
+    return 0.0;
+  return std::sqrt(lambda/(2.0*M_PI*(x*x*x))) *
+         std::exp( (-lambda*(x-mu)*(x-mu))/(2.0*(mu*mu)*x) );
+}
+
+inline double cdf_wald(double x, double mu, double lambda,
+                       bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(lambda))
+    return x+mu+lambda;
+#endif
+  if (mu <= 0.0 || lambda <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x <= 0.0)
+    return 0.0;
+  if (x == R_PosInf)
+    return 1.0;
+  return Phi(std::sqrt(lambda/x)*(x/mu-1.0)) +
+         std::exp((2.0*lambda)/mu) *
+         Phi(-std::sqrt(lambda/x)*(x/mu+1.0));
+}
+
+inline double rng_wald(double mu, double lambda, bool& throw_warning) {
+  if (ISNAN(mu) || ISNAN(lambda) || mu <= 0.0 || lambda <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double u, x, y, z;
+  u = rng_unif();
+  z = rng_norm();
+  y = z*z;
+  x = mu + (mu*mu*y)/(2.0*lambda) - mu/(2.0*lambda) *
+      std::sqrt(4.0*mu*lambda*y+(mu*mu)*(y*y));
+  if (u <= mu/(mu+x))
+    return x;
+  else
+    return (mu*mu)/x;
+}
+
+}
+
+
+#endif
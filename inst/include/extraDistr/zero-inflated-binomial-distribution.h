@@ -0,0 +1,96 @@
+#ifndef EXTRADISTR_ZERO_INFLATED_BINOMIAL_DISTRIBUTION_H
+#define EXTRADISTR_ZERO_INFLATED_BINOMIAL_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+* Zero-inflated Poisson distribution
+* 
+* Parameters:
+* lambda > 0
+* 0 <= pi <= 1
+* 
+* Values:
+* x >= 0
+*
+*/
+
+inline double pdf_zib(double x, double n, double p,
+                      double pi, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(n) || ISNAN(p) || ISNAN(pi))
+    return x+n+p+pi;
+#endif
+  if (!VALID_PROB(p) || n < 0.0 || !VALID_PROB(pi) ||
+      !isInteger(n, false)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0 || !isInteger(x) || !R_FINITE(x))
+    return 0.0;
+  if (x == 0.0) {
+    // pi + (1.0-pi) * pow(1.0-p, n);
+    return pi + std::exp( log1p(-pi) + log1p(-p) * n );
+  } else {
+    // (1.0-pi) * R::dbinom(x, n, p, false);
+    return std::exp( log1p(-pi) + R::dbinom(x, n, p, true) );
+  }
+}
+
+inline double cdf_zib(double x, double n, double p,
+                      double pi, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(n) || ISNAN(p) || ISNAN(pi))
+    return x+n+p+pi;
+#endif
+  if (!VALID_PROB(p) || n < 0.0 || !VALID_PROB(pi) ||
+      !isInteger(n, false)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0)
+    return 0.0;
+  if (!R_FINITE(x))
+    return 1.0;
+  // pi + (1.0-pi) * R::pbinom(x, n, p, true, false);
+  return pi + std::exp( log1p(-pi) + R::pbinom(x, n, p, true, true) );
+}
+
+inline double invcdf_zib(double pp, double n, double p,
+                         double pi, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(pp) || ISNAN(n) || ISNAN(p) || ISNAN(pi))
+    return pp+n+p+pi;
+#endif
+  if (!VALID_PROB(p) || n < 0.0 || !VALID_PROB(pi) ||
+      !isInteger(n, false) || !VALID_PROB(pp)) {
+      throw_warning = true;
+    return NAN;
+  }
+  if (pp < pi)
+    return 0.0;
+  else
+    return R::qbinom((pp - pi) / (1.0-pi), n, p, true, false);
+}
+
+inline double rng_zib(double n, double p, double pi,
+                      bool& throw_warning) {
+  if (ISNAN(n) || ISNAN(p) || ISNAN(pi) || !VALID_PROB(p) ||
+      n < 0.0 || !VALID_PROB(pi) || !isInteger(n, false)) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double u = rng_unif();
+  if (u < pi)
+    return 0.0;
+  else
+    return rng_binom(n, p);
+}
+
+}
+
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef EXTRADISTR_ZERO_INFLATED_NEGATIVE_BINOMIAL_DISTRIBUTION_H
+#define EXTRADISTR_ZERO_INFLATED_NEGATIVE_BINOMIAL_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+inline double pdf_zinb(double x, double r, double p, double pi,
+                       bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(r) || ISNAN(p) || ISNAN(pi))
+    return x+r+p+pi;
+#endif
+  if (!VALID_PROB(p) || r < 0.0 || !VALID_PROB(pi)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0 || !isInteger(x) || !R_FINITE(x))
+    return 0.0;
+  if (x == 0.0) {
+    // pi + (1.0-pi) * pow(p, r);
+    return pi + std::exp(log1p(-pi) + std::log(p) * r);
+  } else {
+    // (1.0-pi) * R::dnbinom(x, r, p, false);
+    return std::exp(log1p(-pi) + R::dnbinom(x, r, p, true));
+  }
+}
+
+inline double cdf_zinb(double x, double r, double p, double pi,
+                       bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(r) || ISNAN(p) || ISNAN(pi))
+    return x+r+p+pi;
+#endif
+  if (!VALID_PROB(p) || r < 0.0 || !VALID_PROB(pi)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0)
+    return 0.0;
+  if (!R_FINITE(x))
+    return 1.0;
+  // pi + (1.0-pi) * R::pnbinom(x, r, p, true, false);
+  return pi + std::exp(log1p(-pi) + R::pnbinom(x, r, p, true, true));
+}
+
+inline double invcdf_zinb(double pp, double r, double p, double pi,
+                          bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(pp) || ISNAN(r) || ISNAN(p) || ISNAN(pi))
+    return pp+r+p+pi;
+#endif
+  if (!VALID_PROB(p) || r < 0.0 || !VALID_PROB(pi) || !VALID_PROB(pp)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (pp < pi)
+    return 0.0;
+  else
+    return R::qnbinom((pp - pi) / (1.0-pi), r, p, true, false);
+}
+
+inline double rng_zinb(double r, double p, double pi,
+                       bool& throw_warning) {
+  if (ISNAN(r) || ISNAN(p) || ISNAN(pi) || !VALID_PROB(p) ||
+      r < 0.0 || !VALID_PROB(pi)) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double u = rng_unif();
+  if (u < pi)
+    return 0.0;
+  else
+    return rng_nbinom(r, p);
+}
+
+}
+
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef EXTRADISTR_ZERO_INFLATED_POISSON_DISTRIBUTION_H
+#define EXTRADISTR_ZERO_INFLATED_POISSON_DISTRIBUTION_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+
+/*
+* Zero-inflated Poisson distribution
+* 
+* Parameters:
+* lambda > 0
+* 0 <= pi <= 1
+* 
+* Values:
+* x >= 0
+*
+*/
+
+inline double pdf_zip(double x, double lambda, double pi,
+                      bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(lambda) || ISNAN(pi))
+    return x+lambda+pi;
+#endif
+  if (lambda <= 0.0 || !VALID_PROB(pi)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0 || !isInteger(x) || !R_FINITE(x))
+    return 0.0;
+  if (x == 0.0) {
+    // pi + (1.0-pi) * exp(-lambda);
+    return pi + std::exp( log1p(-pi) - lambda );
+  } else {
+    // (1.0-pi) * R::dpois(x, lambda, false);
+    return std::exp( log1p(-pi) + R::dpois(x, lambda, true) );
+  }
+}
+
+inline double cdf_zip(double x, double lambda, double pi,
+                      bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(lambda) || ISNAN(pi))
+    return x+lambda+pi;
+#endif
+  if (lambda <= 0.0 || !VALID_PROB(pi)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0)
+    return 0.0;
+  if (!R_FINITE(x))
+    return 1.0;
+  // pi + (1.0-pi) * R::ppois(x, lambda, true, false);
+  return pi + std::exp(log1p(-pi) + R::ppois(x, lambda, true, true));
+}
+
+inline double invcdf_zip(double p, double lambda, double pi,
+                         bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(lambda) || ISNAN(pi))
+    return p+lambda+pi;
+#endif
+  if (lambda <= 0.0 || !VALID_PROB(pi) || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (p < pi)
+    return 0.0;
+  else
+    return R::qpois((p - pi) / (1.0-pi), lambda, true, false);
+}
+
+inline double rng_zip(double lambda, double pi, bool& throw_warning) {
+  if (ISNAN(lambda) || ISNAN(pi) ||
+      lambda <= 0.0 || !VALID_PROB(pi)) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double u = rng_unif();
+  if (u < pi)
+    return 0.0;
+  else
+    return rng_pois(lambda);
+}
+
+}
+
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef EXTRADISTR_ZIGGURAT_H
+#define EXTRADISTR_ZIGGURAT_H
+
+#include "shared.h"
+
+namespace extraDistr {
+
+/*
+ * Ziggurat samplers for the standard normal and exponential distributions
+ *
+ * The density is covered by n layers of equal area, x[0] > x[1] = r > ...
+ * > x[n] = 0, the base layer includes the tail beyond r. A layer is chosen
+ * by 8 random bits and the point u*x[i] is accepted at once if it lies
+ * under the density of the next layer (ratio[i] = x[i+1]/x[i]), that is
+ * ~99% of the draws for the normal and ~98% for the exponential, so
+ * a value usually costs a single uniform and a multiplication.
+ *
+ * The layer index and the uniform come from disjoint random bits (as in
+ * Doornik, 2005), since reusing the bits of the uniform for the index
+ * makes the values correlated.
+ *
+ * Marsaglia, G. and Tsang, W.W. (2000). The Ziggurat Method for Generating
+ * Random Variables. Journal of Statistical Software, 5(8), 1-7.
+ *
+ * Doornik, J.A. (2005). An Improved Ziggurat Method to Generate Normal
+ * Random Samples. Mimeo, Nuffield College, University of Oxford.
+ *
+ */
+
+class ZigguratTables {
+
+  static const int max_layers = 256;
+
+public:
+
+  double x[max_layers + 1];
+  double ratio[max_layers];
+  double f[max_layers + 1];
+
+  // n layers, r is the start of the tail and v the area of each layer
+  // for the unnormalized density exp(-x^2/2) (normal) or exp(-x)
+  template <typename Density, typename InvDensity>
+  ZigguratTables(int n, double r, double v, Density dens, InvDensity inv) {
+    x[0] = v / dens(r);
+    x[1] = r;
+    for (int i = 2; i < n; i++)
+      x[i] = inv(v / x[i-1] + dens(x[i-1]));
+    x[n] = 0.0;
+    for (int i = 0; i < n; i++)
+      ratio[i] = x[i+1] / x[i];
+    for (int i = 0; i <= n; i++)
+      f[i] = dens(x[i]);
+  }
+
+};
+
+
+static const int    ZIG_NORM_LAYERS = 128;
+static const double ZIG_NORM_R      = 3.442619855899;
+static const double ZIG_NORM_V      = 9.91256303526217e-3;
+
+static const int    ZIG_EXP_LAYERS  = 256;
+static const double ZIG_EXP_R       = 7.69711747013104972;
+static const double ZIG_EXP_V       = 3.949659822581572e-3;
+
+inline const ZigguratTables& zig_norm_tables() {
+  // initialization of local statics is thread-safe in C++11
+  static const ZigguratTables tables(
+    ZIG_NORM_LAYERS, ZIG_NORM_R, ZIG_NORM_V,
+    [](double x) { return std::exp(-0.5 * x * x); },
+    [](double y) { return std::sqrt(-2.0 * std::log(y)); }
+  );
+  return tables;
+}
+
+inline const ZigguratTables& zig_exp_tables() {
+  static const ZigguratTables tables(
+    ZIG_EXP_LAYERS, ZIG_EXP_R, ZIG_EXP_V,
+    [](double x) { return std::exp(-x); },
+    [](double y) { return -std::log(y); }
+  );
+  return tables;
+}
+
+
+inline double rng_norm_zig() {
+  const ZigguratTables& zig = zig_norm_tables();
+  int byte;
+  for (;;) {
+    double u = 2.0 * rng_unif_byte(byte) - 1.0;
+    int i = byte & (ZIG_NORM_LAYERS - 1);
+    if (std::abs(u) < zig.ratio[i])
+      return u * zig.x[i];
+    if (i == 0) {
+      // tail beyond r (Marsaglia, 1964)
+      double x, y;
+      do {
+        x = -std::log(rng_unif()) / ZIG_NORM_R;
+        y = -std::log(rng_unif());
+      } while (y + y < x * x);
+      return (u > 0.0) ? ZIG_NORM_R + x : -ZIG_NORM_R - x;
+    }
+    double x = u * zig.x[i];
+    double fx = std::exp(-0.5 * x * x);
+    if (zig.f[i+1] + rng_unif() * (zig.f[i] - zig.f[i+1]) < fx)
+      return x;
+  }
+}
+
+inline double rng_exp_zig() {
+  const ZigguratTables& zig = zig_exp_tables();
+  int byte;
+  for (;;) {
+    double u = rng_unif_byte(byte);
+    int i = byte & (ZIG_EXP_LAYERS - 1);
+    if (u < zig.ratio[i])
+      return u * zig.x[i];
+    if (i == 0) {
+      // the tail beyond r is r plus an exponential variable
+      return ZIG_EXP_R - std::log(rng_unif());
+    }
+    double x = u * zig.x[i];
+    if (zig.f[i+1] + rng_unif() * (zig.f[i] - zig.f[i+1]) < std::exp(-x))
+      return x;
+  }
+}
+
+}
+
+
+#endif
@@ -150,6 +150,27 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline NumericVector cpp_qbbinom(const NumericVector& p, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_qbbinom)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_qbbinom p_cpp_qbbinom = NULL;
+        if (p_cpp_qbbinom == NULL) {
+            validateSignature("NumericVector(*cpp_qbbinom)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_qbbinom = (Ptr_cpp_qbbinom)R_GetCCallable("extraDistr", "_extraDistr_cpp_qbbinom");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_qbbinom(Shield<SEXP>(Rcpp::wrap(p)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(alpha)), Shield<SEXP>(Rcpp::wrap(beta)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_rbbinom(const int& n, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta) {
         typedef SEXP(*Ptr_cpp_rbbinom)(SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_rbbinom p_cpp_rbbinom = NULL;
@@ -213,6 +234,27 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline NumericVector cpp_qbnbinom(const NumericVector& p, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_qbnbinom)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_qbnbinom p_cpp_qbnbinom = NULL;
+        if (p_cpp_qbnbinom == NULL) {
+            validateSignature("NumericVector(*cpp_qbnbinom)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_qbnbinom = (Ptr_cpp_qbnbinom)R_GetCCallable("extraDistr", "_extraDistr_cpp_qbnbinom");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_qbnbinom(Shield<SEXP>(Rcpp::wrap(p)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(alpha)), Shield<SEXP>(Rcpp::wrap(beta)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_rbnbinom(const int& n, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta) {
         typedef SEXP(*Ptr_cpp_rbnbinom)(SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_rbnbinom p_cpp_rbnbinom = NULL;
@@ -1095,6 +1137,132 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline SEXP cpp_frozen_tnorm(const double& mu, const double& sigma, const double& lower, const double& upper, const int& chunk) {
+        typedef SEXP(*Ptr_cpp_frozen_tnorm)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_frozen_tnorm p_cpp_frozen_tnorm = NULL;
+        if (p_cpp_frozen_tnorm == NULL) {
+            validateSignature("SEXP(*cpp_frozen_tnorm)(const double&,const double&,const double&,const double&,const int&)");
+            p_cpp_frozen_tnorm = (Ptr_cpp_frozen_tnorm)R_GetCCallable("extraDistr", "_extraDistr_cpp_frozen_tnorm");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_frozen_tnorm(Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(lower)), Shield<SEXP>(Rcpp::wrap(upper)), Shield<SEXP>(Rcpp::wrap(chunk)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<SEXP >(rcpp_result_gen);
+    }
+
+    inline SEXP cpp_frozen_huber(const double& mu, const double& sigma, const double& epsilon, const int& chunk) {
+        typedef SEXP(*Ptr_cpp_frozen_huber)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_frozen_huber p_cpp_frozen_huber = NULL;
+        if (p_cpp_frozen_huber == NULL) {
+            validateSignature("SEXP(*cpp_frozen_huber)(const double&,const double&,const double&,const int&)");
+            p_cpp_frozen_huber = (Ptr_cpp_frozen_huber)R_GetCCallable("extraDistr", "_extraDistr_cpp_frozen_huber");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_frozen_huber(Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(epsilon)), Shield<SEXP>(Rcpp::wrap(chunk)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<SEXP >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_frozen_d(SEXP ptr, const NumericVector& x, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_frozen_d)(SEXP,SEXP,SEXP);
+        static Ptr_cpp_frozen_d p_cpp_frozen_d = NULL;
+        if (p_cpp_frozen_d == NULL) {
+            validateSignature("NumericVector(*cpp_frozen_d)(SEXP,const NumericVector&,const bool&)");
+            p_cpp_frozen_d = (Ptr_cpp_frozen_d)R_GetCCallable("extraDistr", "_extraDistr_cpp_frozen_d");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_frozen_d(Shield<SEXP>(Rcpp::wrap(ptr)), Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_frozen_p(SEXP ptr, const NumericVector& x, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_frozen_p)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_frozen_p p_cpp_frozen_p = NULL;
+        if (p_cpp_frozen_p == NULL) {
+            validateSignature("NumericVector(*cpp_frozen_p)(SEXP,const NumericVector&,const bool&,const bool&)");
+            p_cpp_frozen_p = (Ptr_cpp_frozen_p)R_GetCCallable("extraDistr", "_extraDistr_cpp_frozen_p");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_frozen_p(Shield<SEXP>(Rcpp::wrap(ptr)), Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_frozen_q(SEXP ptr, const NumericVector& p, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_frozen_q)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_frozen_q p_cpp_frozen_q = NULL;
+        if (p_cpp_frozen_q == NULL) {
+            validateSignature("NumericVector(*cpp_frozen_q)(SEXP,const NumericVector&,const bool&,const bool&)");
+            p_cpp_frozen_q = (Ptr_cpp_frozen_q)R_GetCCallable("extraDistr", "_extraDistr_cpp_frozen_q");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_frozen_q(Shield<SEXP>(Rcpp::wrap(ptr)), Shield<SEXP>(Rcpp::wrap(p)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_frozen_r(SEXP ptr, const int& n) {
+        typedef SEXP(*Ptr_cpp_frozen_r)(SEXP,SEXP);
+        static Ptr_cpp_frozen_r p_cpp_frozen_r = NULL;
+        if (p_cpp_frozen_r == NULL) {
+            validateSignature("NumericVector(*cpp_frozen_r)(SEXP,const int&)");
+            p_cpp_frozen_r = (Ptr_cpp_frozen_r)R_GetCCallable("extraDistr", "_extraDistr_cpp_frozen_r");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_frozen_r(Shield<SEXP>(Rcpp::wrap(ptr)), Shield<SEXP>(Rcpp::wrap(n)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_dgpois(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& log_prob = false) {
         typedef SEXP(*Ptr_cpp_dgpois)(SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_dgpois p_cpp_dgpois = NULL;
@@ -1137,6 +1305,27 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline NumericVector cpp_qgpois(const NumericVector& p, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_qgpois)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_qgpois p_cpp_qgpois = NULL;
+        if (p_cpp_qgpois == NULL) {
+            validateSignature("NumericVector(*cpp_qgpois)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_qgpois = (Ptr_cpp_qgpois)R_GetCCallable("extraDistr", "_extraDistr_cpp_qgpois");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_qgpois(Shield<SEXP>(Rcpp::wrap(p)), Shield<SEXP>(Rcpp::wrap(alpha)), Shield<SEXP>(Rcpp::wrap(beta)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_rgpois(const int& n, const NumericVector& alpha, const NumericVector& beta) {
         typedef SEXP(*Ptr_cpp_rgpois)(SEXP,SEXP,SEXP);
         static Ptr_cpp_rgpois p_cpp_rgpois = NULL;
@@ -1872,6 +2061,27 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline NumericVector cpp_rinvgamma(const int& n, const NumericVector& alpha, const NumericVector& beta) {
+        typedef SEXP(*Ptr_cpp_rinvgamma)(SEXP,SEXP,SEXP);
+        static Ptr_cpp_rinvgamma p_cpp_rinvgamma = NULL;
+        if (p_cpp_rinvgamma == NULL) {
+            validateSignature("NumericVector(*cpp_rinvgamma)(const int&,const NumericVector&,const NumericVector&)");
+            p_cpp_rinvgamma = (Ptr_cpp_rinvgamma)R_GetCCallable("extraDistr", "_extraDistr_cpp_rinvgamma");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_rinvgamma(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(alpha)), Shield<SEXP>(Rcpp::wrap(beta)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_dkumar(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& log_prob = false) {
         typedef SEXP(*Ptr_cpp_dkumar)(SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_dkumar p_cpp_dkumar = NULL;
@@ -2502,6 +2712,69 @@ namespace extraDistr {
         return Rcpp::as<NumericMatrix >(rcpp_result_gen);
     }
 
+    inline NumericVector cpp_dmvtnorm(const NumericMatrix& x, const NumericMatrix& mean, const NumericMatrix& sigma, const NumericMatrix& lower, const NumericMatrix& upper, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_dmvtnorm)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_dmvtnorm p_cpp_dmvtnorm = NULL;
+        if (p_cpp_dmvtnorm == NULL) {
+            validateSignature("NumericVector(*cpp_dmvtnorm)(const NumericMatrix&,const NumericMatrix&,const NumericMatrix&,const NumericMatrix&,const NumericMatrix&,const bool&)");
+            p_cpp_dmvtnorm = (Ptr_cpp_dmvtnorm)R_GetCCallable("extraDistr", "_extraDistr_cpp_dmvtnorm");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_dmvtnorm(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(mean)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(lower)), Shield<SEXP>(Rcpp::wrap(upper)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericMatrix cpp_rmvtnorm(const int& n, const NumericMatrix& mean, const NumericMatrix& sigma, const NumericMatrix& lower, const NumericMatrix& upper, const bool& exact, const NumericMatrix& start, const int& sweeps) {
+        typedef SEXP(*Ptr_cpp_rmvtnorm)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_rmvtnorm p_cpp_rmvtnorm = NULL;
+        if (p_cpp_rmvtnorm == NULL) {
+            validateSignature("NumericMatrix(*cpp_rmvtnorm)(const int&,const NumericMatrix&,const NumericMatrix&,const NumericMatrix&,const NumericMatrix&,const bool&,const NumericMatrix&,const int&)");
+            p_cpp_rmvtnorm = (Ptr_cpp_rmvtnorm)R_GetCCallable("extraDistr", "_extraDistr_cpp_rmvtnorm");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_rmvtnorm(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mean)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(lower)), Shield<SEXP>(Rcpp::wrap(upper)), Shield<SEXP>(Rcpp::wrap(exact)), Shield<SEXP>(Rcpp::wrap(start)), Shield<SEXP>(Rcpp::wrap(sweeps)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericMatrix >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_native_math(const std::string& fun, const NumericVector& x, const NumericVector& y) {
+        typedef SEXP(*Ptr_cpp_native_math)(SEXP,SEXP,SEXP);
+        static Ptr_cpp_native_math p_cpp_native_math = NULL;
+        if (p_cpp_native_math == NULL) {
+            validateSignature("NumericVector(*cpp_native_math)(const std::string&,const NumericVector&,const NumericVector&)");
+            p_cpp_native_math = (Ptr_cpp_native_math)R_GetCCallable("extraDistr", "_extraDistr_cpp_native_math");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_native_math(Shield<SEXP>(Rcpp::wrap(fun)), Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(y)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_dnhyper(const NumericVector& x, const NumericVector& n, const NumericVector& m, const NumericVector& r, const bool& log_prob = false) {
         typedef SEXP(*Ptr_cpp_dnhyper)(SEXP,SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_dnhyper p_cpp_dnhyper = NULL;
@@ -2670,6 +2943,48 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline int cpp_set_threads(const int& n) {
+        typedef SEXP(*Ptr_cpp_set_threads)(SEXP);
+        static Ptr_cpp_set_threads p_cpp_set_threads = NULL;
+        if (p_cpp_set_threads == NULL) {
+            validateSignature("int(*cpp_set_threads)(const int&)");
+            p_cpp_set_threads = (Ptr_cpp_set_threads)R_GetCCallable("extraDistr", "_extraDistr_cpp_set_threads");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_set_threads(Shield<SEXP>(Rcpp::wrap(n)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<int >(rcpp_result_gen);
+    }
+
+    inline int cpp_get_threads() {
+        typedef SEXP(*Ptr_cpp_get_threads)();
+        static Ptr_cpp_get_threads p_cpp_get_threads = NULL;
+        if (p_cpp_get_threads == NULL) {
+            validateSignature("int(*cpp_get_threads)()");
+            p_cpp_get_threads = (Ptr_cpp_get_threads)R_GetCCallable("extraDistr", "_extraDistr_cpp_get_threads");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_get_threads();
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<int >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_dpareto(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& log_prob = false) {
         typedef SEXP(*Ptr_cpp_dpareto)(SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_dpareto p_cpp_dpareto = NULL;
@@ -3027,6 +3342,90 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline int cpp_set_rng_kind(const int& kind) {
+        typedef SEXP(*Ptr_cpp_set_rng_kind)(SEXP);
+        static Ptr_cpp_set_rng_kind p_cpp_set_rng_kind = NULL;
+        if (p_cpp_set_rng_kind == NULL) {
+            validateSignature("int(*cpp_set_rng_kind)(const int&)");
+            p_cpp_set_rng_kind = (Ptr_cpp_set_rng_kind)R_GetCCallable("extraDistr", "_extraDistr_cpp_set_rng_kind");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_set_rng_kind(Shield<SEXP>(Rcpp::wrap(kind)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<int >(rcpp_result_gen);
+    }
+
+    inline int cpp_get_rng_kind() {
+        typedef SEXP(*Ptr_cpp_get_rng_kind)();
+        static Ptr_cpp_get_rng_kind p_cpp_get_rng_kind = NULL;
+        if (p_cpp_get_rng_kind == NULL) {
+            validateSignature("int(*cpp_get_rng_kind)()");
+            p_cpp_get_rng_kind = (Ptr_cpp_get_rng_kind)R_GetCCallable("extraDistr", "_extraDistr_cpp_get_rng_kind");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_get_rng_kind();
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<int >(rcpp_result_gen);
+    }
+
+    inline int cpp_set_norm_kind(const int& kind) {
+        typedef SEXP(*Ptr_cpp_set_norm_kind)(SEXP);
+        static Ptr_cpp_set_norm_kind p_cpp_set_norm_kind = NULL;
+        if (p_cpp_set_norm_kind == NULL) {
+            validateSignature("int(*cpp_set_norm_kind)(const int&)");
+            p_cpp_set_norm_kind = (Ptr_cpp_set_norm_kind)R_GetCCallable("extraDistr", "_extraDistr_cpp_set_norm_kind");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_set_norm_kind(Shield<SEXP>(Rcpp::wrap(kind)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<int >(rcpp_result_gen);
+    }
+
+    inline int cpp_get_norm_kind() {
+        typedef SEXP(*Ptr_cpp_get_norm_kind)();
+        static Ptr_cpp_get_norm_kind p_cpp_get_norm_kind = NULL;
+        if (p_cpp_get_norm_kind == NULL) {
+            validateSignature("int(*cpp_get_norm_kind)()");
+            p_cpp_get_norm_kind = (Ptr_cpp_get_norm_kind)R_GetCCallable("extraDistr", "_extraDistr_cpp_get_norm_kind");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_get_norm_kind();
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<int >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_dsgomp(const NumericVector& x, const NumericVector& b, const NumericVector& eta, bool log_prob = false) {
         typedef SEXP(*Ptr_cpp_dsgomp)(SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_dsgomp p_cpp_dsgomp = NULL;
@@ -3195,6 +3594,68 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline Rcpp::List cpp_table_cache_info() {
+        typedef SEXP(*Ptr_cpp_table_cache_info)();
+        static Ptr_cpp_table_cache_info p_cpp_table_cache_info = NULL;
+        if (p_cpp_table_cache_info == NULL) {
+            validateSignature("Rcpp::List(*cpp_table_cache_info)()");
+            p_cpp_table_cache_info = (Ptr_cpp_table_cache_info)R_GetCCallable("extraDistr", "_extraDistr_cpp_table_cache_info");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_table_cache_info();
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline double cpp_set_table_cache_limit(const double& bytes) {
+        typedef SEXP(*Ptr_cpp_set_table_cache_limit)(SEXP);
+        static Ptr_cpp_set_table_cache_limit p_cpp_set_table_cache_limit = NULL;
+        if (p_cpp_set_table_cache_limit == NULL) {
+            validateSignature("double(*cpp_set_table_cache_limit)(const double&)");
+            p_cpp_set_table_cache_limit = (Ptr_cpp_set_table_cache_limit)R_GetCCallable("extraDistr", "_extraDistr_cpp_set_table_cache_limit");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_set_table_cache_limit(Shield<SEXP>(Rcpp::wrap(bytes)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<double >(rcpp_result_gen);
+    }
+
+    inline void cpp_clear_table_cache() {
+        typedef SEXP(*Ptr_cpp_clear_table_cache)();
+        static Ptr_cpp_clear_table_cache p_cpp_clear_table_cache = NULL;
+        if (p_cpp_clear_table_cache == NULL) {
+            validateSignature("void(*cpp_clear_table_cache)()");
+            p_cpp_clear_table_cache = (Ptr_cpp_clear_table_cache)R_GetCCallable("extraDistr", "_extraDistr_cpp_clear_table_cache");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_clear_table_cache();
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+    }
+
     inline NumericVector cpp_dtriang(const NumericVector& x, const NumericVector& a, const NumericVector& b, const NumericVector& c, const bool& log_prob = false) {
         typedef SEXP(*Ptr_cpp_dtriang)(SEXP,SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_dtriang p_cpp_dtriang = NULL;
@@ -3447,6 +3908,27 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline NumericMatrix cpp_moments_tnorm(const NumericVector& mu, const NumericVector& sigma, const NumericVector& lower, const NumericVector& upper) {
+        typedef SEXP(*Ptr_cpp_moments_tnorm)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_moments_tnorm p_cpp_moments_tnorm = NULL;
+        if (p_cpp_moments_tnorm == NULL) {
+            validateSignature("NumericMatrix(*cpp_moments_tnorm)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&)");
+            p_cpp_moments_tnorm = (Ptr_cpp_moments_tnorm)R_GetCCallable("extraDistr", "_extraDistr_cpp_moments_tnorm");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_moments_tnorm(Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(lower)), Shield<SEXP>(Rcpp::wrap(upper)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericMatrix >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_dtpois(const NumericVector& x, const NumericVector& lambda, const NumericVector& lower, const NumericVector& upper, const bool& log_prob = false) {
         typedef SEXP(*Ptr_cpp_dtpois)(SEXP,SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_dtpois p_cpp_dtpois = NULL;
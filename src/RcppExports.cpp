@@ -235,6 +235,45 @@ RcppExport SEXP _extraDistr_cpp_pbbinom(SEXP xSEXP, SEXP sizeSEXP, SEXP alphaSEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
+// cpp_qbbinom
+NumericVector cpp_qbbinom(const NumericVector& p, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qbbinom_try(SEXP pSEXP, SEXP sizeSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qbbinom(p, size, alpha, beta, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_qbbinom(SEXP pSEXP, SEXP sizeSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qbbinom_try(pSEXP, sizeSEXP, alphaSEXP, betaSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
 // cpp_rbbinom
 NumericVector cpp_rbbinom(const int& n, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta);
 static SEXP _extraDistr_cpp_rbbinom_try(SEXP nSEXP, SEXP sizeSEXP, SEXP alphaSEXP, SEXP betaSEXP) {
@@ -349,6 +388,45 @@ RcppExport SEXP _extraDistr_cpp_pbnbinom(SEXP xSEXP, SEXP sizeSEXP, SEXP alphaSE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
+// cpp_qbnbinom
+NumericVector cpp_qbnbinom(const NumericVector& p, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qbnbinom_try(SEXP pSEXP, SEXP sizeSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qbnbinom(p, size, alpha, beta, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_qbnbinom(SEXP pSEXP, SEXP sizeSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qbnbinom_try(pSEXP, sizeSEXP, alphaSEXP, betaSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
 // cpp_rbnbinom
 NumericVector cpp_rbnbinom(const int& n, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta);
 static SEXP _extraDistr_cpp_rbnbinom_try(SEXP nSEXP, SEXP sizeSEXP, SEXP alphaSEXP, SEXP betaSEXP) {
@@ -1922,62 +2000,25 @@ RcppExport SEXP _extraDistr_cpp_rfrechet(SEXP nSEXP, SEXP lambdaSEXP, SEXP muSEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dgpois
-NumericVector cpp_dgpois(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& log_prob);
-static SEXP _extraDistr_cpp_dgpois_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
-BEGIN_RCPP
-    Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dgpois(x, alpha, beta, log_prob));
-    return rcpp_result_gen;
-END_RCPP_RETURN_ERROR
-}
-RcppExport SEXP _extraDistr_cpp_dgpois(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
-    SEXP rcpp_result_gen;
-    {
-        Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dgpois_try(xSEXP, alphaSEXP, betaSEXP, log_probSEXP));
-    }
-    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
-    if (rcpp_isInterrupt_gen) {
-        UNPROTECT(1);
-        Rf_onintr();
-    }
-    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
-    if (rcpp_isLongjump_gen) {
-        Rcpp::internal::resumeJump(rcpp_result_gen);
-    }
-    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
-    if (rcpp_isError_gen) {
-        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
-        UNPROTECT(1);
-        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
-    }
-    UNPROTECT(1);
-    return rcpp_result_gen;
-}
-// cpp_pgpois
-NumericVector cpp_pgpois(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_pgpois_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_frozen_tnorm
+SEXP cpp_frozen_tnorm(const double& mu, const double& sigma, const double& lower, const double& upper, const int& chunk);
+static SEXP _extraDistr_cpp_frozen_tnorm_try(SEXP muSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP chunkSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_pgpois(x, alpha, beta, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< const double& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const double& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const double& >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const double& >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< const int& >::type chunk(chunkSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_frozen_tnorm(mu, sigma, lower, upper, chunk));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_pgpois(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_frozen_tnorm(SEXP muSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP chunkSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgpois_try(xSEXP, alphaSEXP, betaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_frozen_tnorm_try(muSEXP, sigmaSEXP, lowerSEXP, upperSEXP, chunkSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1997,23 +2038,24 @@ RcppExport SEXP _extraDistr_cpp_pgpois(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rgpois
-NumericVector cpp_rgpois(const int& n, const NumericVector& alpha, const NumericVector& beta);
-static SEXP _extraDistr_cpp_rgpois_try(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP) {
+// cpp_frozen_huber
+SEXP cpp_frozen_huber(const double& mu, const double& sigma, const double& epsilon, const int& chunk);
+static SEXP _extraDistr_cpp_frozen_huber_try(SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP, SEXP chunkSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rgpois(n, alpha, beta));
+    Rcpp::traits::input_parameter< const double& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const double& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const double& >::type epsilon(epsilonSEXP);
+    Rcpp::traits::input_parameter< const int& >::type chunk(chunkSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_frozen_huber(mu, sigma, epsilon, chunk));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rgpois(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP) {
+RcppExport SEXP _extraDistr_cpp_frozen_huber(SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP, SEXP chunkSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rgpois_try(nSEXP, alphaSEXP, betaSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_frozen_huber_try(muSEXP, sigmaSEXP, epsilonSEXP, chunkSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2033,25 +2075,23 @@ RcppExport SEXP _extraDistr_cpp_rgpois(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dgev
-NumericVector cpp_dgev(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& log_prob);
-static SEXP _extraDistr_cpp_dgev_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
+// cpp_frozen_d
+NumericVector cpp_frozen_d(SEXP ptr, const NumericVector& x, const bool& log_prob);
+static SEXP _extraDistr_cpp_frozen_d_try(SEXP ptrSEXP, SEXP xSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type ptr(ptrSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dgev(x, mu, sigma, xi, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_frozen_d(ptr, x, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dgev(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_frozen_d(SEXP ptrSEXP, SEXP xSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dgev_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_frozen_d_try(ptrSEXP, xSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2071,26 +2111,24 @@ RcppExport SEXP _extraDistr_cpp_dgev(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_pgev
-NumericVector cpp_pgev(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, bool lower_tail, bool log_prob);
-static SEXP _extraDistr_cpp_pgev_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_frozen_p
+NumericVector cpp_frozen_p(SEXP ptr, const NumericVector& x, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_frozen_p_try(SEXP ptrSEXP, SEXP xSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type ptr(ptrSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
-    Rcpp::traits::input_parameter< bool >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< bool >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_pgev(x, mu, sigma, xi, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_frozen_p(ptr, x, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_pgev(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_frozen_p(SEXP ptrSEXP, SEXP xSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgev_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_frozen_p_try(ptrSEXP, xSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2110,26 +2148,24 @@ RcppExport SEXP _extraDistr_cpp_pgev(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qgev
-NumericVector cpp_qgev(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, bool lower_tail, bool log_prob);
-static SEXP _extraDistr_cpp_qgev_try(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_frozen_q
+NumericVector cpp_frozen_q(SEXP ptr, const NumericVector& p, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_frozen_q_try(SEXP ptrSEXP, SEXP pSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type ptr(ptrSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
-    Rcpp::traits::input_parameter< bool >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< bool >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qgev(p, mu, sigma, xi, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_frozen_q(ptr, p, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qgev(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_frozen_q(SEXP ptrSEXP, SEXP pSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qgev_try(pSEXP, muSEXP, sigmaSEXP, xiSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_frozen_q_try(ptrSEXP, pSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2149,24 +2185,22 @@ RcppExport SEXP _extraDistr_cpp_qgev(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rgev
-NumericVector cpp_rgev(const int& n, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi);
-static SEXP _extraDistr_cpp_rgev_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP) {
+// cpp_frozen_r
+NumericVector cpp_frozen_r(SEXP ptr, const int& n);
+static SEXP _extraDistr_cpp_frozen_r_try(SEXP ptrSEXP, SEXP nSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type ptr(ptrSEXP);
     Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rgev(n, mu, sigma, xi));
+    rcpp_result_gen = Rcpp::wrap(cpp_frozen_r(ptr, n));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rgev(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP) {
+RcppExport SEXP _extraDistr_cpp_frozen_r(SEXP ptrSEXP, SEXP nSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rgev_try(nSEXP, muSEXP, sigmaSEXP, xiSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_frozen_r_try(ptrSEXP, nSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2186,24 +2220,24 @@ RcppExport SEXP _extraDistr_cpp_rgev(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dgompertz
-NumericVector cpp_dgompertz(const NumericVector& x, const NumericVector& a, const NumericVector& b, bool log_prob);
-static SEXP _extraDistr_cpp_dgompertz_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
+// cpp_dgpois
+NumericVector cpp_dgpois(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& log_prob);
+static SEXP _extraDistr_cpp_dgpois_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
-    Rcpp::traits::input_parameter< bool >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dgompertz(x, a, b, log_prob));
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dgpois(x, alpha, beta, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dgompertz(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dgpois(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dgompertz_try(xSEXP, aSEXP, bSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dgpois_try(xSEXP, alphaSEXP, betaSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2223,25 +2257,25 @@ RcppExport SEXP _extraDistr_cpp_dgompertz(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_pgompertz
-NumericVector cpp_pgompertz(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_pgompertz_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_pgpois
+NumericVector cpp_pgpois(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_pgpois_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_pgompertz(x, a, b, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_pgpois(x, alpha, beta, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_pgompertz(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_pgpois(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgompertz_try(xSEXP, aSEXP, bSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgpois_try(xSEXP, alphaSEXP, betaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2261,25 +2295,25 @@ RcppExport SEXP _extraDistr_cpp_pgompertz(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qgompertz
-NumericVector cpp_qgompertz(const NumericVector& p, const NumericVector& a, const NumericVector& b, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qgompertz_try(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_qgpois
+NumericVector cpp_qgpois(const NumericVector& p, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qgpois_try(SEXP pSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qgompertz(p, a, b, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_qgpois(p, alpha, beta, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qgompertz(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_qgpois(SEXP pSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qgompertz_try(pSEXP, aSEXP, bSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qgpois_try(pSEXP, alphaSEXP, betaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2299,23 +2333,23 @@ RcppExport SEXP _extraDistr_cpp_qgompertz(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rgompertz
-NumericVector cpp_rgompertz(const int& n, const NumericVector& a, const NumericVector& b);
-static SEXP _extraDistr_cpp_rgompertz_try(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP) {
+// cpp_rgpois
+NumericVector cpp_rgpois(const int& n, const NumericVector& alpha, const NumericVector& beta);
+static SEXP _extraDistr_cpp_rgpois_try(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rgompertz(n, a, b));
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rgpois(n, alpha, beta));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rgompertz(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP) {
+RcppExport SEXP _extraDistr_cpp_rgpois(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rgompertz_try(nSEXP, aSEXP, bSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rgpois_try(nSEXP, alphaSEXP, betaSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2335,9 +2369,9 @@ RcppExport SEXP _extraDistr_cpp_rgompertz(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP) {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dgpd
-NumericVector cpp_dgpd(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& log_prob);
-static SEXP _extraDistr_cpp_dgpd_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
+// cpp_dgev
+NumericVector cpp_dgev(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& log_prob);
+static SEXP _extraDistr_cpp_dgev_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
@@ -2345,15 +2379,15 @@ BEGIN_RCPP
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dgpd(x, mu, sigma, xi, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dgev(x, mu, sigma, xi, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dgpd(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dgev(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dgpd_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dgev_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2373,26 +2407,26 @@ RcppExport SEXP _extraDistr_cpp_dgpd(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_pgpd
-NumericVector cpp_pgpd(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_pgpd_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_pgev
+NumericVector cpp_pgev(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, bool lower_tail, bool log_prob);
+static SEXP _extraDistr_cpp_pgev_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_pgpd(x, mu, sigma, xi, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< bool >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< bool >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pgev(x, mu, sigma, xi, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_pgpd(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_pgev(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgpd_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgev_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2412,7 +2446,309 @@ RcppExport SEXP _extraDistr_cpp_pgpd(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qgpd
+// cpp_qgev
+NumericVector cpp_qgev(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, bool lower_tail, bool log_prob);
+static SEXP _extraDistr_cpp_qgev_try(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
+    Rcpp::traits::input_parameter< bool >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< bool >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qgev(p, mu, sigma, xi, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_qgev(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qgev_try(pSEXP, muSEXP, sigmaSEXP, xiSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rgev
+NumericVector cpp_rgev(const int& n, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi);
+static SEXP _extraDistr_cpp_rgev_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rgev(n, mu, sigma, xi));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rgev(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rgev_try(nSEXP, muSEXP, sigmaSEXP, xiSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_dgompertz
+NumericVector cpp_dgompertz(const NumericVector& x, const NumericVector& a, const NumericVector& b, bool log_prob);
+static SEXP _extraDistr_cpp_dgompertz_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< bool >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dgompertz(x, a, b, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_dgompertz(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dgompertz_try(xSEXP, aSEXP, bSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_pgompertz
+NumericVector cpp_pgompertz(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_pgompertz_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pgompertz(x, a, b, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_pgompertz(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgompertz_try(xSEXP, aSEXP, bSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_qgompertz
+NumericVector cpp_qgompertz(const NumericVector& p, const NumericVector& a, const NumericVector& b, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qgompertz_try(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qgompertz(p, a, b, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_qgompertz(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qgompertz_try(pSEXP, aSEXP, bSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rgompertz
+NumericVector cpp_rgompertz(const int& n, const NumericVector& a, const NumericVector& b);
+static SEXP _extraDistr_cpp_rgompertz_try(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rgompertz(n, a, b));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rgompertz(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rgompertz_try(nSEXP, aSEXP, bSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_dgpd
+NumericVector cpp_dgpd(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& log_prob);
+static SEXP _extraDistr_cpp_dgpd_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dgpd(x, mu, sigma, xi, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_dgpd(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dgpd_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_pgpd
+NumericVector cpp_pgpd(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_pgpd_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pgpd(x, mu, sigma, xi, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_pgpd(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgpd_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_qgpd
 NumericVector cpp_qgpd(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& lower_tail, const bool& log_prob);
 static SEXP _extraDistr_cpp_qgpd_try(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
@@ -3304,6 +3640,42 @@ RcppExport SEXP _extraDistr_cpp_pinvgamma(SEXP xSEXP, SEXP alphaSEXP, SEXP betaS
     UNPROTECT(1);
     return rcpp_result_gen;
 }
+// cpp_rinvgamma
+NumericVector cpp_rinvgamma(const int& n, const NumericVector& alpha, const NumericVector& beta);
+static SEXP _extraDistr_cpp_rinvgamma_try(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rinvgamma(n, alpha, beta));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rinvgamma(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rinvgamma_try(nSEXP, alphaSEXP, betaSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
 // cpp_dkumar
 NumericVector cpp_dkumar(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& log_prob);
 static SEXP _extraDistr_cpp_dkumar_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
@@ -4420,6 +4792,122 @@ RcppExport SEXP _extraDistr_cpp_rmvhyper(SEXP nnSEXP, SEXP nSEXP, SEXP kSEXP) {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
+// cpp_dmvtnorm
+NumericVector cpp_dmvtnorm(const NumericMatrix& x, const NumericMatrix& mean, const NumericMatrix& sigma, const NumericMatrix& lower, const NumericMatrix& upper, const bool& log_prob);
+static SEXP _extraDistr_cpp_dmvtnorm_try(SEXP xSEXP, SEXP meanSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type mean(meanSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dmvtnorm(x, mean, sigma, lower, upper, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_dmvtnorm(SEXP xSEXP, SEXP meanSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dmvtnorm_try(xSEXP, meanSEXP, sigmaSEXP, lowerSEXP, upperSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rmvtnorm
+NumericMatrix cpp_rmvtnorm(const int& n, const NumericMatrix& mean, const NumericMatrix& sigma, const NumericMatrix& lower, const NumericMatrix& upper, const bool& exact, const NumericMatrix& start, const int& sweeps);
+static SEXP _extraDistr_cpp_rmvtnorm_try(SEXP nSEXP, SEXP meanSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP exactSEXP, SEXP startSEXP, SEXP sweepsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type mean(meanSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type exact(exactSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type start(startSEXP);
+    Rcpp::traits::input_parameter< const int& >::type sweeps(sweepsSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rmvtnorm(n, mean, sigma, lower, upper, exact, start, sweeps));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rmvtnorm(SEXP nSEXP, SEXP meanSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP exactSEXP, SEXP startSEXP, SEXP sweepsSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rmvtnorm_try(nSEXP, meanSEXP, sigmaSEXP, lowerSEXP, upperSEXP, exactSEXP, startSEXP, sweepsSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_native_math
+NumericVector cpp_native_math(const std::string& fun, const NumericVector& x, const NumericVector& y);
+static SEXP _extraDistr_cpp_native_math_try(SEXP funSEXP, SEXP xSEXP, SEXP ySEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const std::string& >::type fun(funSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type y(ySEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_native_math(fun, x, y));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_native_math(SEXP funSEXP, SEXP xSEXP, SEXP ySEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_native_math_try(funSEXP, xSEXP, ySEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
 // cpp_dnhyper
 NumericVector cpp_dnhyper(const NumericVector& x, const NumericVector& n, const NumericVector& m, const NumericVector& r, const bool& log_prob);
 static SEXP _extraDistr_cpp_dnhyper_try(SEXP xSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP, SEXP log_probSEXP) {
@@ -4617,22 +5105,100 @@ NumericVector cpp_pnsbeta(const NumericVector& x, const NumericVector& alpha, co
 static SEXP _extraDistr_cpp_pnsbeta_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pnsbeta(x, alpha, beta, lower, upper, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_pnsbeta(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pnsbeta_try(xSEXP, alphaSEXP, betaSEXP, lowerSEXP, upperSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_qnsbeta
+NumericVector cpp_qnsbeta(const NumericVector& p, const NumericVector& alpha, const NumericVector& beta, const NumericVector& lower, const NumericVector& upper, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qnsbeta_try(SEXP pSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qnsbeta(p, alpha, beta, lower, upper, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_qnsbeta(SEXP pSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qnsbeta_try(pSEXP, alphaSEXP, betaSEXP, lowerSEXP, upperSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rnsbeta
+NumericVector cpp_rnsbeta(const int& n, const NumericVector& alpha, const NumericVector& beta, const NumericVector& lower, const NumericVector& upper);
+static SEXP _extraDistr_cpp_rnsbeta_try(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_pnsbeta(x, alpha, beta, lower, upper, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_rnsbeta(n, alpha, beta, lower, upper));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_pnsbeta(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rnsbeta(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_pnsbeta_try(xSEXP, alphaSEXP, betaSEXP, lowerSEXP, upperSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rnsbeta_try(nSEXP, alphaSEXP, betaSEXP, lowerSEXP, upperSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4652,27 +5218,21 @@ RcppExport SEXP _extraDistr_cpp_pnsbeta(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qnsbeta
-NumericVector cpp_qnsbeta(const NumericVector& p, const NumericVector& alpha, const NumericVector& beta, const NumericVector& lower, const NumericVector& upper, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qnsbeta_try(SEXP pSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_set_threads
+int cpp_set_threads(const int& n);
+static SEXP _extraDistr_cpp_set_threads_try(SEXP nSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qnsbeta(p, alpha, beta, lower, upper, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_set_threads(n));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qnsbeta(SEXP pSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_set_threads(SEXP nSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qnsbeta_try(pSEXP, alphaSEXP, betaSEXP, lowerSEXP, upperSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_set_threads_try(nSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4692,25 +5252,20 @@ RcppExport SEXP _extraDistr_cpp_qnsbeta(SEXP pSEXP, SEXP alphaSEXP, SEXP betaSEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rnsbeta
-NumericVector cpp_rnsbeta(const int& n, const NumericVector& alpha, const NumericVector& beta, const NumericVector& lower, const NumericVector& upper);
-static SEXP _extraDistr_cpp_rnsbeta_try(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP) {
+// cpp_get_threads
+int cpp_get_threads();
+static SEXP _extraDistr_cpp_get_threads_try() {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rnsbeta(n, alpha, beta, lower, upper));
+    rcpp_result_gen = Rcpp::wrap(cpp_get_threads());
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rnsbeta(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP) {
+RcppExport SEXP _extraDistr_cpp_get_threads() {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rnsbeta_try(nSEXP, alphaSEXP, betaSEXP, lowerSEXP, upperSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_get_threads_try());
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -5360,6 +5915,140 @@ RcppExport SEXP _extraDistr_cpp_rrayleigh(SEXP nSEXP, SEXP sigmaSEXP) {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
+// cpp_set_rng_kind
+int cpp_set_rng_kind(const int& kind);
+static SEXP _extraDistr_cpp_set_rng_kind_try(SEXP kindSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type kind(kindSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_set_rng_kind(kind));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_set_rng_kind(SEXP kindSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_set_rng_kind_try(kindSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_get_rng_kind
+int cpp_get_rng_kind();
+static SEXP _extraDistr_cpp_get_rng_kind_try() {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    rcpp_result_gen = Rcpp::wrap(cpp_get_rng_kind());
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_get_rng_kind() {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_get_rng_kind_try());
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_set_norm_kind
+int cpp_set_norm_kind(const int& kind);
+static SEXP _extraDistr_cpp_set_norm_kind_try(SEXP kindSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type kind(kindSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_set_norm_kind(kind));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_set_norm_kind(SEXP kindSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_set_norm_kind_try(kindSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_get_norm_kind
+int cpp_get_norm_kind();
+static SEXP _extraDistr_cpp_get_norm_kind_try() {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    rcpp_result_gen = Rcpp::wrap(cpp_get_norm_kind());
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_get_norm_kind() {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_get_norm_kind_try());
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
 // cpp_dsgomp
 NumericVector cpp_dsgomp(const NumericVector& x, const NumericVector& b, const NumericVector& eta, bool log_prob);
 static SEXP _extraDistr_cpp_dsgomp_try(SEXP xSEXP, SEXP bSEXP, SEXP etaSEXP, SEXP log_probSEXP) {
@@ -5655,6 +6344,105 @@ RcppExport SEXP _extraDistr_cpp_rslash(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP)
     UNPROTECT(1);
     return rcpp_result_gen;
 }
+// cpp_table_cache_info
+Rcpp::List cpp_table_cache_info();
+static SEXP _extraDistr_cpp_table_cache_info_try() {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    rcpp_result_gen = Rcpp::wrap(cpp_table_cache_info());
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_table_cache_info() {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_table_cache_info_try());
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_set_table_cache_limit
+double cpp_set_table_cache_limit(const double& bytes);
+static SEXP _extraDistr_cpp_set_table_cache_limit_try(SEXP bytesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const double& >::type bytes(bytesSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_set_table_cache_limit(bytes));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_set_table_cache_limit(SEXP bytesSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_set_table_cache_limit_try(bytesSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_clear_table_cache
+void cpp_clear_table_cache();
+static SEXP _extraDistr_cpp_clear_table_cache_try() {
+BEGIN_RCPP
+    cpp_clear_table_cache();
+    return R_NilValue;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_clear_table_cache() {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_clear_table_cache_try());
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
 // cpp_dtriang
 NumericVector cpp_dtriang(const NumericVector& x, const NumericVector& a, const NumericVector& b, const NumericVector& c, const bool& log_prob);
 static SEXP _extraDistr_cpp_dtriang_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP cSEXP, SEXP log_probSEXP) {
@@ -6122,6 +6910,43 @@ RcppExport SEXP _extraDistr_cpp_rtnorm(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP,
     UNPROTECT(1);
     return rcpp_result_gen;
 }
+// cpp_moments_tnorm
+NumericMatrix cpp_moments_tnorm(const NumericVector& mu, const NumericVector& sigma, const NumericVector& lower, const NumericVector& upper);
+static SEXP _extraDistr_cpp_moments_tnorm_try(SEXP muSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP upperSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_moments_tnorm(mu, sigma, lower, upper));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_moments_tnorm(SEXP muSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP upperSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_moments_tnorm_try(muSEXP, sigmaSEXP, lowerSEXP, upperSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
 // cpp_dtpois
 NumericVector cpp_dtpois(const NumericVector& x, const NumericVector& lambda, const NumericVector& lower, const NumericVector& upper, const bool& log_prob);
 static SEXP _extraDistr_cpp_dtpois_try(SEXP xSEXP, SEXP lambdaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP log_probSEXP) {
@@ -6924,9 +7749,11 @@ static int _extraDistr_RcppExport_validate(const char* sig) {
         signatures.insert("NumericVector(*cpp_rbern)(const int&,const NumericVector&)");
         signatures.insert("NumericVector(*cpp_dbbinom)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pbbinom)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+        signatures.insert("NumericVector(*cpp_qbbinom)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rbbinom)(const int&,const NumericVector&,const NumericVector&,const NumericVector&)");
         signatures.insert("NumericVector(*cpp_dbnbinom)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pbnbinom)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+        signatures.insert("NumericVector(*cpp_qbnbinom)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rbnbinom)(const int&,const NumericVector&,const NumericVector&,const NumericVector&)");
         signatures.insert("NumericVector(*cpp_dbetapr)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pbetapr)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
@@ -6969,8 +7796,15 @@ static int _extraDistr_RcppExport_validate(const char* sig) {
         signatures.insert("NumericVector(*cpp_pfrechet)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qfrechet)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rfrechet)(const int&,const NumericVector&,const NumericVector&,const NumericVector&)");
+        signatures.insert("SEXP(*cpp_frozen_tnorm)(const double&,const double&,const double&,const double&,const int&)");
+        signatures.insert("SEXP(*cpp_frozen_huber)(const double&,const double&,const double&,const int&)");
+        signatures.insert("NumericVector(*cpp_frozen_d)(SEXP,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_frozen_p)(SEXP,const NumericVector&,const bool&,const bool&)");
+        signatures.insert("NumericVector(*cpp_frozen_q)(SEXP,const NumericVector&,const bool&,const bool&)");
+        signatures.insert("NumericVector(*cpp_frozen_r)(SEXP,const int&)");
         signatures.insert("NumericVector(*cpp_dgpois)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pgpois)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+        signatures.insert("NumericVector(*cpp_qgpois)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rgpois)(const int&,const NumericVector&,const NumericVector&)");
         signatures.insert("NumericVector(*cpp_dgev)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pgev)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,bool,bool)");
@@ -7006,6 +7840,7 @@ static int _extraDistr_RcppExport_validate(const char* sig) {
         signatures.insert("NumericVector(*cpp_rhuber)(const int&,const NumericVector&,const NumericVector&,const NumericVector&)");
         signatures.insert("NumericVector(*cpp_dinvgamma)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pinvgamma)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+        signatures.insert("NumericVector(*cpp_rinvgamma)(const int&,const NumericVector&,const NumericVector&)");
         signatures.insert("NumericVector(*cpp_dkumar)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pkumar)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qkumar)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
@@ -7036,6 +7871,9 @@ static int _extraDistr_RcppExport_validate(const char* sig) {
         signatures.insert("NumericMatrix(*cpp_rmnom)(const int&,const NumericVector&,const NumericMatrix&)");
         signatures.insert("NumericVector(*cpp_dmvhyper)(const NumericMatrix&,const NumericMatrix&,const NumericVector&,const bool&)");
         signatures.insert("NumericMatrix(*cpp_rmvhyper)(const int&,const NumericMatrix&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_dmvtnorm)(const NumericMatrix&,const NumericMatrix&,const NumericMatrix&,const NumericMatrix&,const NumericMatrix&,const bool&)");
+        signatures.insert("NumericMatrix(*cpp_rmvtnorm)(const int&,const NumericMatrix&,const NumericMatrix&,const NumericMatrix&,const NumericMatrix&,const bool&,const NumericMatrix&,const int&)");
+        signatures.insert("NumericVector(*cpp_native_math)(const std::string&,const NumericVector&,const NumericVector&)");
         signatures.insert("NumericVector(*cpp_dnhyper)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pnhyper)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qnhyper)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
@@ -7044,6 +7882,8 @@ static int _extraDistr_RcppExport_validate(const char* sig) {
         signatures.insert("NumericVector(*cpp_pnsbeta)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qnsbeta)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rnsbeta)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&)");
+        signatures.insert("int(*cpp_set_threads)(const int&)");
+        signatures.insert("int(*cpp_get_threads)()");
         signatures.insert("NumericVector(*cpp_dpareto)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_ppareto)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qpareto)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
@@ -7061,6 +7901,10 @@ static int _extraDistr_RcppExport_validate(const char* sig) {
         signatures.insert("NumericVector(*cpp_prayleigh)(const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qrayleigh)(const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rrayleigh)(const int&,const NumericVector&)");
+        signatures.insert("int(*cpp_set_rng_kind)(const int&)");
+        signatures.insert("int(*cpp_get_rng_kind)()");
+        signatures.insert("int(*cpp_set_norm_kind)(const int&)");
+        signatures.insert("int(*cpp_get_norm_kind)()");
         signatures.insert("NumericVector(*cpp_dsgomp)(const NumericVector&,const NumericVector&,const NumericVector&,bool)");
         signatures.insert("NumericVector(*cpp_psgomp)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rsgomp)(const int&,const NumericVector&,const NumericVector&)");
@@ -7069,6 +7913,9 @@ static int _extraDistr_RcppExport_validate(const char* sig) {
         signatures.insert("NumericVector(*cpp_dslash)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pslash)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rslash)(const int&,const NumericVector&,const NumericVector&)");
+        signatures.insert("Rcpp::List(*cpp_table_cache_info)()");
+        signatures.insert("double(*cpp_set_table_cache_limit)(const double&)");
+        signatures.insert("void(*cpp_clear_table_cache)()");
         signatures.insert("NumericVector(*cpp_dtriang)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_ptriang)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qtriang)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
@@ -7081,6 +7928,7 @@ static int _extraDistr_RcppExport_validate(const char* sig) {
         signatures.insert("NumericVector(*cpp_ptnorm)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qtnorm)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rtnorm)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&)");
+        signatures.insert("NumericMatrix(*cpp_moments_tnorm)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&)");
         signatures.insert("NumericVector(*cpp_dtpois)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_ptpois)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qtpois)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
@@ -7114,9 +7962,11 @@ RcppExport SEXP _extraDistr_RcppExport_registerCCallable() {
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rbern", (DL_FUNC)_extraDistr_cpp_rbern_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dbbinom", (DL_FUNC)_extraDistr_cpp_dbbinom_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pbbinom", (DL_FUNC)_extraDistr_cpp_pbbinom_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qbbinom", (DL_FUNC)_extraDistr_cpp_qbbinom_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rbbinom", (DL_FUNC)_extraDistr_cpp_rbbinom_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dbnbinom", (DL_FUNC)_extraDistr_cpp_dbnbinom_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pbnbinom", (DL_FUNC)_extraDistr_cpp_pbnbinom_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qbnbinom", (DL_FUNC)_extraDistr_cpp_qbnbinom_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rbnbinom", (DL_FUNC)_extraDistr_cpp_rbnbinom_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dbetapr", (DL_FUNC)_extraDistr_cpp_dbetapr_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pbetapr", (DL_FUNC)_extraDistr_cpp_pbetapr_try);
@@ -7159,8 +8009,15 @@ RcppExport SEXP _extraDistr_RcppExport_registerCCallable() {
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pfrechet", (DL_FUNC)_extraDistr_cpp_pfrechet_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qfrechet", (DL_FUNC)_extraDistr_cpp_qfrechet_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rfrechet", (DL_FUNC)_extraDistr_cpp_rfrechet_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_frozen_tnorm", (DL_FUNC)_extraDistr_cpp_frozen_tnorm_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_frozen_huber", (DL_FUNC)_extraDistr_cpp_frozen_huber_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_frozen_d", (DL_FUNC)_extraDistr_cpp_frozen_d_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_frozen_p", (DL_FUNC)_extraDistr_cpp_frozen_p_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_frozen_q", (DL_FUNC)_extraDistr_cpp_frozen_q_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_frozen_r", (DL_FUNC)_extraDistr_cpp_frozen_r_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dgpois", (DL_FUNC)_extraDistr_cpp_dgpois_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pgpois", (DL_FUNC)_extraDistr_cpp_pgpois_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qgpois", (DL_FUNC)_extraDistr_cpp_qgpois_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rgpois", (DL_FUNC)_extraDistr_cpp_rgpois_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dgev", (DL_FUNC)_extraDistr_cpp_dgev_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pgev", (DL_FUNC)_extraDistr_cpp_pgev_try);
@@ -7196,6 +8053,7 @@ RcppExport SEXP _extraDistr_RcppExport_registerCCallable() {
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rhuber", (DL_FUNC)_extraDistr_cpp_rhuber_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dinvgamma", (DL_FUNC)_extraDistr_cpp_dinvgamma_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pinvgamma", (DL_FUNC)_extraDistr_cpp_pinvgamma_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rinvgamma", (DL_FUNC)_extraDistr_cpp_rinvgamma_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dkumar", (DL_FUNC)_extraDistr_cpp_dkumar_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pkumar", (DL_FUNC)_extraDistr_cpp_pkumar_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qkumar", (DL_FUNC)_extraDistr_cpp_qkumar_try);
@@ -7226,6 +8084,9 @@ RcppExport SEXP _extraDistr_RcppExport_registerCCallable() {
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rmnom", (DL_FUNC)_extraDistr_cpp_rmnom_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dmvhyper", (DL_FUNC)_extraDistr_cpp_dmvhyper_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rmvhyper", (DL_FUNC)_extraDistr_cpp_rmvhyper_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dmvtnorm", (DL_FUNC)_extraDistr_cpp_dmvtnorm_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rmvtnorm", (DL_FUNC)_extraDistr_cpp_rmvtnorm_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_native_math", (DL_FUNC)_extraDistr_cpp_native_math_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dnhyper", (DL_FUNC)_extraDistr_cpp_dnhyper_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pnhyper", (DL_FUNC)_extraDistr_cpp_pnhyper_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qnhyper", (DL_FUNC)_extraDistr_cpp_qnhyper_try);
@@ -7234,6 +8095,8 @@ RcppExport SEXP _extraDistr_RcppExport_registerCCallable() {
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pnsbeta", (DL_FUNC)_extraDistr_cpp_pnsbeta_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qnsbeta", (DL_FUNC)_extraDistr_cpp_qnsbeta_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rnsbeta", (DL_FUNC)_extraDistr_cpp_rnsbeta_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_set_threads", (DL_FUNC)_extraDistr_cpp_set_threads_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_get_threads", (DL_FUNC)_extraDistr_cpp_get_threads_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dpareto", (DL_FUNC)_extraDistr_cpp_dpareto_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_ppareto", (DL_FUNC)_extraDistr_cpp_ppareto_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qpareto", (DL_FUNC)_extraDistr_cpp_qpareto_try);
@@ -7251,6 +8114,10 @@ RcppExport SEXP _extraDistr_RcppExport_registerCCallable() {
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_prayleigh", (DL_FUNC)_extraDistr_cpp_prayleigh_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qrayleigh", (DL_FUNC)_extraDistr_cpp_qrayleigh_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rrayleigh", (DL_FUNC)_extraDistr_cpp_rrayleigh_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_set_rng_kind", (DL_FUNC)_extraDistr_cpp_set_rng_kind_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_get_rng_kind", (DL_FUNC)_extraDistr_cpp_get_rng_kind_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_set_norm_kind", (DL_FUNC)_extraDistr_cpp_set_norm_kind_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_get_norm_kind", (DL_FUNC)_extraDistr_cpp_get_norm_kind_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dsgomp", (DL_FUNC)_extraDistr_cpp_dsgomp_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_psgomp", (DL_FUNC)_extraDistr_cpp_psgomp_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rsgomp", (DL_FUNC)_extraDistr_cpp_rsgomp_try);
@@ -7259,6 +8126,9 @@ RcppExport SEXP _extraDistr_RcppExport_registerCCallable() {
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dslash", (DL_FUNC)_extraDistr_cpp_dslash_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pslash", (DL_FUNC)_extraDistr_cpp_pslash_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rslash", (DL_FUNC)_extraDistr_cpp_rslash_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_table_cache_info", (DL_FUNC)_extraDistr_cpp_table_cache_info_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_set_table_cache_limit", (DL_FUNC)_extraDistr_cpp_set_table_cache_limit_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_clear_table_cache", (DL_FUNC)_extraDistr_cpp_clear_table_cache_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dtriang", (DL_FUNC)_extraDistr_cpp_dtriang_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_ptriang", (DL_FUNC)_extraDistr_cpp_ptriang_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qtriang", (DL_FUNC)_extraDistr_cpp_qtriang_try);
@@ -7271,6 +8141,7 @@ RcppExport SEXP _extraDistr_RcppExport_registerCCallable() {
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_ptnorm", (DL_FUNC)_extraDistr_cpp_ptnorm_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qtnorm", (DL_FUNC)_extraDistr_cpp_qtnorm_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rtnorm", (DL_FUNC)_extraDistr_cpp_rtnorm_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_moments_tnorm", (DL_FUNC)_extraDistr_cpp_moments_tnorm_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dtpois", (DL_FUNC)_extraDistr_cpp_dtpois_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_ptpois", (DL_FUNC)_extraDistr_cpp_ptpois_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qtpois", (DL_FUNC)_extraDistr_cpp_qtpois_try);
@@ -7303,9 +8174,11 @@ static const R_CallMethodDef CallEntries[] = {
     {"_extraDistr_cpp_rbern", (DL_FUNC) &_extraDistr_cpp_rbern, 2},
     {"_extraDistr_cpp_dbbinom", (DL_FUNC) &_extraDistr_cpp_dbbinom, 5},
     {"_extraDistr_cpp_pbbinom", (DL_FUNC) &_extraDistr_cpp_pbbinom, 6},
+    {"_extraDistr_cpp_qbbinom", (DL_FUNC) &_extraDistr_cpp_qbbinom, 6},
     {"_extraDistr_cpp_rbbinom", (DL_FUNC) &_extraDistr_cpp_rbbinom, 4},
     {"_extraDistr_cpp_dbnbinom", (DL_FUNC) &_extraDistr_cpp_dbnbinom, 5},
     {"_extraDistr_cpp_pbnbinom", (DL_FUNC) &_extraDistr_cpp_pbnbinom, 6},
+    {"_extraDistr_cpp_qbnbinom", (DL_FUNC) &_extraDistr_cpp_qbnbinom, 6},
     {"_extraDistr_cpp_rbnbinom", (DL_FUNC) &_extraDistr_cpp_rbnbinom, 4},
     {"_extraDistr_cpp_dbetapr", (DL_FUNC) &_extraDistr_cpp_dbetapr, 5},
     {"_extraDistr_cpp_pbetapr", (DL_FUNC) &_extraDistr_cpp_pbetapr, 6},
@@ -7348,8 +8221,15 @@ static const R_CallMethodDef CallEntries[] = {
     {"_extraDistr_cpp_pfrechet", (DL_FUNC) &_extraDistr_cpp_pfrechet, 6},
     {"_extraDistr_cpp_qfrechet", (DL_FUNC) &_extraDistr_cpp_qfrechet, 6},
     {"_extraDistr_cpp_rfrechet", (DL_FUNC) &_extraDistr_cpp_rfrechet, 4},
+    {"_extraDistr_cpp_frozen_tnorm", (DL_FUNC) &_extraDistr_cpp_frozen_tnorm, 5},
+    {"_extraDistr_cpp_frozen_huber", (DL_FUNC) &_extraDistr_cpp_frozen_huber, 4},
+    {"_extraDistr_cpp_frozen_d", (DL_FUNC) &_extraDistr_cpp_frozen_d, 3},
+    {"_extraDistr_cpp_frozen_p", (DL_FUNC) &_extraDistr_cpp_frozen_p, 4},
+    {"_extraDistr_cpp_frozen_q", (DL_FUNC) &_extraDistr_cpp_frozen_q, 4},
+    {"_extraDistr_cpp_frozen_r", (DL_FUNC) &_extraDistr_cpp_frozen_r, 2},
     {"_extraDistr_cpp_dgpois", (DL_FUNC) &_extraDistr_cpp_dgpois, 4},
     {"_extraDistr_cpp_pgpois", (DL_FUNC) &_extraDistr_cpp_pgpois, 5},
+    {"_extraDistr_cpp_qgpois", (DL_FUNC) &_extraDistr_cpp_qgpois, 5},
     {"_extraDistr_cpp_rgpois", (DL_FUNC) &_extraDistr_cpp_rgpois, 3},
     {"_extraDistr_cpp_dgev", (DL_FUNC) &_extraDistr_cpp_dgev, 5},
     {"_extraDistr_cpp_pgev", (DL_FUNC) &_extraDistr_cpp_pgev, 6},
@@ -7385,6 +8265,7 @@ static const R_CallMethodDef CallEntries[] = {
     {"_extraDistr_cpp_rhuber", (DL_FUNC) &_extraDistr_cpp_rhuber, 4},
     {"_extraDistr_cpp_dinvgamma", (DL_FUNC) &_extraDistr_cpp_dinvgamma, 4},
     {"_extraDistr_cpp_pinvgamma", (DL_FUNC) &_extraDistr_cpp_pinvgamma, 5},
+    {"_extraDistr_cpp_rinvgamma", (DL_FUNC) &_extraDistr_cpp_rinvgamma, 3},
     {"_extraDistr_cpp_dkumar", (DL_FUNC) &_extraDistr_cpp_dkumar, 4},
     {"_extraDistr_cpp_pkumar", (DL_FUNC) &_extraDistr_cpp_pkumar, 5},
     {"_extraDistr_cpp_qkumar", (DL_FUNC) &_extraDistr_cpp_qkumar, 5},
@@ -7415,6 +8296,9 @@ static const R_CallMethodDef CallEntries[] = {
     {"_extraDistr_cpp_rmnom", (DL_FUNC) &_extraDistr_cpp_rmnom, 3},
     {"_extraDistr_cpp_dmvhyper", (DL_FUNC) &_extraDistr_cpp_dmvhyper, 4},
     {"_extraDistr_cpp_rmvhyper", (DL_FUNC) &_extraDistr_cpp_rmvhyper, 3},
+    {"_extraDistr_cpp_dmvtnorm", (DL_FUNC) &_extraDistr_cpp_dmvtnorm, 6},
+    {"_extraDistr_cpp_rmvtnorm", (DL_FUNC) &_extraDistr_cpp_rmvtnorm, 8},
+    {"_extraDistr_cpp_native_math", (DL_FUNC) &_extraDistr_cpp_native_math, 3},
     {"_extraDistr_cpp_dnhyper", (DL_FUNC) &_extraDistr_cpp_dnhyper, 5},
     {"_extraDistr_cpp_pnhyper", (DL_FUNC) &_extraDistr_cpp_pnhyper, 6},
     {"_extraDistr_cpp_qnhyper", (DL_FUNC) &_extraDistr_cpp_qnhyper, 6},
@@ -7423,6 +8307,8 @@ static const R_CallMethodDef CallEntries[] = {
     {"_extraDistr_cpp_pnsbeta", (DL_FUNC) &_extraDistr_cpp_pnsbeta, 7},
     {"_extraDistr_cpp_qnsbeta", (DL_FUNC) &_extraDistr_cpp_qnsbeta, 7},
     {"_extraDistr_cpp_rnsbeta", (DL_FUNC) &_extraDistr_cpp_rnsbeta, 5},
+    {"_extraDistr_cpp_set_threads", (DL_FUNC) &_extraDistr_cpp_set_threads, 1},
+    {"_extraDistr_cpp_get_threads", (DL_FUNC) &_extraDistr_cpp_get_threads, 0},
     {"_extraDistr_cpp_dpareto", (DL_FUNC) &_extraDistr_cpp_dpareto, 4},
     {"_extraDistr_cpp_ppareto", (DL_FUNC) &_extraDistr_cpp_ppareto, 5},
     {"_extraDistr_cpp_qpareto", (DL_FUNC) &_extraDistr_cpp_qpareto, 5},
@@ -7440,6 +8326,10 @@ static const R_CallMethodDef CallEntries[] = {
     {"_extraDistr_cpp_prayleigh", (DL_FUNC) &_extraDistr_cpp_prayleigh, 4},
     {"_extraDistr_cpp_qrayleigh", (DL_FUNC) &_extraDistr_cpp_qrayleigh, 4},
     {"_extraDistr_cpp_rrayleigh", (DL_FUNC) &_extraDistr_cpp_rrayleigh, 2},
+    {"_extraDistr_cpp_set_rng_kind", (DL_FUNC) &_extraDistr_cpp_set_rng_kind, 1},
+    {"_extraDistr_cpp_get_rng_kind", (DL_FUNC) &_extraDistr_cpp_get_rng_kind, 0},
+    {"_extraDistr_cpp_set_norm_kind", (DL_FUNC) &_extraDistr_cpp_set_norm_kind, 1},
+    {"_extraDistr_cpp_get_norm_kind", (DL_FUNC) &_extraDistr_cpp_get_norm_kind, 0},
     {"_extraDistr_cpp_dsgomp", (DL_FUNC) &_extraDistr_cpp_dsgomp, 4},
     {"_extraDistr_cpp_psgomp", (DL_FUNC) &_extraDistr_cpp_psgomp, 5},
     {"_extraDistr_cpp_rsgomp", (DL_FUNC) &_extraDistr_cpp_rsgomp, 3},
@@ -7448,6 +8338,9 @@ static const R_CallMethodDef CallEntries[] = {
     {"_extraDistr_cpp_dslash", (DL_FUNC) &_extraDistr_cpp_dslash, 4},
     {"_extraDistr_cpp_pslash", (DL_FUNC) &_extraDistr_cpp_pslash, 5},
     {"_extraDistr_cpp_rslash", (DL_FUNC) &_extraDistr_cpp_rslash, 3},
+    {"_extraDistr_cpp_table_cache_info", (DL_FUNC) &_extraDistr_cpp_table_cache_info, 0},
+    {"_extraDistr_cpp_set_table_cache_limit", (DL_FUNC) &_extraDistr_cpp_set_table_cache_limit, 1},
+    {"_extraDistr_cpp_clear_table_cache", (DL_FUNC) &_extraDistr_cpp_clear_table_cache, 0},
     {"_extraDistr_cpp_dtriang", (DL_FUNC) &_extraDistr_cpp_dtriang, 5},
     {"_extraDistr_cpp_ptriang", (DL_FUNC) &_extraDistr_cpp_ptriang, 6},
     {"_extraDistr_cpp_qtriang", (DL_FUNC) &_extraDistr_cpp_qtriang, 6},
@@ -7460,6 +8353,7 @@ static const R_CallMethodDef CallEntries[] = {
     {"_extraDistr_cpp_ptnorm", (DL_FUNC) &_extraDistr_cpp_ptnorm, 7},
     {"_extraDistr_cpp_qtnorm", (DL_FUNC) &_extraDistr_cpp_qtnorm, 7},
     {"_extraDistr_cpp_rtnorm", (DL_FUNC) &_extraDistr_cpp_rtnorm, 5},
+    {"_extraDistr_cpp_moments_tnorm", (DL_FUNC) &_extraDistr_cpp_moments_tnorm, 4},
     {"_extraDistr_cpp_dtpois", (DL_FUNC) &_extraDistr_cpp_dtpois, 5},
     {"_extraDistr_cpp_ptpois", (DL_FUNC) &_extraDistr_cpp_ptpois, 6},
     {"_extraDistr_cpp_qtpois", (DL_FUNC) &_extraDistr_cpp_qtpois, 6},
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/bernoulli-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,79 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
-*  Bernoulli distribution
-*
-*  Values:
-*  x
-*
-*  Parameters:
-*  0 <= p <= 1
-*
-*/
-
-inline double pdf_bernoulli(double x, double prob,
-                            bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(prob))
-    return x+prob;
-#endif
-  if (!VALID_PROB(prob)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x == 1.0)
-    return prob;
-  if (x == 0.0)
-    return 1.0 - prob;
-  
-  char msg[55];
-  std::snprintf(msg, sizeof(msg), "improper x = %f", x);
-  Rcpp::warning(msg);
-  
-  return 0.0;
-}
-
-inline double cdf_bernoulli(double x, double prob,
-                            bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(prob))
-    return x+prob;
-#endif
-  if (!VALID_PROB(prob)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0)
-    return 0.0;
-  if (x < 1.0)
-    return 1.0 - prob;
-  return 1.0;
-}
-
-inline double invcdf_bernoulli(double p, double prob,
-                               bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(prob))
-    return p+prob;
-#endif
-  if (!VALID_PROB(prob) || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  return (p <= (1.0 - prob)) ? 0.0 : 1.0;
-}
-
-inline double rng_bernoulli(double prob, bool& throw_warning) {
-  if (ISNAN(prob) || !VALID_PROB(prob)) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double u = rng_unif();
-  return (u > prob) ? 0.0 : 1.0;
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dbern(
     const NumericVector& x,
@@ -105,9 +33,10 @@ NumericVector cpp_dbern(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = pdf_bernoulli(GETV(x, i), GETV(prob, i),
-                         throw_warning);
+                         warn);
+  });
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -139,9 +68,10 @@ NumericVector cpp_pbern(
 
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_bernoulli(GETV(x, i), GETV(prob, i),
-                         throw_warning);
+                         warn);
+  });
   
   if (!lower_tail)
     p = 1.0 - p;
@@ -183,9 +113,10 @@ NumericVector cpp_qbern(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     q[i] = invcdf_bernoulli(GETV(pp, i), GETV(prob, i),
-                            throw_warning);
+                            warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -209,8 +140,9 @@ NumericVector cpp_rbern(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
-    x[i] = rng_bernoulli(GETV(prob, i), throw_warning);
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+    x[i] = rng_bernoulli(GETV(prob, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
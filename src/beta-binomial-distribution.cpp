@@ -1,5 +1,7 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "table-cache.h"
+#include "../inst/include/extraDistr/beta-binomial-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,38 +15,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
-*  Beta-binomial distribution
-*
-*  Values:
-*  x
-*
-*  Parameters:
-*  k > 0
-*  alpha > 0
-*  beta > 0
-*
-*  f(k) = choose(n, k) * (beta(k+alpha, n-k+beta)) / (beta(alpha, beta))
-*
-*/
-
-
-inline double logpmf_bbinom(double k, double n, double alpha,
-                            double beta, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(k) || ISNAN(n) || ISNAN(alpha) || ISNAN(beta))
-    return k+n+alpha+beta;
-#endif
-  if (alpha < 0.0 || beta < 0.0 || n < 0.0 || !isInteger(n, false)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (!isInteger(k) || k < 0.0 || k > n)
-    return R_NegInf;
-  // R::choose(n, k) * R::beta(k+alpha, n-k+beta) / R::beta(alpha, beta);
-  return R::lchoose(n, k) + R::lbeta(k+alpha, n-k+beta) - R::lbeta(alpha, beta);
-}
-
 inline std::vector<double> cdf_bbinom_table(double k, double n,
                                             double alpha, double beta) {
   
@@ -55,14 +25,14 @@ inline std::vector<double> cdf_bbinom_table(double k, double n,
   std::vector<double> p_tab(ik+1);
   double nck, bab, gx, gy, gxy;
   
-  bab = R::lbeta(alpha, beta);
-  gxy = R::lgammafn(alpha + beta + n);
+  bab = lbeta_fn(alpha, beta);
+  gxy = lgamma_fn(alpha + beta + n);
   
   // k = 0
   
   nck = 0.0;
-  gx = R::lgammafn(alpha);
-  gy = R::lgammafn(beta + n);
+  gx = lgamma_fn(alpha);
+  gy = lgamma_fn(beta + n);
   p_tab[0] = exp(nck + gx + gy - gxy - bab);
   
   if (ik < 1)
@@ -95,17 +65,6 @@ inline std::vector<double> cdf_bbinom_table(double k, double n,
   return p_tab;
 }
 
-inline double rng_bbinom(double n, double alpha,
-                         double beta, bool& throw_warning) {
-  if (ISNAN(n) || ISNAN(alpha) || ISNAN(beta) ||
-      alpha < 0.0 || beta < 0.0 || n < 0.0 || !isInteger(n, false)) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double prob = R::rbeta(alpha, beta);
-  return R::rbinom(n, prob);
-}
-
 
 // [[Rcpp::export]]
 NumericVector cpp_dbbinom(
@@ -131,10 +90,18 @@ NumericVector cpp_dbbinom(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
-    p[i] = logpmf_bbinom(GETV(x, i), GETV(size, i),
-                         GETV(alpha, i), GETV(beta, i),
-                         throw_warning);
+  if (all_scalar({size.length(), alpha.length(), beta.length()})) {
+    BbinomFrozen dist(size[0], alpha[0], beta[0]);
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      p[i] = dist.pdf(x[i], true, warn);
+    });
+  } else {
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      p[i] = logpmf_bbinom(GETV(x, i), GETV(size, i),
+                           GETV(alpha, i), GETV(beta, i),
+                           warn);
+    });
+  }
 
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -171,7 +138,14 @@ NumericVector cpp_pbbinom(
   
   bool throw_warning = false;
   
-  std::map<std::tuple<int, int, int>, std::vector<double>> memo;
+  std::map<std::tuple<int, int, int>, table_ptr> memo;
+  
+  // Tables are used when they are short enough and shared by enough
+  // values, otherwise the values are evaluated by cdf_bbinom.
+  
+  double max_table = max_cdf_table(
+    Nmax, static_cast<double>(size.length()) * alpha.length() * beta.length()
+  );
 
   // maximum modulo size.length(), bounded in [0, size]
   int n = x.length();
@@ -188,47 +162,44 @@ NumericVector cpp_pbbinom(
     if (i % 100 == 0)
       Rcpp::checkUserInterrupt();
     
-#ifdef IEEE_754
-    if (ISNAN(GETV(x, i)) || ISNAN(GETV(size, i)) ||
-        ISNAN(GETV(alpha, i)) || ISNAN(GETV(beta, i))) {
-      p[i] = GETV(x, i) + GETV(size, i) + GETV(alpha, i) + GETV(beta, i);
-      continue;
-    }
-#endif
+    double mxi = mx[i % size.length()];
     
-    if (GETV(alpha, i) <= 0.0 || GETV(beta, i) <= 0.0 ||
-        GETV(size, i) < 0.0 || !isInteger(GETV(size, i), false)) {
-      throw_warning = true;
-      p[i] = NAN;
-    } else if (GETV(x, i) < 0.0) {
-      p[i] = 0.0;
-    } else if (GETV(x, i) >= GETV(size, i)) {
-      p[i] = 1.0;
-    } else if (is_large_int(GETV(x, i))) {
-      p[i] = NA_REAL;
-      Rcpp::warning("NAs introduced by coercion to integer range");
+    if (ISNAN(GETV(x, i)) || ISNAN(GETV(size, i)) ||
+        ISNAN(GETV(alpha, i)) || ISNAN(GETV(beta, i)) ||
+        GETV(alpha, i) <= 0.0 || GETV(beta, i) <= 0.0 ||
+        GETV(size, i) < 0.0 || !isInteger(GETV(size, i), false) ||
+        GETV(x, i) < 0.0 || GETV(x, i) >= GETV(size, i) ||
+        mxi + 1.0 > max_table) {
+      
+      p[i] = cdf_bbinom(GETV(x, i), GETV(size, i),
+                        GETV(alpha, i), GETV(beta, i),
+                        lower_tail, log_prob, throw_warning);
+      
     } else {
       
-      std::vector<double>& tmp = memo[std::make_tuple(
+      table_ptr& tmp = memo[std::make_tuple(
         static_cast<int>(i % size.length()),
         static_cast<int>(i % alpha.length()),
         static_cast<int>(i % beta.length())
       )];
       
-      if (!tmp.size()) {
-        double mxi = std::min(mx[i % size.length()], GETV(size, i));
-        tmp = cdf_bbinom_table(mx[i % size.length()], GETV(size, i), GETV(alpha, i), GETV(beta, i));
+      if (!tmp) {
+        tmp = cached_table(TABLE_PBBINOM,
+                           GETV(size, i), GETV(alpha, i), GETV(beta, i),
+                           to_pos_int(mxi) + 1, [&]() {
+          return cdf_bbinom_table(mxi, GETV(size, i),
+                                  GETV(alpha, i), GETV(beta, i));
+        });
       }
-      p[i] = tmp[to_pos_int(GETV(x, i))];
+      
+      p[i] = (*tmp)[to_pos_int(GETV(x, i))];
+      if (!lower_tail)
+        p[i] = 1.0 - p[i];
+      if (log_prob)
+        p[i] = log(p[i]);
       
     }
   }
-
-  if (!lower_tail)
-    p = 1.0 - p;
-  
-  if (log_prob)
-    p = Rcpp::log(p);
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -237,6 +208,54 @@ NumericVector cpp_pbbinom(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_qbbinom(
+    const NumericVector& p,
+    const NumericVector& size,
+    const NumericVector& alpha,
+    const NumericVector& beta,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({p.length(), size.length(),
+                alpha.length(), beta.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    p.length(),
+    size.length(),
+    alpha.length(),
+    beta.length()
+  });
+  NumericVector pp = Rcpp::clone(p);
+  
+  bool throw_warning = false;
+  
+  if (log_prob)
+    pp = Rcpp::exp(pp);
+  
+  if (!lower_tail)
+    pp = 1.0 - pp;
+  
+  NumericVector x = cached_quantiles(
+    TABLE_PBBINOM, Nmax, pp, size, alpha, beta,
+    [](double prob, double n, double a, double b, bool& warn) {
+      return invcdf_bbinom(prob, n, a, b, warn);
+    },
+    [](double k, double n, double a, double b) {
+      return cdf_bbinom_table(k, n, a, b);
+    },
+    throw_warning
+  );
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return x;
+}
+
 // [[Rcpp::export]]
 NumericVector cpp_rbbinom(
     const int& n,
@@ -254,9 +273,17 @@ NumericVector cpp_rbbinom(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < n; i++)
-    x[i] = rng_bbinom(GETV(size, i), GETV(alpha, i), GETV(beta, i),
-                      throw_warning);
+  if (all_scalar({size.length(), alpha.length(), beta.length()})) {
+    BbinomFrozen dist(size[0], alpha[0], beta[0]);
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+      x[i] = dist.rng(warn);
+    });
+  } else {
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+      x[i] = rng_bbinom(GETV(size, i), GETV(alpha, i), GETV(beta, i),
+                        warn);
+    });
+  }
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
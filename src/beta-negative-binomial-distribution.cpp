@@ -1,5 +1,7 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "table-cache.h"
+#include "../inst/include/extraDistr/beta-negative-binomial-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,40 +15,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
-*  Beta-negative binomial distribution
-*
-*  Values:
-*  x
-*
-*  Parameters:
-*  r > 0
-*  alpha > 0
-*  beta > 0
-*
-*  f(k) = gamma(r+k)/(k! gamma(r)) * beta(alpha+r, beta+k)/beta(alpha, beta)
-*
-*/
-
-
-inline double logpmf_bnbinom(double k, double r, double alpha,
-                             double beta, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(k) || ISNAN(r) || ISNAN(alpha) || ISNAN(beta))
-    return k+r+alpha+beta;
-#endif
-  if (alpha <= 0.0 || beta <= 0.0 || r < 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (!isInteger(k) || k < 0.0 || !R_FINITE(k))
-    return R_NegInf;
-  // (R::gammafn(r+k) / (R::gammafn(k+1.0) * R::gammafn(r))) *
-  //     R::beta(alpha+r, beta+k) / R::beta(alpha, beta);
-  return (R::lgammafn(r+k) - R::lgammafn(k+1.0) - R::lgammafn(r)) +
-    R::lbeta(alpha+r, beta+k) - R::lbeta(alpha, beta);
-}
-
 inline std::vector<double> cdf_bnbinom_table(double k, double r,
                                              double alpha, double beta) {
   
@@ -57,16 +25,16 @@ inline std::vector<double> cdf_bnbinom_table(double k, double r,
   std::vector<double> p_tab(ik+1);
   double grx, xf, gr, gar, gbx, gabrx, bab;
   
-  bab = R::lbeta(alpha, beta);
-  gr = R::lgammafn(r);
-  gar = R::lgammafn(alpha + r);
+  bab = lbeta_fn(alpha, beta);
+  gr = lgamma_fn(r);
+  gar = lgamma_fn(alpha + r);
   xf = 0.0;
   
   // k < 1
   
   grx = gr;
-  gbx = R::lgammafn(beta);
-  gabrx = R::lgammafn(alpha + beta + r);
+  gbx = lgamma_fn(beta);
+  gabrx = lgamma_fn(alpha + beta + r);
   p_tab[0] = exp(grx - gr + gar + gbx - gabrx - bab);
   
   if (ik < 1)
@@ -101,17 +69,6 @@ inline std::vector<double> cdf_bnbinom_table(double k, double r,
   return p_tab;
 }
 
-inline double rng_bnbinom(double r, double alpha,
-                          double beta, bool& throw_warning) {
-  if (ISNAN(r) || ISNAN(alpha) || ISNAN(beta) || alpha <= 0.0 ||
-      beta <= 0.0 || r < 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double prob = R::rbeta(alpha, beta);
-  return R::rnbinom(r, prob);
-}
-
 
 // [[Rcpp::export]]
 NumericVector cpp_dbnbinom(
@@ -137,9 +94,17 @@ NumericVector cpp_dbnbinom(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
-    p[i] = logpmf_bnbinom(GETV(x, i), GETV(size, i), GETV(alpha, i),
-                          GETV(beta, i), throw_warning);
+  if (all_scalar({size.length(), alpha.length(), beta.length()})) {
+    BnbinomFrozen dist(size[0], alpha[0], beta[0]);
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      p[i] = dist.pdf(x[i], true, warn);
+    });
+  } else {
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      p[i] = logpmf_bnbinom(GETV(x, i), GETV(size, i), GETV(alpha, i),
+                            GETV(beta, i), warn);
+    });
+  }
 
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -176,7 +141,14 @@ NumericVector cpp_pbnbinom(
   
   bool throw_warning = false;
 
-  std::map<std::tuple<int, int, int>, std::vector<double>> memo;
+  std::map<std::tuple<int, int, int>, table_ptr> memo;
+  
+  // Tables are used when they are short enough and shared by enough
+  // values, otherwise the values are evaluated by cdf_bnbinom.
+  
+  double max_table = max_cdf_table(
+    Nmax, static_cast<double>(size.length()) * alpha.length() * beta.length()
+  );
   
   // maximum modulo size.length(), > 0
   int n = x.length();
@@ -194,46 +166,43 @@ NumericVector cpp_pbnbinom(
     if (i % 100 == 0)
       Rcpp::checkUserInterrupt();
     
-#ifdef IEEE_754
-    if (ISNAN(GETV(x, i)) || ISNAN(GETV(size, i)) ||
-        ISNAN(GETV(alpha, i)) || ISNAN(GETV(beta, i))) {
-      p[i] = GETV(x, i) + GETV(size, i) + GETV(alpha, i) + GETV(beta, i);
-      continue;
-    }
-#endif
+    double mxi = mx[i % size.length()];
     
-    if (GETV(alpha, i) <= 0.0 || GETV(beta, i) <= 0.0 || GETV(size, i) < 0.0) {
-      throw_warning = true;
-      p[i] = NAN;
-    } else if (GETV(x, i) < 0.0) {
-      p[i] = 0.0;
-    } else if (!R_FINITE(GETV(x, i))) {
-      p[i] = 1.0;
-    } else if (is_large_int(GETV(x, i))) {
-      p[i] = NA_REAL;
-      Rcpp::warning("NAs introduced by coercion to integer range");
+    if (ISNAN(GETV(x, i)) || ISNAN(GETV(size, i)) ||
+        ISNAN(GETV(alpha, i)) || ISNAN(GETV(beta, i)) ||
+        GETV(alpha, i) <= 0.0 || GETV(beta, i) <= 0.0 ||
+        GETV(size, i) < 0.0 || GETV(x, i) < 0.0 || !R_FINITE(GETV(x, i)) ||
+        mxi + 1.0 > max_table) {
+      
+      p[i] = cdf_bnbinom(GETV(x, i), GETV(size, i),
+                         GETV(alpha, i), GETV(beta, i),
+                         lower_tail, log_prob, throw_warning);
+      
     } else {
       
-      std::vector<double>& tmp = memo[std::make_tuple(
+      table_ptr& tmp = memo[std::make_tuple(
         static_cast<int>(i % size.length()),
         static_cast<int>(i % alpha.length()),
         static_cast<int>(i % beta.length())
       )];
       
-      if (!tmp.size()) {
-        //double mxi = std::min(mx[i % size.length()], GETV(size, i));
-        tmp = cdf_bnbinom_table(mx[i % size.length()], GETV(size, i), GETV(alpha, i), GETV(beta, i));
+      if (!tmp) {
+        tmp = cached_table(TABLE_PBNBINOM,
+                           GETV(size, i), GETV(alpha, i), GETV(beta, i),
+                           to_pos_int(mxi) + 1, [&]() {
+          return cdf_bnbinom_table(mxi, GETV(size, i),
+                                   GETV(alpha, i), GETV(beta, i));
+        });
       }
-      p[i] = tmp[to_pos_int(GETV(x, i))];
+      
+      p[i] = (*tmp)[to_pos_int(GETV(x, i))];
+      if (!lower_tail)
+        p[i] = 1.0 - p[i];
+      if (log_prob)
+        p[i] = log(p[i]);
       
     }
   }
-
-  if (!lower_tail)
-    p = 1.0 - p;
-  
-  if (log_prob)
-    p = Rcpp::log(p);
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -242,6 +211,54 @@ NumericVector cpp_pbnbinom(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_qbnbinom(
+    const NumericVector& p,
+    const NumericVector& size,
+    const NumericVector& alpha,
+    const NumericVector& beta,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({p.length(), size.length(),
+                alpha.length(), beta.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    p.length(),
+    size.length(),
+    alpha.length(),
+    beta.length()
+  });
+  NumericVector pp = Rcpp::clone(p);
+  
+  bool throw_warning = false;
+  
+  if (log_prob)
+    pp = Rcpp::exp(pp);
+  
+  if (!lower_tail)
+    pp = 1.0 - pp;
+  
+  NumericVector x = cached_quantiles(
+    TABLE_PBNBINOM, Nmax, pp, size, alpha, beta,
+    [](double prob, double r, double a, double b, bool& warn) {
+      return invcdf_bnbinom(prob, r, a, b, warn);
+    },
+    [](double k, double r, double a, double b) {
+      return cdf_bnbinom_table(k, r, a, b);
+    },
+    throw_warning
+  );
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return x;
+}
+
 // [[Rcpp::export]]
 NumericVector cpp_rbnbinom(
     const int& n,
@@ -259,9 +276,10 @@ NumericVector cpp_rbnbinom(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_bnbinom(GETV(size, i), GETV(alpha, i), GETV(beta, i),
-                       throw_warning);
+                       warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
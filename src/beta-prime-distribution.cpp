@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/beta-prime-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -14,85 +15,6 @@ using Rcpp::NumericVector;
 
 using std::log1p;
 
-/*
-*  Beta prime distribution
-*
-*  Values:
-*  x > 0
-*
-*  Parameters:
-*  alpha > 0
-*  beta > 0
-*  sigma > 0
-*
-*/
-
-
-inline double logpdf_betapr(double x, double alpha, double beta,
-                            double sigma, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta) || ISNAN(sigma))
-    return x+alpha+beta+sigma;
-#endif
-  if (alpha <= 0.0 || beta <= 0.0 || sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x <= 0.0 || !R_FINITE(x))
-    return R_NegInf;
-  double z = x / sigma;
-  // pow(z, alpha-1.0) * pow(z+1.0, -alpha-beta) / R::beta(alpha, beta) / sigma;
-  return log(z) * (alpha-1.0) + log1p(z) * (-alpha-beta) -
-    R::lbeta(alpha, beta) - log(sigma);
-}
-
-inline double cdf_betapr(double x, double alpha, double beta,
-                         double sigma, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta) || ISNAN(sigma))
-    return x+alpha+beta+sigma;
-#endif
-  if (alpha <= 0.0 || beta <= 0.0 || sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x <= 0.0)
-    return 0.0;
-  if (!R_FINITE(x))
-    return 1.0;
-  double z = x / sigma;
-  return R::pbeta(z/(1.0+z), alpha, beta, true, false);
-}
-
-inline double invcdf_betapr(double p, double alpha, double beta,
-                            double sigma, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(alpha) || ISNAN(beta) || ISNAN(sigma))
-    return p+alpha+beta+sigma;
-#endif
-  if (alpha <= 0.0 || beta <= 0.0 || sigma <= 0.0 || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (p == 0.0)
-    return 0.0;
-  if (p == 1.0)
-    return R_PosInf;
-  double x = R::qbeta(p, alpha, beta, true, false);
-  return x/(1.0-x) * sigma;
-}
-
-inline double rng_betapr(double alpha, double beta,
-                         double sigma, bool& throw_warning) {
-  if (ISNAN(alpha) || ISNAN(beta) || ISNAN(sigma) ||
-      alpha <= 0.0 || beta <= 0.0 || sigma <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double x = R::rbeta(alpha, beta);
-  return x/(1.0-x) * sigma;
-}
-
 
 // [[Rcpp::export]]
 NumericVector cpp_dbetapr(
@@ -118,10 +40,18 @@ NumericVector cpp_dbetapr(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
-    p[i] = logpdf_betapr(GETV(x, i), GETV(alpha, i),
-                         GETV(beta, i), GETV(sigma, i),
-                         throw_warning);
+  if (all_scalar({alpha.length(), beta.length(), sigma.length()})) {
+    BetaprFrozen dist(alpha[0], beta[0], sigma[0]);
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      p[i] = dist.pdf(x[i], true, warn);
+    });
+  } else {
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      p[i] = logpdf_betapr(GETV(x, i), GETV(alpha, i),
+                           GETV(beta, i), GETV(sigma, i),
+                           warn);
+    });
+  }
   
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -158,10 +88,11 @@ NumericVector cpp_pbetapr(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_betapr(GETV(x, i), GETV(alpha, i),
                       GETV(beta, i), GETV(sigma, i),
-                      throw_warning);
+                      warn);
+  });
   
   if (!lower_tail)
     p = 1.0 - p;
@@ -208,10 +139,11 @@ NumericVector cpp_qbetapr(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     q[i] = invcdf_betapr(GETV(pp, i), GETV(alpha, i),
                          GETV(beta, i), GETV(sigma, i),
-                         throw_warning);
+                         warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -237,9 +169,10 @@ NumericVector cpp_rbetapr(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_betapr(GETV(alpha, i), GETV(beta, i),
-                      GETV(sigma, i), throw_warning);
+                      GETV(sigma, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/birnbaum-saunders-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,86 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
- * Birnbaum-Saunders (Fatigue Life) Distribution
- * 
- * Support:
- * x > mu
- * 
- * Parameters:
- * mu
- * alpha > 0
- * beta > 0
- * 
- * 
- */
-
-inline double logpdf_fatigue(double x, double alpha, double beta,
-                             double mu, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta) || ISNAN(mu))
-    return x+alpha+beta+mu;
-#endif
-  if (alpha <= 0.0 || beta <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x <= mu || !R_FINITE(x))
-    return R_NegInf;
-  double z, zb, bz;
-  z = x-mu;
-  zb = sqrt(z/beta);
-  bz = sqrt(beta/z);
-  // (zb+bz)/(2.0*alpha*z) * phi((zb-bz)/alpha)
-  return log(zb+bz) - LOG_2F - log(alpha) - log(z) + lphi((zb-bz)/alpha);
-}
-
-inline double cdf_fatigue(double x, double alpha, double beta,
-                          double mu, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta) || ISNAN(mu))
-    return x+alpha+beta+mu;
-#endif
-  if (alpha <= 0.0 || beta <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x <= mu)
-    return 0.0;
-  double z, zb, bz;
-  z = x-mu;
-  zb = sqrt(z/beta);
-  bz = sqrt(beta/z);
-  return Phi((zb-bz)/alpha);
-}
-
-inline double invcdf_fatigue(double p, double alpha, double beta,
-                             double mu, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(alpha) || ISNAN(beta) || ISNAN(mu))
-    return p+alpha+beta+mu;
-#endif
-  if (alpha <= 0.0 || beta <= 0.0 || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (p == 0.0)
-    return mu;
-  double Zp = InvPhi(p);
-  return pow(alpha/2.0*Zp + sqrt(pow(alpha/2.0*Zp, 2.0) + 1.0), 2.0) * beta + mu;
-}
-
-inline double rng_fatigue(double alpha, double beta,
-                          double mu, bool& throw_warning) {
-  if (ISNAN(alpha) || ISNAN(beta) || ISNAN(mu) || alpha <= 0.0 || beta <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double z = R::norm_rand();
-  return pow(alpha/2.0*z + sqrt(pow(alpha/2.0*z, 2.0) + 1.0), 2.0) * beta + mu;
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dfatigue(
     const NumericVector& x,
@@ -117,10 +38,11 @@ NumericVector cpp_dfatigue(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = logpdf_fatigue(GETV(x, i), GETV(alpha, i),
                           GETV(beta, i), GETV(mu, i),
-                          throw_warning);
+                          warn);
+  });
   
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -157,10 +79,11 @@ NumericVector cpp_pfatigue(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_fatigue(GETV(x, i), GETV(alpha, i),
                        GETV(beta, i), GETV(mu, i),
-                       throw_warning);
+                       warn);
+  });
   
   if (!lower_tail)
     p = 1.0 - p;
@@ -207,10 +130,11 @@ NumericVector cpp_qfatigue(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     q[i] = invcdf_fatigue(GETV(pp, i), GETV(alpha, i),
                           GETV(beta, i), GETV(mu, i),
-                          throw_warning);
+                          warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -236,9 +160,10 @@ NumericVector cpp_rfatigue(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_fatigue(GETV(alpha, i), GETV(beta, i),
-                       GETV(mu, i), throw_warning);
+                       GETV(mu, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/bivariate-poisson-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -14,59 +15,6 @@ using Rcpp::NumericVector;
 using Rcpp::NumericMatrix;
 
 
-inline double logpmf_bpois(double x, double y, double a, double b, double c,
-                           bool& throw_warning) {
-  
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(y) || ISNAN(a) || ISNAN(b) || ISNAN(c))
-    return x+y+a+b+c;
-#endif
-  
-  if (a < 0.0 || b < 0.0 || c < 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  
-  if (!isInteger(x) || x < 0.0 || !R_FINITE(x) ||
-      !R_FINITE(y) || !isInteger(y)) {
-      return R_NegInf;
-  }
-  
-  if (y < 0.0)
-    return R_NegInf;
-  
-  // exp(-(a+b+c))
-  double tmp = -(a+b+c); 
-  // tmp *= (pow(a, x) / factorial(x)) * (pow(b, y) / factorial(y));
-  tmp += (log(a) * x - lfactorial(x)) + (log(b) * y - lfactorial(y));
-  
-  double minxy = static_cast<int>( (x < y) ? x : y );
-  // c_ab = c/(a*b)
-  double lc_ab = log(c) - log(a) - log(b);
-  
-  double dk;
-  double mx = R_NegInf;
-  std::vector<double> ls(minxy+1);
-  
-  for (int k = 0; k <= minxy; k++) {
-    dk = static_cast<double>(k);
-    // xy += R::choose(x, k) * R::choose(y, k) * factorial(k) * pow(c_ab, k);
-    ls[k] = R::lchoose(x, dk) + R::lchoose(y, dk) + lfactorial(dk) + lc_ab * dk;
-    if (ls[k] > mx)
-      mx = ls[k];
-  }
-  
-  double xy = 0.0;
-  
-  for (int k = 0; k <= minxy; k++)
-    xy += exp(ls[k] - mx);    // log-sum-exp trick
-  
-  xy = log(xy) + mx;
-  
-  return tmp + xy;
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dbpois(
     const NumericVector& x,
@@ -97,9 +45,10 @@ NumericVector cpp_dbpois(
   if (x.length() != y.length())
     Rcpp::stop("lengths of x and y differ");
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = logpmf_bpois(GETV(x, i), GETV(y, i), GETV(a, i),
-                        GETV(b, i), GETV(c, i), throw_warning);
+                        GETV(b, i), GETV(c, i), warn);
+  });
   
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -127,24 +76,23 @@ NumericMatrix cpp_rbpois(
   }
   
   NumericMatrix x(n, 2);
-  double u, v, w;
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++) {
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     if (ISNAN(GETV(a, i)) || ISNAN(GETV(b, i)) || ISNAN(GETV(c, i)) || 
         GETV(a, i) < 0.0 || GETV(b, i) < 0.0 || GETV(c, i) < 0.0) {
-      throw_warning = true;
+      warn = true;
       x(i, 0) = NA_REAL;
       x(i, 1) = NA_REAL;
     } else {
-      u = R::rpois(GETV(a, i));
-      v = R::rpois(GETV(b, i));
-      w = R::rpois(GETV(c, i));
+      double u = rng_pois(GETV(a, i));
+      double v = rng_pois(GETV(b, i));
+      double w = rng_pois(GETV(c, i));
       x(i, 0) = u+w;
       x(i, 1) = v+w;
     }
-  }
+  });
 
   if (throw_warning)
     Rcpp::warning("NAs produced");
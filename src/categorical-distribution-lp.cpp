@@ -1,37 +1,86 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/categorical-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
 using std::log;
+using std::exp;
 using Rcpp::NumericVector;
 using Rcpp::NumericMatrix;
 
 
 /*
- * 
  *
- * Random generation from categorical distribution using Gumbel-max trick
- * 
  * Random generation from categorical distribution given log-probabilities.
- * 
+ *
  * Given vector of log-probabilities gamma[1], ..., gamma[k], where each
- * gamma[i] = log(prob[i]) + constant, then it is possible to taking 
- * 
- * x = argmax[i]( gamma[i] + g[i] )
- * 
- * where g[1], ..., g[k] is a sample from standard Gumbel distribution.
- * 
- * 
- * References:
- * 
- * Maddison, C. J., Tarlow, D., & Minka, T. (2014). A* sampling.
- * [In:] Advances in Neural Information Processing Systems (pp. 3086-3094).
- * 
- * 
+ * gamma[i] = log(prob[i]) + constant, the values are shifted by their
+ * maximum, so that exp(gamma[i] - max) are finite, unnormalized weights
+ * of the categories in [0, 1].
+ *
+ * When all the rows of log_prob are the same, the weights are used for
+ * building an alias table once and each draw takes O(1) time, otherwise
+ * the draws use the inverse cdf method with a single uniform for each.
+ *
  */
 
 
+// the first category with maximal log-probability, or -1 for NaN's
+
+int lp_row_max(const NumericMatrix& log_prob, int i, double& mx) {
+  int k = log_prob.ncol();
+  int jmax = 0;
+  mx = -INFINITY;
+  for (int j = 0; j < k; j++) {
+    double lp = GETM(log_prob, i, j);
+    if (ISNAN(lp))
+      return -1;
+    if (lp > mx) {
+      mx = lp;
+      jmax = j;
+    }
+  }
+  return jmax;
+}
+
+int rng_catlp_row(const NumericMatrix& log_prob, int i, bool& throw_warning) {
+  
+  int k = log_prob.ncol();
+  double mx;
+  int jmax = lp_row_max(log_prob, i, mx);
+  
+  if (jmax < 0) {
+    throw_warning = true;
+    return -1;
+  }
+  
+  // all log-probabilities are -Inf, or some are +Inf
+  if (mx == R_NegInf || mx == R_PosInf)
+    return jmax;
+  
+  double total = 0.0;
+  for (int j = 0; j < k; j++)
+    total += exp(GETM(log_prob, i, j) - mx);
+  
+  double u = rng_unif() * total;
+  double cs = 0.0;
+  int last = jmax;
+  for (int j = 0; j < k; j++) {
+    double w = exp(GETM(log_prob, i, j) - mx);
+    if (w <= 0.0)
+      continue;
+    cs += w;
+    last = j;
+    if (u < cs)
+      return j;
+  }
+  
+  // u >= cs only due to rounding errors
+  return last;
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_rcatlp(
     const int& n,
@@ -45,42 +94,41 @@ NumericVector cpp_rcatlp(
   
   NumericVector x(n);
   int k = log_prob.ncol();
-  double u, glp, max_val;
-  int jj;
   
   bool throw_warning = false;
-  bool wrong_prob = false;
   
-  for (int i = 0; i < n; i++) {
+  if (log_prob.nrow() == 1 || identical_rows(log_prob)) {
     
-    max_val = -INFINITY;
-    jj = 0;
+    double mx;
+    int jmax = lp_row_max(log_prob, 0, mx);
     
-    for (int j = 0; j < k; j++) {
-      
-      wrong_prob = false;
-      
-      if (ISNAN(GETM(log_prob, i, j))) {
-        throw_warning = wrong_prob = true;
-        break;
-      }
-      
-      u = R::exp_rand(); // -log(rng_unif())
-      glp = -log(u) + GETM(log_prob, i, j); 
-      if (glp > max_val) {
-        max_val = glp;
-        jj = j;
-      }
-      
+    if (jmax < 0) {
+      Rcpp::warning("NAs produced");
+      return NumericVector(n, NA_REAL);
     }
     
-    if (wrong_prob) {
-      x[i] = NA_REAL;
-    } else {
-      x[i] = static_cast<double>(jj);
-    }
+    if (mx == R_NegInf || mx == R_PosInf)
+      return NumericVector(n, static_cast<double>(jmax));
+    
+    std::vector<double> w(k);
+    for (int j = 0; j < k; j++)
+      w[j] = exp(log_prob(0, j) - mx);
+    
+    AliasTable table;
+    table.build(w.data(), k);
+    
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+      x[i] = static_cast<double>(table.draw());
+    });
+    
+    return x;
   }
   
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+    int j = rng_catlp_row(log_prob, i, warn);
+    x[i] = (j < 0) ? NA_REAL : static_cast<double>(j);
+  });
+  
   if (throw_warning)
     Rcpp::warning("NAs produced");
   
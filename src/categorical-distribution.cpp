@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/categorical-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -27,6 +28,115 @@ using Rcpp::NumericMatrix;
 */
 
 
+// sum of the weights in the i-th row, NaN if any of them is negative
+
+double row_total(const NumericMatrix& prob, int i, bool& throw_warning) {
+  double p_tot = 0.0;
+  for (int j = 0; j < prob.ncol(); j++) {
+    p_tot += prob(i, j);
+#ifdef IEEE_754
+    if (ISNAN(p_tot))
+      break;
+#endif
+    if (prob(i, j) < 0.0) {
+      p_tot = NAN;
+      throw_warning = true;
+      break;
+    }
+  }
+  return p_tot;
+}
+
+
+/*
+ * Normalized (or cumulative) rows of the prob matrix
+ *
+ * The rows are normalized lazily, only when they are used, and the
+ * matrix is never copied as a whole. If the rows are revisited (there
+ * are more values than rows, or all the rows are the same so only the
+ * first one is used) they are computed once and kept, otherwise a single
+ * row buffer is reused.
+ *
+ */
+
+class CatTable {
+
+  const NumericMatrix& prob;
+  bool& throw_warning;
+  int k, nrow;
+  bool keep;
+  std::vector<double> totals;
+  std::vector<char> has_total;
+  std::vector< std::vector<double> > rows;
+  std::vector<double> buffer;
+  int buffer_row;
+
+  int row_index(int i) const {
+    return (nrow == 1) ? 0 : i % nrow;
+  }
+
+  void fill_cumulative(double* out, int r) {
+    double p_tot = total(r);
+    out[0] = prob(r, 0) / p_tot;
+    for (int j = 1; j < k; j++) {
+      out[j] = prob(r, j) / p_tot;
+      out[j] += out[j-1];
+    }
+  }
+
+public:
+
+  CatTable(const NumericMatrix& prob, int n, bool& throw_warning)
+    : prob(prob), throw_warning(throw_warning), k(prob.ncol()),
+      nrow(prob.nrow()), buffer_row(-1) {
+    if (nrow > 1 && identical_rows(prob))
+      nrow = 1;
+    keep = n > nrow;
+    totals.resize(nrow);
+    has_total.assign(nrow, 0);
+  }
+
+  // sum of the weights in the (i % nrow)-th row
+
+  double total(int i) {
+    int r = row_index(i);
+    if (!has_total[r]) {
+      totals[r] = row_total(prob, r, throw_warning);
+      has_total[r] = 1;
+    }
+    return totals[r];
+  }
+
+  // probability of the (j+1)-th category in the (i % nrow)-th row
+
+  double pmf(int i, int j) {
+    return prob(row_index(i), j) / total(i);
+  }
+
+  // cumulative probabilities of the (i % nrow)-th row
+
+  const double* cdf(int i) {
+    int r = row_index(i);
+    if (keep) {
+      if (rows.empty())
+        rows.resize(nrow);
+      if (rows[r].empty()) {
+        rows[r].resize(k);
+        fill_cumulative(rows[r].data(), r);
+      }
+      return rows[r].data();
+    }
+    if (buffer_row != r) {
+      buffer.resize(k);
+      fill_cumulative(buffer.data(), r);
+      buffer_row = r;
+    }
+    return buffer.data();
+  }
+
+};
+
+
 // [[Rcpp::export]]
 NumericVector cpp_dcat(
     const NumericVector& x,
@@ -44,32 +154,13 @@ NumericVector cpp_dcat(
   });
   int k = prob.ncol();
   NumericVector p(Nmax);
-  double p_tot;
   
   bool throw_warning = false;
   
   if (k < 2)
     Rcpp::stop("number of columns in prob is < 2");
   
-  NumericMatrix prob_tab = Rcpp::clone(prob);
-  
-  for (int i = 0; i < prob.nrow(); i++) {
-    p_tot = 0.0;
-    for (int j = 0; j < k; j++) {
-      p_tot += prob_tab(i, j);
-#ifdef IEEE_754
-      if (ISNAN(p_tot))
-        break;
-#endif
-      if (prob_tab(i, j) < 0.0) {
-        p_tot = NAN;
-        throw_warning = true;
-        break;
-      }
-    }
-    for (int j = 0; j < k; j++)
-      prob_tab(i, j) /= p_tot;
-  }
+  CatTable prob_tab(prob, Nmax, throw_warning);
   
   for (int i = 0; i < Nmax; i++) {
 #ifdef IEEE_754
@@ -87,7 +178,7 @@ NumericVector cpp_dcat(
       Rcpp::warning("NAs introduced by coercion to integer range");
       p[i] = NA_REAL;
     }
-    p[i] = GETM(prob_tab, i, to_pos_int(GETV(x, i)) - 1);
+    p[i] = prob_tab.pmf(i, to_pos_int(GETV(x, i)) - 1);
   }
 
   if (log_prob)
@@ -117,35 +208,13 @@ NumericVector cpp_pcat(
   });
   int k = prob.ncol();
   NumericVector p(Nmax);
-  double p_tot;
   
   bool throw_warning = false;
 
   if (k < 2)
     Rcpp::stop("number of columns in prob is < 2");
   
-  NumericMatrix prob_tab = Rcpp::clone(prob);
-  
-  for (int i = 0; i < prob.nrow(); i++) {
-    p_tot = 0.0;
-    for (int j = 0; j < k; j++) {
-      p_tot += prob_tab(i, j);
-#ifdef IEEE_754
-      if (ISNAN(p_tot))
-        break;
-#endif
-      if (prob_tab(i, j) < 0.0) {
-        p_tot = NAN;
-        throw_warning = true;
-        break;
-      }
-    }
-    prob_tab(i, 0) /= p_tot;
-    for (int j = 1; j < k; j++) {
-      prob_tab(i, j) /= p_tot;
-      prob_tab(i, j) += prob_tab(i, j-1);
-    }
-  }
+  CatTable prob_tab(prob, Nmax, throw_warning);
   
   for (int i = 0; i < Nmax; i++) {
 #ifdef IEEE_754
@@ -166,7 +235,7 @@ NumericVector cpp_pcat(
       Rcpp::warning("NAs introduced by coercion to integer range");
       p[i] = NA_REAL;
     }
-    p[i] = GETM(prob_tab, i, to_pos_int(GETV(x, i)) - 1);
+    p[i] = prob_tab.cdf(i)[to_pos_int(GETV(x, i)) - 1];
   }
 
   if (!lower_tail)
@@ -202,7 +271,6 @@ NumericVector cpp_qcat(
   NumericVector x(Nmax);
   NumericVector pp = Rcpp::clone(p);
   int jj;
-  double p_tot;
   
   bool throw_warning = false;
   
@@ -215,28 +283,7 @@ NumericVector cpp_qcat(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  NumericMatrix prob_tab = Rcpp::clone(prob);
-  
-  for (int i = 0; i < prob.nrow(); i++) {
-    p_tot = 0.0;
-    for (int j = 0; j < k; j++) {
-      p_tot += prob_tab(i, j);
-#ifdef IEEE_754
-      if (ISNAN(p_tot))
-        break;
-#endif
-      if (prob_tab(i, j) < 0.0) {
-        p_tot = NAN;
-        throw_warning = true;
-        break;
-      }
-    }
-    prob_tab(i, 0) /= p_tot;
-    for (int j = 1; j < k; j++) {
-      prob_tab(i, j) /= p_tot;
-      prob_tab(i, j) += prob_tab(i, j-1);
-    }
-  }
+  CatTable prob_tab(prob, Nmax, throw_warning);
   
   for (int i = 0; i < Nmax; i++) {
 #ifdef IEEE_754
@@ -245,8 +292,9 @@ NumericVector cpp_qcat(
       continue;
     }
 #endif
-    if (ISNAN(GETM(prob_tab, i, 0))) {
-      x[i] = GETM(prob_tab, i, 0);
+    const double* cdf = prob_tab.cdf(i);
+    if (ISNAN(cdf[0])) {
+      x[i] = cdf[0];
       continue;
     }
     if (GETV(p, i) < 0.0 || GETV(p, i) > 1.0) {
@@ -263,13 +311,11 @@ NumericVector cpp_qcat(
       continue;
     }
     
-    jj = 1;
-    for (int j = 0; j < k; j++) {
-      if (GETM(prob_tab, i, j) >= GETV(p, i)) {
-        jj = j+1;
-        break;
-      }
-    }
+    // first category with cdf >= p, the last one if p exceeds
+    // the total due to rounding errors
+    jj = std::lower_bound(cdf, cdf + k, GETV(p, i)) - cdf + 1;
+    if (jj > k)
+      jj = k;
     x[i] = to_dbl(jj);
   }
   
@@ -293,13 +339,37 @@ NumericVector cpp_rcat(
   
   int k = prob.ncol();
   NumericVector x(n);
-  int jj;
-  double u, p_tot;
+  double p_tot;
   
   bool throw_warning = false;
   
   if (k < 2)
     Rcpp::stop("number of columns in prob is < 2");
+  
+  // the same probabilities for all the draws, O(1) per draw
+  
+  if (prob.nrow() == 1 || identical_rows(prob)) {
+    
+    p_tot = row_total(prob, 0, throw_warning);
+    
+    if (ISNAN(p_tot) || p_tot == 0.0 || p_tot == R_PosInf) {
+      if (throw_warning || p_tot == R_PosInf)
+        Rcpp::warning("NAs produced");
+      return NumericVector(n, ISNAN(p_tot) ? p_tot : NAN);
+    }
+    
+    AliasTable table;
+    table.build(&prob(0, 0), k, prob.nrow());
+    
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+      x[i] = to_dbl(table.draw() + 1);
+    });
+    
+    if (throw_warning)
+      Rcpp::warning("NAs produced");
+    
+    return x;
+  }
 
   NumericMatrix prob_tab = Rcpp::clone(prob);
   
@@ -322,14 +392,14 @@ NumericVector cpp_rcat(
     }
   }
   
-  for (int i = 0; i < n; i++) {
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     if (ISNAN(GETM(prob_tab, i , 0))) {
       x[i] = GETM(prob_tab, i, 0);
-      continue;
+      return;
     }
     
-    u = rng_unif();
-    jj = 1;
+    double u = rng_unif();
+    int jj = 1;
     
     for (int j = 0; j < k; j++) {
       if (GETM(prob_tab, i, j) >= u) {
@@ -338,7 +408,7 @@ NumericVector cpp_rcat(
       }
     }
     x[i] = to_dbl(jj);
-  }
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
@@ -93,14 +93,14 @@ NumericVector cpp_ddirichlet(
       p_tmp = 0.0;
       
       for (int j = 0; j < m; j++) {
-        prod_gamma += R::lgammafn(GETM(alpha, i, j));
+        prod_gamma += lgamma_fn(GETM(alpha, i, j));
         p_tmp += log(GETM(x, i, j)) * (GETM(alpha, i, j) - 1.0);
         
         if (GETM(alpha, i, j) == 1.0 && GETM(x, i, j) == 0.0)
           p_tmp = R_NegInf;
       }
       
-      beta_const = prod_gamma - R::lgammafn(sum_alpha);
+      beta_const = prod_gamma - lgamma_fn(sum_alpha);
       p[i] = p_tmp - beta_const;
     }
   }
@@ -115,6 +115,39 @@ NumericVector cpp_ddirichlet(
 }
 
 
+// Dirichlet draw into the i-th row of x, gamma(j) returns the sampler
+// of the j-th component. If some of the shapes are < 1, the gamma variables
+// are drawn in log scale and normalized by the largest of them, so the row
+// does not become 0/0 when all of them underflow.
+
+template <typename Sampler>
+inline void rng_dirichlet_row(NumericMatrix& x, int i, int k,
+                              bool log_scale, Sampler gamma) {
+  double row_sum = 0.0;
+  
+  if (log_scale) {
+    double lmax = R_NegInf;
+    for (int j = 0; j < k; j++) {
+      x(i, j) = gamma(j).log_draw();
+      if (x(i, j) > lmax)
+        lmax = x(i, j);
+    }
+    for (int j = 0; j < k; j++) {
+      x(i, j) = exp(x(i, j) - lmax);
+      row_sum += x(i, j);
+    }
+  } else {
+    for (int j = 0; j < k; j++) {
+      x(i, j) = gamma(j).draw();
+      row_sum += x(i, j);
+    }
+  }
+  
+  for (int j = 0; j < k; j++)
+    x(i, j) /= row_sum;
+}
+
+
 // [[Rcpp::export]]
 NumericMatrix cpp_rdirichlet(
     const int& n,
@@ -136,34 +169,58 @@ NumericMatrix cpp_rdirichlet(
   if (k < 2)
     Rcpp::stop("number of columns in alpha should be >= 2");
   
-  double row_sum, sum_alpha;
-  bool wrong_values;
-
-  for (int i = 0; i < n; i++) {
-    sum_alpha = 0.0;
-    row_sum = 0.0;
-    wrong_values = false;
+  // the same parameters for all the rows, the samplers are set up once
+  
+  if (alpha.nrow() == 1 || identical_rows(alpha)) {
+    
+    std::vector<GammaSampler> gamma;
+    double sum_alpha = 0.0;
+    double min_alpha = R_PosInf;
+    
+    for (int j = 0; j < k; j++) {
+      sum_alpha += alpha(0, j);
+      min_alpha = std::min(min_alpha, alpha(0, j));
+      gamma.push_back(GammaSampler(alpha(0, j)));
+    }
+    
+    if (ISNAN(sum_alpha) || min_alpha <= 0.0) {
+      if (n > 0)
+        Rcpp::warning("NAs produced");
+      std::fill(x.begin(), x.end(), NA_REAL);
+      return x;
+    }
+    
+    bool log_scale = min_alpha < 1.0;
+    
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+      rng_dirichlet_row(x, i, k, log_scale, [&](int j) -> const GammaSampler& {
+        return gamma[j];
+      });
+    });
+    
+    return x;
+  }
+  
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+    double sum_alpha = 0.0;
+    double min_alpha = R_PosInf;
 
     for (int j = 0; j < k; j++) {
       sum_alpha += GETM(alpha, i, j);
-      if (GETM(alpha, i, j) <= 0.0) {
-        wrong_values = true;
-        break;
-      }
-      
-      x(i, j) = R::rgamma(GETM(alpha, i, j), 1.0);
-      row_sum += x(i, j);
+      min_alpha = std::min(min_alpha, GETM(alpha, i, j));
     }
 
-    if (ISNAN(sum_alpha) || wrong_values) {
-      throw_warning = true;
+    if (ISNAN(sum_alpha) || min_alpha <= 0.0) {
+      warn = true;
       for (int j = 0; j < k; j++)
         x(i, j) = NA_REAL;
-    } else {
-      for (int j = 0; j < k; j++)
-        x(i, j) /= row_sum;
+      return;
     }
-  }
+    
+    rng_dirichlet_row(x, i, k, min_alpha < 1.0, [&](int j) {
+      return GammaSampler(GETM(alpha, i, j));
+    });
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
@@ -103,12 +103,12 @@ NumericVector cpp_ddirmnom(
     } else {
       
       for (int j = 0; j < k; j++) {
-        prod_tmp += R::lgammafn(GETM(x, i, j) + GETM(alpha, i, j)) -
-          (lfactorial(GETM(x, i, j)) + R::lgammafn(GETM(alpha, i, j)));
+        prod_tmp += lgamma_fn(GETM(x, i, j) + GETM(alpha, i, j)) -
+          (lfactorial(GETM(x, i, j)) + lgamma_fn(GETM(alpha, i, j)));
       }
       
-      p[i] = (lfactorial(GETV(size, i)) + R::lgammafn(sum_alpha)) -
-        R::lgammafn(GETV(size, i) + sum_alpha) + prod_tmp;
+      p[i] = (lfactorial(GETV(size, i)) + lgamma_fn(sum_alpha)) -
+        lgamma_fn(GETV(size, i) + sum_alpha) + prod_tmp;
     }
   }
   
@@ -146,48 +146,60 @@ NumericMatrix cpp_rdirmnom(
   if (k < 2)
     Rcpp::stop("Number of columns in alpha should be >= 2");
   
-  double size_left, row_sum, sum_p, p_tmp, sum_alpha;
-  bool wrong_values;
-  
-  for (int i = 0; i < n; i++) {
-    size_left = GETV(size, i);
-    row_sum = 0.0;
-    wrong_values = false;
-    NumericVector pi(k);
-    sum_alpha = 0.0;
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+    double size_left = GETV(size, i);
+    double row_sum = 0.0;
+    bool wrong_values = false;
+    std::vector<double> pi(k);
+    double sum_alpha = 0.0;
+    double min_alpha = R_PosInf;
     
     for (int j = 0; j < k; j++) {
       sum_alpha += GETM(alpha, i, j);
-      
-      if (GETM(alpha, i, j) <= 0.0) {
-        wrong_values = true;
-        break;
+      min_alpha = std::min(min_alpha, GETM(alpha, i, j));
+    }
+    
+    if (min_alpha <= 0.0) {
+      wrong_values = true;
+    } else if (min_alpha < 1.0) {
+      // in log scale, so that pi is not 0/0 when all the gammas underflow
+      double lmax = R_NegInf;
+      for (int j = 0; j < k; j++) {
+        pi[j] = GammaSampler(GETM(alpha, i, j)).log_draw();
+        lmax = std::max(lmax, pi[j]);
+      }
+      for (int j = 0; j < k; j++) {
+        pi[j] = exp(pi[j] - lmax);
+        row_sum += pi[j];
+      }
+    } else {
+      for (int j = 0; j < k; j++) {
+        pi[j] = rng_gamma(GETM(alpha, i, j), 1.0);
+        row_sum += pi[j];
       }
-
-      pi[j] = R::rgamma(GETM(alpha, i, j), 1.0);
-      row_sum += pi[j];
     }
     
     if (wrong_values || ISNAN(sum_alpha + GETV(size, i)) ||
         GETV(size, i) < 0.0 || !isInteger(GETV(size, i), false)) {
-      throw_warning = true;
+      warn = true;
       for (int j = 0; j < k; j++)
         x(i, j) = NA_REAL;
-      continue;
+      return;
     }
     
     if (GETV(size, i) == 0.0) {
       for (int j = 0; j < k; j++)
         x(i, j) = 0.0;
-      continue;
+      return;
     } 
     
-    sum_p = 1.0;
+    double sum_p = 1.0;
+    double p_tmp;
     
     for (int j = 0; j < k-1; j++) {
       if ( size_left > 0.0 ) {
         p_tmp = pi[j] / row_sum;
-        x(i, j) = R::rbinom(size_left, trunc_p(p_tmp/sum_p));
+        x(i, j) = rng_binom(size_left, trunc_p(p_tmp/sum_p));
         size_left -= x(i, j);
         sum_p -= p_tmp;
       } else {
@@ -197,7 +209,7 @@ NumericMatrix cpp_rdirmnom(
     
     x(i, k-1) = size_left;
     
-  }
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
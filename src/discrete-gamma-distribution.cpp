@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/discrete-gamma-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,36 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
-* Discrete normal distribution
-* 
-* Values:
-* x
-* 
-* Parameters
-* mu
-* sigma > 0
-*  
-*/
-
-
-inline double pmf_dgamma(double x, double shape, double scale,
-                         bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(shape) || ISNAN(scale))
-    return x+shape+scale;
-#endif
-  if (shape <= 0.0 || scale <= 0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0 || !isInteger(x))
-    return 0.0;
-  return R::pgamma(x+1.0, shape, scale, true, false) -
-    R::pgamma(x, shape, scale, true, false);
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_ddgamma(
     const NumericVector& x,
@@ -64,9 +35,10 @@ NumericVector cpp_ddgamma(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = pmf_dgamma(GETV(x, i), GETV(shape, i),
-                      GETV(scale, i), throw_warning);
+                      GETV(scale, i), warn);
+  });
   
   if (log_prob)
     p = Rcpp::log(p);
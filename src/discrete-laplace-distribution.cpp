@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/discrete-laplace-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -15,55 +16,6 @@ using Rcpp::NumericVector;
 using std::log1p;
 
 
-inline double logpmf_dlaplace(double x, double p, double mu,
-                              bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(p) || ISNAN(mu))
-    return x+p+mu;
-#endif
-  if (p <= 0.0 || p >= 1.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (!isInteger(x))
-    return R_NegInf;
-  // (1.0-p)/(1.0+p) * pow(p, abs(x-mu));
-  return log1p(-p) - log1p(p) + log(p) * abs(x-mu);
-} 
-
-inline double cdf_dlaplace(double x, double p, double mu,
-                           bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(p) || ISNAN(mu))
-    return x+p+mu;
-#endif
-  if (p <= 0.0 || p >= 1.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0) {
-    // pow(p, -floor(x-mu))/(1.0+p);
-    return exp( (log(p) * -floor(x-mu)) - log1p(p) );
-  } else {
-    // 1.0 - (pow(p, floor(x-mu)+1.0)/(1.0+p))
-    return 1.0 - exp( log(p) * (floor(x-mu)+1.0) - log1p(p) );
-  }
-} 
-
-inline double rng_dlaplace(double p, double mu,
-                           bool& throw_warning) {
-  if (ISNAN(p) || ISNAN(mu) || p <= 0.0 || p >= 1.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double q, u, v;
-  q = 1.0 - p;
-  u = R::rgeom(q); 
-  v = R::rgeom(q); 
-  return u-v + mu;
-} 
-
-
 // [[Rcpp::export]]
 NumericVector cpp_ddlaplace(
     const NumericVector& x,
@@ -85,9 +37,10 @@ NumericVector cpp_ddlaplace(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = logpmf_dlaplace(GETV(x, i), GETV(scale, i),
-                           GETV(location, i), throw_warning);
+                           GETV(location, i), warn);
+  });
   
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -121,9 +74,10 @@ NumericVector cpp_pdlaplace(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_dlaplace(GETV(x, i), GETV(scale, i),
-                        GETV(location, i), throw_warning);
+                        GETV(location, i), warn);
+  });
   
   if (!lower_tail)
     p = 1.0 - p;
@@ -154,9 +108,10 @@ NumericVector cpp_rdlaplace(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_dlaplace(GETV(scale, i), GETV(location, i),
-                        throw_warning);
+                        warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
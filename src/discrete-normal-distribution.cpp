@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/discrete-normal-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,36 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
-* Discrete normal distribution
-* 
-* Values:
-* x
-* 
-* Parameters
-* mu
-* sigma > 0
-*  
-*/
-
-
-inline double pmf_dnorm(double x, double mu, double sigma,
-                        bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
-    return x+mu+sigma;
-#endif
-  if (sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (!isInteger(x))
-    return 0.0;
-  return R::pnorm(x+1.0, mu, sigma, true, false) -
-         R::pnorm(x, mu, sigma, true, false);
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_ddnorm(
     const NumericVector& x,
@@ -64,9 +35,10 @@ NumericVector cpp_ddnorm(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = pmf_dnorm(GETV(x, i), GETV(mu, i),
-                     GETV(sigma, i), throw_warning);
+                     GETV(sigma, i), warn);
+  });
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/discrete-uniform-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,83 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
- * Discrete uniform distribution
- * 
- * Values:
- * a <= x <= b
- * 
- * f(x) = 1/(b-a+1)
- * F(x) = (floor(x)-a+1)/b-a+1
- *  
- */
-
-
-inline double pmf_dunif(double x, double min, double max,
-                        bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(min) || ISNAN(max))
-    return x+min+max;
-#endif
-  if (min > max || !R_FINITE(min) || !R_FINITE(max) ||
-      !isInteger(min, false) || !isInteger(max, false)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < min || x > max || !isInteger(x))
-    return 0.0;
-  return 1.0/(max-min+1.0);
-}
-
-
-inline double cdf_dunif(double x, double min, double max,
-                        bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(min) || ISNAN(max))
-    return x+min+max;
-#endif
-  if (min > max || !R_FINITE(min) || !R_FINITE(max) ||
-      !isInteger(min, false) || !isInteger(max, false)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < min)
-    return 0.0;
-  else if (x >= max)
-    return 1.0;
-  return (floor(x)-min+1.0)/(max-min+1.0);
-}
-
-inline double invcdf_dunif(double p, double min, double max,
-                           bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(min) || ISNAN(max))
-    return p+min+max;
-#endif
-  if (min > max || !R_FINITE(min) || !R_FINITE(max) ||
-      !isInteger(min, false) || !isInteger(max, false) ||
-      !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (p == 0 || min == max)
-    return min;
-  return ceil( p*(max-min+1.0)+min-1.0 );
-}
-
-inline double rng_dunif(double min, double max, bool& throw_warning) {
-  if (ISNAN(min) || ISNAN(max) ||
-      min > max || !R_FINITE(min) || !R_FINITE(max) ||
-      !isInteger(min, false) || !isInteger(max, false)) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  if (min == max)
-    return min;
-  return ceil(R::runif(min - 1.0, max));
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_ddunif(
     const NumericVector& x,
@@ -111,9 +35,10 @@ NumericVector cpp_ddunif(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = pmf_dunif(GETV(x, i), GETV(min, i),
-                     GETV(max, i), throw_warning);
+                     GETV(max, i), warn);
+  });
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -147,9 +72,10 @@ NumericVector cpp_pdunif(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_dunif(GETV(x, i), GETV(min, i),
-                     GETV(max, i), throw_warning);
+                     GETV(max, i), warn);
+  });
   
   if (!lower_tail)
     p = 1.0 - p;
@@ -193,9 +119,10 @@ NumericVector cpp_qdunif(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     q[i] = invcdf_dunif(GETV(pp, i), GETV(min, i),
-                        GETV(max, i), throw_warning);
+                        GETV(max, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -220,9 +147,10 @@ NumericVector cpp_rdunif(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_dunif(GETV(min, i), GETV(max, i),
-                     throw_warning);
+                     warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
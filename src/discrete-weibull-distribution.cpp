@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/discrete-weibull-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,83 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
-*  Discrete Weibull distribution
-*
-*  Values:
-*  x >= 0
-*
-*  Parameters:
-*  0 < q < 1
-*  beta
-*
-*  f(x)    = q^x^beta - q^(x+1)^beta
-*  F(x)    = 1-q^(x+1)^beta
-*  F^-1(p) = ceiling(pow(log(1-p)/log(q), 1/beta) - 1)
-*
-*  Nakagawa and Osaki (1975), "The Discrete Weibull Distribution",
-*  IEEE Transactions on Reliability, R-24, pp. 300-301.
-*
-*/
-
-inline double pdf_dweibull(double x, double q, double beta,
-                           bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(q) || ISNAN(beta))
-    return x+q+beta;
-#endif
-  if (q <= 0.0 || q >= 1.0 || beta <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (!isInteger(x) || x < 0.0)
-    return 0.0;
-  return pow(q, pow(x, beta)) - pow(q, pow(x+1.0, beta));
-}
-
-inline double cdf_dweibull(double x, double q, double beta,
-                           bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(q) || ISNAN(beta))
-    return x+q+beta;
-#endif
-  if (q <= 0.0 || q >= 1.0 || beta <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0)
-    return 0.0;
-  // 1.0 - pow(q, pow(x+1.0, beta))
-  return 1.0 - exp(log(q) * exp(log1p(x) * beta));
-}
-
-inline double invcdf_dweibull(double p, double q, double beta,
-                              bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(q) || ISNAN(beta))
-    return p+q+beta;
-#endif
-  if (q <= 0.0 || q >= 1.0 || beta <= 0.0 || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (p == 0.0)
-    return 0.0;
-  return ceil(pow(log(1.0 - p)/log(q), 1.0/beta) - 1.0);
-}
-
-inline double rng_dweibull(double q, double beta,
-                           bool& throw_warning) {
-  if (ISNAN(q) || ISNAN(beta) || q <= 0.0 || q >= 1.0 ||
-      beta <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double u = rng_unif();
-  return ceil(pow(log(u)/log(q), 1.0/beta) - 1.0);
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_ddweibull(
     const NumericVector& x,
@@ -111,9 +35,10 @@ NumericVector cpp_ddweibull(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = pdf_dweibull(GETV(x, i), GETV(q, i),
-                        GETV(beta, i), throw_warning);
+                        GETV(beta, i), warn);
+  });
 
   if (log_prob)
     p = Rcpp::log(p);
@@ -147,9 +72,10 @@ NumericVector cpp_pdweibull(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_dweibull(GETV(x, i), GETV(q, i),
-                        GETV(beta, i), throw_warning);
+                        GETV(beta, i), warn);
+  });
 
   if (!lower_tail)
     p = 1.0 - p;
@@ -193,9 +119,10 @@ NumericVector cpp_qdweibull(
   if (!lower_tail)
     pp = 1.0 - pp;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     x[i] = invcdf_dweibull(GETV(pp, i), GETV(q, i),
-                           GETV(beta, i), throw_warning);
+                           GETV(beta, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -220,9 +147,10 @@ NumericVector cpp_rdweibull(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_dweibull(GETV(q, i), GETV(beta, i),
-                        throw_warning);
+                        warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
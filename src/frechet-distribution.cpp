@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/frechet-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,85 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
- *  Frechet distribution
- *
- *  Values:
- *  x > mu
- *
- *  Parameters:
- *  lambda > 0
- *  mu
- *  sigma > 0
- *
- *  z       = (x-mu)/sigma
- *  f(x)    = lambda/sigma * z^{-1-lambda} * exp(-z^-lambda)
- *  F(x)    = exp(-z^-lambda)
- *  F^-1(p) = mu + sigma * -log(p)^{-1/lambda}
- *
- */
-
-
-inline double logpdf_frechet(double x, double lambda, double mu,
-                             double sigma, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(lambda) || ISNAN(mu) || ISNAN(sigma))
-    return x+lambda+mu+sigma;
-#endif
-  if (lambda <= 0.0 || sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x <= mu)
-    return R_NegInf;
-  double z = (x-mu)/sigma;
-  // lambda/sigma * pow(z, -1.0-lambda) * exp(-pow(z, -lambda));
-  return log(lambda) - log(sigma) + log(z) * (-1.0-lambda) - exp(log(z) * -lambda);
-}
-
-inline double cdf_frechet(double x, double lambda, double mu,
-                          double sigma, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(lambda) || ISNAN(mu) || ISNAN(sigma))
-    return x+lambda+mu+sigma;
-#endif
-  if (lambda <= 0.0 || sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x <= mu)
-    return 0.0;
-  double z = (x-mu)/sigma;
-  return exp(-pow(z, -lambda));
-}
-
-inline double invcdf_frechet(double p, double lambda, double mu,
-                             double sigma, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(lambda) || ISNAN(mu) || ISNAN(sigma))
-    return p+lambda+mu+sigma;
-#endif
-  if (lambda <= 0.0 || sigma <= 0.0 || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (p == 1.0)
-    return R_PosInf;
-  return mu + sigma * pow(-log(p), -1.0/lambda);
-}
-
-inline double rng_frechet(double lambda, double mu,
-                          double sigma, bool& throw_warning) {
-  if (ISNAN(lambda) || ISNAN(mu) || ISNAN(sigma) ||
-      lambda <= 0.0 || sigma <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double u = rng_unif();
-  return mu + sigma * pow(-log(u), -1.0/lambda);
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dfrechet(
     const NumericVector& x,
@@ -116,10 +38,11 @@ NumericVector cpp_dfrechet(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = logpdf_frechet(GETV(x, i), GETV(lambda, i),
                           GETV(mu, i), GETV(sigma, i),
-                          throw_warning);
+                          warn);
+  });
 
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -156,10 +79,11 @@ NumericVector cpp_pfrechet(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_frechet(GETV(x, i), GETV(lambda, i),
                        GETV(mu, i), GETV(sigma, i),
-                       throw_warning);
+                       warn);
+  });
 
   if (!lower_tail)
     p = 1.0 - p;
@@ -206,10 +130,11 @@ NumericVector cpp_qfrechet(
   if (!lower_tail)
     pp = 1.0 - pp;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     q[i] = invcdf_frechet(GETV(pp, i), GETV(lambda, i),
                           GETV(mu, i), GETV(sigma, i),
-                          throw_warning);
+                          warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -235,9 +160,10 @@ NumericVector cpp_rfrechet(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_frechet(GETV(lambda, i), GETV(mu, i),
-                       GETV(sigma, i), throw_warning);
+                       GETV(sigma, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
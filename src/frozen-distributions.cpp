@@ -0,0 +1,238 @@
+#include <Rcpp.h>
+#include "shared.h"
+#include "../inst/include/extraDistr/huber-distribution.h"
+#include "../inst/include/extraDistr/truncated-normal-distribution.h"
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::plugins(cpp11)]]
+
+using Rcpp::NumericVector;
+
+
+/*
+ * Frozen distributions
+ *
+ * Distributions with fixed (scalar) parameters, stored in external
+ * pointers. The constants that depend only on the parameters are
+ * computed once, when the object is created (see TnormFrozen and
+ * HuberFrozen), the d/p/q/r functions below evaluate them for vectors
+ * of values.
+ *
+ * With chunk > 0 the random values are generated in chunks of that size
+ * into a buffer that is reused, so drawing a few values at a time does
+ * not pay the per-call costs each time.
+ *
+ */
+
+class FrozenDistribution {
+
+  std::vector<double> buffer;
+  size_t next;
+
+protected:
+
+  virtual void fill_rng(double* x, int n, bool& throw_warning) const = 0;
+
+public:
+
+  int chunk;
+
+  FrozenDistribution(int chunk) : next(0), chunk(chunk) {}
+  virtual ~FrozenDistribution() {}
+
+  virtual void pdf(const NumericVector& x, NumericVector& p,
+                   bool log_prob, bool& throw_warning) const = 0;
+  virtual void cdf(const NumericVector& x, NumericVector& p,
+                   bool lower_tail, bool log_prob,
+                   bool& throw_warning) const = 0;
+  virtual void invcdf(const NumericVector& p, NumericVector& x,
+                      bool lower_tail, bool log_prob,
+                      bool& throw_warning) const = 0;
+
+  void rng(NumericVector& x, bool& throw_warning) {
+    int n = x.length();
+    if (chunk < 1) {
+      fill_rng(x.begin(), n, throw_warning);
+      return;
+    }
+    for (int i = 0; i < n; i++) {
+      if (next >= buffer.size()) {
+        buffer.resize(chunk);
+        fill_rng(buffer.data(), chunk, throw_warning);
+        next = 0;
+      }
+      x[i] = buffer[next++];
+    }
+  }
+
+};
+
+
+template <typename Dist>
+class Frozen : public FrozenDistribution {
+
+  Dist dist;
+
+protected:
+
+  void fill_rng(double* x, int n, bool& throw_warning) const {
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+      x[i] = dist.rng(warn);
+    });
+  }
+
+public:
+
+  Frozen(const Dist& dist, int chunk)
+    : FrozenDistribution(chunk), dist(dist) {}
+
+  void pdf(const NumericVector& x, NumericVector& p,
+           bool log_prob, bool& throw_warning) const {
+    parallel_for(x.length(), throw_warning, [&](int i, bool& warn) {
+      p[i] = dist.pdf(x[i], log_prob, warn);
+    });
+  }
+
+  void cdf(const NumericVector& x, NumericVector& p,
+           bool lower_tail, bool log_prob,
+           bool& throw_warning) const {
+    parallel_for(x.length(), throw_warning, [&](int i, bool& warn) {
+      p[i] = dist.cdf(x[i], lower_tail, log_prob, warn);
+    });
+  }
+
+  void invcdf(const NumericVector& p, NumericVector& x,
+              bool lower_tail, bool log_prob,
+              bool& throw_warning) const {
+    parallel_for(p.length(), throw_warning, [&](int i, bool& warn) {
+      x[i] = dist.invcdf(p[i], lower_tail, log_prob, warn);
+    });
+  }
+
+};
+
+
+typedef Rcpp::XPtr<FrozenDistribution> FrozenPtr;
+
+FrozenDistribution* get_frozen(SEXP ptr) {
+  FrozenPtr xp(ptr);
+  if (xp.get() == NULL)
+    Rcpp::stop("invalid frozen distribution (it cannot be saved and restored)");
+  return xp.get();
+}
+
+int check_chunk(int chunk) {
+  if (chunk < 0 || chunk == NA_INTEGER)
+    Rcpp::stop("chunk must be a non-negative integer");
+  return chunk;
+}
+
+
+// [[Rcpp::export]]
+SEXP cpp_frozen_tnorm(
+    const double& mu,
+    const double& sigma,
+    const double& lower,
+    const double& upper,
+    const int& chunk
+  ) {
+  TnormFrozen dist(mu, sigma, lower, upper);
+  return FrozenPtr(new Frozen<TnormFrozen>(dist, check_chunk(chunk)), true);
+}
+
+
+// [[Rcpp::export]]
+SEXP cpp_frozen_huber(
+    const double& mu,
+    const double& sigma,
+    const double& epsilon,
+    const int& chunk
+  ) {
+  HuberFrozen dist(mu, sigma, epsilon);
+  return FrozenPtr(new Frozen<HuberFrozen>(dist, check_chunk(chunk)), true);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_frozen_d(
+    SEXP ptr,
+    const NumericVector& x,
+    const bool& log_prob = false
+  ) {
+
+  FrozenDistribution* dist = get_frozen(ptr);
+  NumericVector p(x.length());
+
+  bool throw_warning = false;
+
+  dist->pdf(x, p, log_prob, throw_warning);
+
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_frozen_p(
+    SEXP ptr,
+    const NumericVector& x,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+
+  FrozenDistribution* dist = get_frozen(ptr);
+  NumericVector p(x.length());
+
+  bool throw_warning = false;
+
+  dist->cdf(x, p, lower_tail, log_prob, throw_warning);
+
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_frozen_q(
+    SEXP ptr,
+    const NumericVector& p,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+
+  FrozenDistribution* dist = get_frozen(ptr);
+  NumericVector x(p.length());
+
+  bool throw_warning = false;
+
+  dist->invcdf(p, x, lower_tail, log_prob, throw_warning);
+
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+
+  return x;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_frozen_r(
+    SEXP ptr,
+    const int& n
+  ) {
+
+  FrozenDistribution* dist = get_frozen(ptr);
+  NumericVector x(n);
+
+  bool throw_warning = false;
+
+  dist->rng(x, throw_warning);
+
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+
+  return x;
+}
+
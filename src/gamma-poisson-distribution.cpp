@@ -1,5 +1,7 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "table-cache.h"
+#include "../inst/include/extraDistr/gamma-poisson-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,36 +15,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
-*  Gamma-Poisson distribution
-*
-*  Values:
-*  x >= 0
-*
-*  Parameters:
-*  alpha > 0
-*  beta > 0
-*
-*/
-
-inline double logpmf_gpois(double x, double alpha, double beta,
-                           bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta))
-    return x+alpha+beta;
-#endif
-  if (alpha <= 0.0 || beta <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (!isInteger(x) || x < 0.0 || !R_FINITE(x))
-    return R_NegInf;
-  // p = beta/(1.0+beta);
-  double p = exp( log(beta) - log1p(beta) );
-  return R::lgammafn(alpha+x) - lfactorial(x) - R::lgammafn(alpha) +
-    log(p)*x + log(1.0-p)*alpha;
-}
-
 inline std::vector<double> cdf_gpois_table(double x, double alpha, double beta) {
   
   if (x < 0.0 || !R_FINITE(x) || alpha < 0.0 || beta < 0.0)
@@ -54,7 +26,7 @@ inline std::vector<double> cdf_gpois_table(double x, double alpha, double beta)
   
   p = beta/(1.0+beta);
   qa = log(pow(1.0 - p, alpha));
-  ga = R::lgammafn(alpha);
+  ga = lgamma_fn(alpha);
   lp = log(p);
   
   // x = 0
@@ -93,16 +65,6 @@ inline std::vector<double> cdf_gpois_table(double x, double alpha, double beta)
   return p_tab;
 }
 
-inline double rng_gpois(double alpha, double beta,
-                        bool& throw_warning) {
-  if (ISNAN(alpha) || ISNAN(beta) || alpha <= 0.0 || beta <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double lambda = R::rgamma(alpha, beta);
-  return R::rpois(lambda);
-}
-
 
 // [[Rcpp::export]]
 NumericVector cpp_dgpois(
@@ -125,9 +87,17 @@ NumericVector cpp_dgpois(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
-    p[i] = logpmf_gpois(GETV(x, i), GETV(alpha, i),
-                        GETV(beta, i), throw_warning);
+  if (all_scalar({alpha.length(), beta.length()})) {
+    GpoisFrozen dist(alpha[0], beta[0]);
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      p[i] = dist.pdf(x[i], true, warn);
+    });
+  } else {
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      p[i] = logpmf_gpois(GETV(x, i), GETV(alpha, i),
+                          GETV(beta, i), warn);
+    });
+  }
 
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -161,9 +131,33 @@ NumericVector cpp_pgpois(
   
   bool throw_warning = false;
 
-  std::map<std::tuple<int, int>, std::vector<double>> memo;
   double mx = finite_max_int(x);
   
+  // Building a table takes one step for each value in its support, for
+  // each pair of the parameters, so it is faster than evaluating the
+  // incomplete beta function per element only when there are many
+  // values sharing small supports.
+  
+  double npairs = std::min(
+    static_cast<double>(Nmax),
+    static_cast<double>(alpha.length()) * static_cast<double>(beta.length())
+  );
+  
+  if (npairs * (mx + 1.0) > static_cast<double>(Nmax)) {
+    
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      p[i] = cdf_gpois(GETV(x, i), GETV(alpha, i), GETV(beta, i),
+                       lower_tail, log_prob, warn);
+    });
+    
+    if (throw_warning)
+      Rcpp::warning("NaNs produced");
+    
+    return p;
+  }
+  
+  std::map<std::tuple<int, int>, table_ptr> memo;
+  
   for (int i = 0; i < Nmax; i++) {
     if (i % 100 == 0)
       Rcpp::checkUserInterrupt();
@@ -183,19 +177,23 @@ NumericVector cpp_pgpois(
     } else if (GETV(x, i) == R_PosInf) {
       p[i] = 1.0;
     } else if (is_large_int(GETV(x, i))) {
-      p[i] = NA_REAL;
-      Rcpp::warning("NAs introduced by coercion to integer range");
+      p[i] = cdf_gpois(GETV(x, i), GETV(alpha, i), GETV(beta, i),
+                       true, false, throw_warning);
     } else {
       
-      std::vector<double>& tmp = memo[std::make_tuple(
+      table_ptr& tmp = memo[std::make_tuple(
         static_cast<int>(i % alpha.length()),
         static_cast<int>(i % beta.length())
       )];
       
-      if (!tmp.size()) {
-        tmp = cdf_gpois_table(mx, GETV(alpha, i), GETV(beta, i));
+      if (!tmp) {
+        tmp = cached_table(TABLE_PGPOIS,
+                           GETV(alpha, i), GETV(beta, i), 0.0,
+                           to_pos_int(mx) + 1, [&]() {
+          return cdf_gpois_table(mx, GETV(alpha, i), GETV(beta, i));
+        });
       }
-      p[i] = tmp[to_pos_int(GETV(x, i))];
+      p[i] = (*tmp)[to_pos_int(GETV(x, i))];
       
     }
   } 
@@ -213,6 +211,53 @@ NumericVector cpp_pgpois(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_qgpois(
+    const NumericVector& p,
+    const NumericVector& alpha,
+    const NumericVector& beta,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({p.length(), alpha.length(), beta.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    p.length(),
+    alpha.length(),
+    beta.length()
+  });
+  NumericVector pp = Rcpp::clone(p);
+  
+  bool throw_warning = false;
+  
+  if (log_prob)
+    pp = Rcpp::exp(pp);
+  
+  if (!lower_tail)
+    pp = 1.0 - pp;
+  
+  // the third parameter is a placeholder, as in the keys of the cache
+  
+  NumericVector x = cached_quantiles(
+    TABLE_PGPOIS, Nmax, pp, alpha, beta, NumericVector::create(0.0),
+    [](double prob, double a, double b, double, bool& warn) {
+      return invcdf_gpois(prob, a, b, warn);
+    },
+    [](double k, double a, double b, double) {
+      return cdf_gpois_table(k, a, b);
+    },
+    throw_warning
+  );
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return x;
+}
+
 // [[Rcpp::export]]
 NumericVector cpp_rgpois(
     const int& n,
@@ -228,10 +273,23 @@ NumericVector cpp_rgpois(
   NumericVector x(n);
   
   bool throw_warning = false;
-
-  for (int i = 0; i < n; i++)
-    x[i] = rng_gpois(GETV(alpha, i), GETV(beta, i),
-                     throw_warning);
+  
+  // fixed parameters, the gamma sampler is set up once
+  
+  if (all_scalar({alpha.length(), beta.length()}) &&
+      alpha[0] > 0.0 && beta[0] > 0.0 &&
+      R_FINITE(alpha[0]) && R_FINITE(beta[0])) {
+    GammaSampler gamma(alpha[0]);
+    double scale = beta[0];
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+      x[i] = rng_pois(gamma.draw(scale));
+    });
+  } else {
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+      x[i] = rng_gpois(GETV(alpha, i), GETV(beta, i),
+                       warn);
+    });
+  }
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
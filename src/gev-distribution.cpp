@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/gev-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -15,113 +16,6 @@ using Rcpp::NumericVector;
 using std::log1p;
 
 
-/*
- *  Generalized extreme value distribution
- *
- *  Values:
- *  x
- *
- *  Parameters:
- *  mu
- *  sigma > 0
- *  xi
- *
- *  z = (x-mu)/sigma
- *  where 1+xi*z > 0
- * 
- *  f(x)    = { 1/sigma * (1+xi*z)^{-1/xi-1} * exp(-(1+xi*z)^{-1/xi})     if xi != 0
- *            { 1/sigma * exp(-z) * exp(-exp(-z))                         otherwise
- *  F(x)    = { exp(-(1+xi*z)^{1/xi})                                     if xi != 0
- *            { exp(-exp(-z))                                             otherwise
- *  F^-1(p) = { mu - sigma/xi * (1 - (-log(1-p))^xi)                      if xi != 0
- *            { mu - sigma * log(-log(1-p))                               otherwise
- *
- */
-
-
-inline double logpdf_gev(double x, double mu, double sigma,
-                         double xi, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
-    return x+mu+sigma+xi;
-#endif
-  if (sigma <= 0.0) {
-    Rcpp::warning("NaNs produced");
-    return NAN;
-  }
-  double z = (x-mu)/sigma;
-  if (1.0+xi*z > 0.0) {
-    if (xi != 0.0) {
-      // 1.0/sigma * pow(1.0+xi*z, -1.0-(1.0/xi)) * exp(-pow(1.0+xi*z, -1.0/xi));
-      return -log(sigma) + log1p(xi*z) * (-1.0-(1.0/xi)) -
-        exp(log1p(xi*z) * (-1.0/xi) );
-    } else {
-      // 1.0/sigma * exp(-z) * exp(-exp(-z));
-      return -log(sigma) - z - exp(-z);
-    }
-  } else {
-    return R_NegInf;
-  }
-}
-
-inline double cdf_gev(double x, double mu, double sigma,
-                      double xi, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
-    return x+mu+sigma+xi;
-#endif
-  if (sigma <= 0.0) {
-    Rcpp::warning("NaNs produced");
-    return NAN;
-  }
-  double z = (x-mu)/sigma;
-  if (1.0+xi*z > 0.0) {
-    if (xi != 0.0) {
-      // exp(-pow(1.0+xi*z, -1.0/xi));
-      return exp(-exp(log1p(xi*z) * (-1.0/xi)));
-    } else {
-      return exp(-exp(-z));
-    }
-  } else {
-    if (z > 0 && z >= -1/xi)
-      return 1.0;
-    else
-      return 0.0;
-  }
-}
-
-inline double invcdf_gev(double p, double mu, double sigma,
-                         double xi, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
-    return p+mu+sigma+xi;
-#endif
-  if (sigma <= 0.0 || !VALID_PROB(p)) {
-    Rcpp::warning("NaNs produced");
-    return NAN;
-  }
-  if (p == 1.0)
-    return R_PosInf;
-  if (xi != 0.0)
-    return mu - sigma/xi * (1.0 - pow(-log(p), -xi));
-  else
-    return mu - sigma * log(-log(p));
-}
-
-inline double rng_gev(double mu, double sigma, double xi,
-                      bool& throw_warning) {
-  if (ISNAN(mu) || ISNAN(sigma) || ISNAN(xi) || sigma <= 0.0) {
-    Rcpp::warning("NAs produced");
-    return NA_REAL;
-  }
-  double u = R::exp_rand(); // -log(rng_unif())
-  if (xi != 0.0)
-    return mu + sigma/xi * (pow(u, -xi) - 1.0);
-  else
-    return mu - sigma * log(u);
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dgev(
     const NumericVector& x,
@@ -146,10 +40,11 @@ NumericVector cpp_dgev(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = logpdf_gev(GETV(x, i), GETV(mu, i),
                       GETV(sigma, i), GETV(xi, i),
-                      throw_warning);
+                      warn);
+  });
 
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -185,10 +80,11 @@ NumericVector cpp_pgev(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_gev(GETV(x, i), GETV(mu, i),
                    GETV(sigma, i), GETV(xi, i),
-                   throw_warning);
+                   warn);
+  });
 
   if (!lower_tail)
     p = 1.0 - p;
@@ -234,10 +130,11 @@ NumericVector cpp_qgev(
   if (!lower_tail)
     pp = 1.0 - pp;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     q[i] = invcdf_gev(GETV(pp, i), GETV(mu, i),
                       GETV(sigma, i), GETV(xi, i),
-                      throw_warning);
+                      warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -263,9 +160,10 @@ NumericVector cpp_rgev(
 
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_gev(GETV(mu, i), GETV(sigma, i),
-                   GETV(xi, i), throw_warning);
+                   GETV(xi, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
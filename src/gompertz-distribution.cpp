@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/gompertz-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,84 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
-*  Gompertz distribution
-*
-*  Values:
-*  x >= 0
-*
-*  Parameters:
-*  a > 0
-*  b > 0
-*
-*  f(x)    = a*exp(b*x - a/b * (exp(bx)-1))
-*  F(x)    = 1-exp(-a/b * (exp(bx)-1))
-*  F^-1(p) = 1/b * log(1 - b/a * log(1-p))
-*
-* References:
-*
-* Lenart, A. (2012). The Gompertz distribution and Maximum Likelihood Estimation
-* of its parameters - a revision. MPIDR WORKING PAPER WP 2012-008.
-*
-*/
-
-
-inline double logpdf_gompertz(double x, double a, double b,
-                              bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(a) || ISNAN(b))
-    return x+a+b;
-#endif
-  if (a <= 0.0 || b <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0 || !R_FINITE(x))
-    return R_NegInf;
-  // a * exp(b*x - a/b * (exp(b*x) - 1.0));
-  return log(a) + (b*x - a/b * (exp(b*x) - 1.0));
-}
-
-inline double cdf_gompertz(double x, double a, double b,
-                           bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(a) || ISNAN(b))
-    return x+a+b;
-#endif
-  if (a <= 0.0 || b <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0)
-    return 0.0;
-  if (!R_FINITE(x))
-    return 1.0;
-  return 1.0 - exp(-a/b * (exp(b*x) - 1.0));
-}
-
-inline double invcdf_gompertz(double p, double a, double b,
-                              bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(a) || ISNAN(b))
-    return p+a+b;
-#endif
-  if (a <= 0.0 || b <= 0.0 || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  return log(1.0 - b/a * log(1.0-p)) / b;
-}
-
-inline double rng_gompertz(double a, double b, bool& throw_warning) {
-  if (ISNAN(a) || ISNAN(b) || a <= 0.0 || b <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double u = rng_unif();
-  return log(1.0 - b/a * log(u)) / b;
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dgompertz(
     const NumericVector& x,
@@ -112,9 +35,10 @@ NumericVector cpp_dgompertz(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = logpdf_gompertz(GETV(x, i), GETV(a, i),
-                           GETV(b, i), throw_warning);
+                           GETV(b, i), warn);
+  });
 
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -148,9 +72,10 @@ NumericVector cpp_pgompertz(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_gompertz(GETV(x, i), GETV(a, i),
-                        GETV(b, i), throw_warning);
+                        GETV(b, i), warn);
+  });
 
   if (!lower_tail)
     p = 1.0 - p;
@@ -194,9 +119,10 @@ NumericVector cpp_qgompertz(
   if (!lower_tail)
     pp = 1.0 - pp;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     q[i] = invcdf_gompertz(GETV(pp, i), GETV(a, i),
-                           GETV(b, i), throw_warning);
+                           GETV(b, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -221,9 +147,10 @@ NumericVector cpp_rgompertz(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_gompertz(GETV(a, i), GETV(b, i),
-                        throw_warning);
+                        warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/gpd-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -14,150 +15,6 @@ using std::sqrt;
 
 using std::log1p;
 
-/*
- *  Generalized Pareto distribution
- *
- *  Values:
- *  x
- *
- *  Parameters:
- *  mu
- *  sigma > 0
- *  xi
- *
- *  z = (x-mu)/sigma
- *  where 1+xi*z > 0
- *
- *  f(x)    = { (1+xi*z)^{-(xi+1)/xi}/sigma       if xi != 0
- *            { exp(-z)/sigma                     otherwise
- *  F(x)    = { 1-(1+xi*z)^{-1/xi}                if xi != 0
- *            { 1-exp(-z)                         otherwise
- *  F^-1(p) = { mu + sigma * ((1-p)^{-xi}-1)/xi   if xi != 0
- *            { mu - sigma * log(1-p)             otherwise
- *
- */
-
-inline double logpdf_gpd(double x, double mu, double sigma, double xi,
-                         bool &throw_warning)
-{
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
-    return x + mu + sigma + xi;
-#endif
-  if (sigma <= 0.0)
-  {
-    throw_warning = true;
-    return NAN;
-  }
-  double z = (x - mu) / sigma;
-  if (xi != 0.0)
-  {
-    if (z > 0 && 1.0 + xi * z > 0.0)
-    {
-      // pow(1.0+xi*z, -(xi+1.0)/xi)/sigma;
-      return log1p(xi * z) * (-(xi + 1.0) / xi) - log(sigma);
-    }
-    else
-    {
-      return R_NegInf;
-    }
-  }
-  else
-  {
-    if (z > 0 && 1.0 + xi * z > 0.0)
-    {
-      // exp(-z)/sigma;
-      return -z - log(sigma);
-    }
-    else
-    {
-      return R_NegInf;
-    }
-  }
-}
-
-inline double cdf_gpd(double x, double mu, double sigma, double xi,
-                      bool &throw_warning)
-{
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
-    return x + mu + sigma + xi;
-#endif
-  if (sigma <= 0.0)
-  {
-    throw_warning = true;
-    return NAN;
-  }
-  double z = (x - mu) / sigma;
-  if (xi != 0.0)
-  {
-    if (z > 0 && 1.0 + xi * z > 0.0)
-    {
-      // 1.0 - pow(1.0+xi*z, -1.0/xi);
-      return 1.0 - exp(log1p(xi * z) * (-1.0 / xi));
-    }
-    else
-    {
-      if (z > 0 && z >= -1 / xi)
-        return 1.0;
-      else
-        return 0.0;
-    }
-  }
-  else
-  {
-    if (z > 0 && 1.0 + xi * z > 0.0)
-    {
-      return 1.0 - exp(-z);
-    }
-    else
-    {
-      if (z > 0 && z >= -1 / xi)
-        return 1.0;
-      else
-        return 0.0;
-    }
-  }
-}
-
-inline double invcdf_gpd(double p, double mu, double sigma, double xi,
-                         bool &throw_warning)
-{
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
-    return p + mu + sigma + xi;
-#endif
-  if (sigma <= 0.0 || !VALID_PROB(p))
-  {
-    throw_warning = true;
-    return NAN;
-  }
-  if (xi != 0.0)
-    return mu + sigma * (pow(1.0 - p, -xi) - 1.0) / xi;
-  else
-    return mu - sigma * log(1.0 - p);
-}
-
-inline double rng_gpd(double mu, double sigma, double xi,
-                      bool &throw_warning)
-{
-  if (ISNAN(mu) || ISNAN(sigma) || ISNAN(xi) || sigma <= 0.0)
-  {
-    throw_warning = true;
-    return NA_REAL;
-  }
-
-  if (xi != 0.0)
-  {
-    double u = rng_unif();
-    return mu + sigma * (pow(u, -xi) - 1.0) / xi;
-  }
-  else
-  {
-    double v = R::exp_rand(); // -log(rng_unif())
-    return mu + sigma * v;
-  }
-}
 
 // [[Rcpp::export]]
 NumericVector cpp_dgpd(
@@ -182,10 +39,11 @@ NumericVector cpp_dgpd(
 
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = logpdf_gpd(GETV(x, i), GETV(mu, i),
                       GETV(sigma, i), GETV(xi, i),
-                      throw_warning);
+                      warn);
+  });
 
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -220,10 +78,11 @@ NumericVector cpp_pgpd(
 
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_gpd(GETV(x, i), GETV(mu, i),
                    GETV(sigma, i), GETV(xi, i),
-                   throw_warning);
+                   warn);
+  });
 
   if (!lower_tail)
     p = 1.0 - p;
@@ -268,10 +127,11 @@ NumericVector cpp_qgpd(
   if (!lower_tail)
     pp = 1.0 - pp;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     q[i] = invcdf_gpd(GETV(pp, i), GETV(mu, i),
                       GETV(sigma, i), GETV(xi, i),
-                      throw_warning);
+                      warn);
+  });
 
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -297,9 +157,10 @@ NumericVector cpp_rgpd(
 
   bool throw_warning = false;
 
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_gpd(GETV(mu, i), GETV(sigma, i),
-                   GETV(xi, i), throw_warning);
+                   GETV(xi, i), warn);
+  });
 
   if (throw_warning)
     Rcpp::warning("NAs produced");
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/gumbel-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,79 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
- *  Gumbel distribution
- *
- *  Values:
- *  x
- *
- *  Parameters:
- *  mu
- *  sigma > 0
- *
- *  z       = (x-mu)/sigma
- *  f(x)    = 1/sigma * exp(-(z+exp(-z)))
- *  F(x)    = exp(-exp(-z))
- *  F^-1(p) = mu - sigma * log(-log(p))
- *
- */
-
-inline double logpdf_gumbel(double x, double mu, double sigma,
-                            bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
-    return x+mu+sigma;
-#endif
-  if (sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (!R_FINITE(x))
-    return R_NegInf;
-  double z = (x-mu)/sigma;
-  // exp(-(z+exp(-z)))/sigma;
-  return -(z+exp(-z)) - log(sigma);
-}
-
-
-inline double cdf_gumbel(double x, double mu, double sigma,
-                         bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
-    return x+mu+sigma;
-#endif
-  if (sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  double z = (x-mu)/sigma;
-  return exp(-exp(-z));
-}
-
-inline double invcdf_gumbel(double p, double mu, double sigma,
-                            bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma))
-    return p+mu+sigma;
-#endif
-  if (sigma <= 0.0 || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  return mu - sigma * log(-log(p));
-}
-
-inline double rng_gumbel(double mu, double sigma,
-                         bool& throw_warning) {
-  if (ISNAN(mu) || ISNAN(sigma) || sigma <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double u = R::exp_rand(); // -log(rng_unif())
-  return mu - sigma * log(u);
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dgumbel(
     const NumericVector& x,
@@ -107,9 +35,10 @@ NumericVector cpp_dgumbel(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = logpdf_gumbel(GETV(x, i), GETV(mu, i),
-                         GETV(sigma, i), throw_warning);
+                         GETV(sigma, i), warn);
+  });
 
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -143,9 +72,10 @@ NumericVector cpp_pgumbel(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_gumbel(GETV(x, i), GETV(mu, i),
-                      GETV(sigma, i), throw_warning);
+                      GETV(sigma, i), warn);
+  });
 
   if (!lower_tail)
     p = 1.0 - p;
@@ -189,9 +119,10 @@ NumericVector cpp_qgumbel(
   if (!lower_tail)
     pp = 1.0 - pp;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     q[i] = invcdf_gumbel(GETV(pp, i), GETV(mu, i),
-                         GETV(sigma, i), throw_warning);
+                         GETV(sigma, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -216,9 +147,10 @@ NumericVector cpp_rgumbel(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_gumbel(GETV(mu, i), GETV(sigma, i),
-                      throw_warning);
+                      warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/half-cauchy-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -15,58 +16,6 @@ using std::tan;
 using std::atan;
 
 
-inline double logpdf_hcauchy(double x, double sigma,
-                             bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(sigma))
-    return x+sigma;
-#endif
-  if (sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0)
-    return R_NegInf;
-  // 2.0/(M_PI*(1.0 + pow(x/sigma, 2.0)))/sigma;
-  return LOG_2F - log(M_PI) - log1p(exp( (log(x)-log(sigma)) * 2.0 )) - log(sigma);
-}
-
-inline double cdf_hcauchy(double x, double sigma, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(sigma))
-    return x+sigma;
-#endif
-  if (sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0)
-    return 0.0;
-  return 2.0/M_PI * atan(x/sigma);
-}
-
-inline double invcdf_hcauchy(double p, double sigma,
-                             bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(sigma))
-    return p+sigma;
-#endif
-  if (sigma <= 0.0 || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  return sigma * tan((M_PI*p)/2.0);
-}
-
-inline double rng_hcauchy(double sigma, bool& throw_warning) {
-  if (ISNAN(sigma) || sigma <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  return abs(R::rcauchy(0.0, sigma));
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dhcauchy(
     const NumericVector& x,
@@ -86,9 +35,10 @@ NumericVector cpp_dhcauchy(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = logpdf_hcauchy(GETV(x, i), GETV(sigma, i),
-                          throw_warning);
+                          warn);
+  });
   
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -119,9 +69,10 @@ NumericVector cpp_phcauchy(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_hcauchy(GETV(x, i), GETV(sigma, i),
-                       throw_warning);
+                       warn);
+  });
   
   if (!lower_tail)
     p = 1.0 - p;
@@ -163,9 +114,10 @@ NumericVector cpp_qhcauchy(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     q[i] = invcdf_hcauchy(GETV(pp, i), GETV(sigma, i),
-                          throw_warning);
+                          warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -189,8 +141,9 @@ NumericVector cpp_rhcauchy(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
-    x[i] = rng_hcauchy(GETV(sigma, i), throw_warning);
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+    x[i] = rng_hcauchy(GETV(sigma, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
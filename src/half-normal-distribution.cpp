@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/half-normal-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,56 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-inline double logpdf_hnorm(double x, double sigma,
-                           bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(sigma))
-    return x+sigma;
-#endif
-  if (sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0)
-    return R_NegInf;
-  return LOG_2F + R::dnorm(x, 0.0, sigma, true);
-}
-
-inline double cdf_hnorm(double x, double sigma, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(sigma))
-    return x+sigma;
-#endif
-  if (sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0)
-    return 0.0;
-  return 2.0 * R::pnorm(x, 0.0, sigma, true, false) - 1.0;
-}
-
-inline double invcdf_hnorm(double p, double sigma, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(sigma))
-    return p+sigma;
-#endif
-  if (sigma <= 0.0 || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  return R::qnorm((p+1.0)/2.0, 0.0, sigma, true, false);
-}
-
-inline double rng_hnorm(double sigma, bool& throw_warning) {
-  if (ISNAN(sigma) || sigma <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  return abs(R::norm_rand()) * sigma;
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dhnorm(
     const NumericVector& x,
@@ -82,9 +33,10 @@ NumericVector cpp_dhnorm(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = logpdf_hnorm(GETV(x, i), GETV(sigma, i),
-                        throw_warning);
+                        warn);
+  });
   
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -116,9 +68,10 @@ NumericVector cpp_phnorm(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_hnorm(GETV(x, i), GETV(sigma, i),
-                     throw_warning);
+                     warn);
+  });
   
   if (!lower_tail)
     p = 1.0 - p;
@@ -160,9 +113,10 @@ NumericVector cpp_qhnorm(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     q[i] = invcdf_hnorm(GETV(pp, i), GETV(sigma, i),
-                        throw_warning);
+                        warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -186,8 +140,9 @@ NumericVector cpp_rhnorm(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
-    x[i] = rng_hnorm(GETV(sigma, i), throw_warning);
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+    x[i] = rng_hnorm(GETV(sigma, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/half-t-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,71 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
- * 
- * x >= 0
- * 
- * Parameters:
- * nu > 0
- * sigma > 0
- * 
- * with nu = 1   returns half-Cauchy
- * with nu = Inf returns half-normal
- * 
- */
-
-inline double logpdf_ht(double x, double nu, double sigma,
-                        bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(nu) || ISNAN(sigma))
-    return x+nu+sigma;
-#endif
-  if (sigma <= 0.0 || nu <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0)
-    return R_NegInf;
-  return LOG_2F + R::dt(x/sigma, nu, true) - log(sigma);
-}
-
-inline double cdf_ht(double x, double nu, double sigma,
-                     bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(nu) || ISNAN(sigma))
-    return x+nu+sigma;
-#endif
-  if (sigma <= 0.0 || nu <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0)
-    return 0.0;
-  return 2.0 * R::pt(x/sigma, nu, true, false) - 1.0;
-}
-
-inline double invcdf_ht(double p, double nu, double sigma,
-                        bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(nu) || ISNAN(sigma))
-    return p+nu+sigma;
-#endif
-  if (sigma <= 0.0 || nu <= 0.0 || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  return R::qt((p+1.0)/2.0, nu, true, false) * sigma;
-}
-
-inline double rng_ht(double nu, double sigma, bool& throw_warning) {
-  if (ISNAN(nu) || ISNAN(sigma) || sigma <= 0.0 || nu <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  return abs(R::rt(nu) * sigma);
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dht(
     const NumericVector& x,
@@ -135,9 +71,10 @@ NumericVector cpp_pht(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_ht(GETV(x, i), GETV(nu, i),
-                  GETV(sigma, i), throw_warning);
+                  GETV(sigma, i), warn);
+  });
   
   if (!lower_tail)
     p = 1.0 - p;
@@ -181,9 +118,10 @@ NumericVector cpp_qht(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     q[i] = invcdf_ht(GETV(pp, i), GETV(nu, i),
-                     GETV(sigma, i), throw_warning);
+                     GETV(sigma, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -208,9 +146,10 @@ NumericVector cpp_rht(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_ht(GETV(nu, i), GETV(sigma, i),
-                  throw_warning);
+                  warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
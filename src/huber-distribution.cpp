@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/huber-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,110 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-inline double logpdf_huber(double x, double mu, double sigma,
-                           double c, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(c))
-    return x+mu+sigma+c;
-#endif
-  if (sigma <= 0.0 || c <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  
-  double z, A, rho;
-  z = abs((x - mu)/sigma);
-  // A = 2.0*SQRT_2_PI * (Phi(c) + phi(c)/c - 0.5);
-  A = LOG_2F + log(SQRT_2_PI) + log(Phi(c) + phi(c)/c - 0.5);
-
-  if (z <= c) {
-    rho = (z*z)/2.0;
-  } else {
-    rho = c*z - (c*c)/2.0;
-  }
-
-  // exp(-rho)/A/sigma;
-  return -rho - A - log(sigma);
-}
-
-inline double cdf_huber(double x, double mu, double sigma,
-                        double c, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(c))
-    return x+mu+sigma+c;
-#endif
-  if (sigma <= 0.0 || c <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-
-  double A, z, az, p;
-  A = 2.0*(phi(c)/c - Phi(-c) + 0.5);
-  z = (x - mu)/sigma;
-  az = -abs(z);
-  
-  if (az <= -c) 
-    p = exp((c*c)/2.0)/c * exp(c*az) / SQRT_2_PI/A;
-  else
-    p = (phi(c)/c + Phi(az) - Phi(-c))/A;
-  
-  if (z <= 0.0)
-    return p;
-  else
-    return 1.0 - p;
-}
-
-inline double invcdf_huber(double p, double mu, double sigma,
-                           double c, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma) || ISNAN(c))
-    return p+mu+sigma+c;
-#endif
-  if (sigma <= 0.0 || c <= 0.0 || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-
-  double x, pm, A;
-  A = 2.0 * SQRT_2_PI * (Phi(c) + phi(c)/c - 0.5);
-  pm = std::min(p, 1.0 - p);
-
-  if (pm <= SQRT_2_PI * phi(c)/(c*A))
-    x = log(c*pm*A)/c - c/2.0;
-  else
-    x = InvPhi(abs(1.0 - Phi(c) + pm*A/SQRT_2_PI - phi(c)/c));
-
-  if (p < 0.5)
-    return mu + x*sigma;
-  else
-    return mu - x*sigma;
-}
-
-inline double rng_huber(double mu, double sigma, double c,
-                        bool& throw_warning) {
-  if (ISNAN(mu) || ISNAN(sigma) || ISNAN(c) ||
-      sigma <= 0.0 || c <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  
-  double x, pm, A, u;
-  u = rng_unif();
-  A = 2.0 * SQRT_2_PI * (Phi(c) + phi(c)/c - 0.5);
-  pm = std::min(u, 1.0 - u);
-  
-  if (pm <= SQRT_2_PI * phi(c)/(c*A))
-    x = log(c*pm*A)/c - c/2.0;
-  else
-    x = InvPhi(abs(1.0 - Phi(c) + pm*A/SQRT_2_PI - phi(c)/c));
-  
-  if (u < 0.5)
-    return mu + x*sigma;
-  else
-    return mu - x*sigma;
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dhuber(
     const NumericVector& x,
@@ -141,10 +38,18 @@ NumericVector cpp_dhuber(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
-    p[i] = logpdf_huber(GETV(x, i), GETV(mu, i),
-                        GETV(sigma, i), GETV(epsilon, i),
-                        throw_warning);
+  if (all_scalar({mu.length(), sigma.length(), epsilon.length()})) {
+    HuberFrozen dist(mu[0], sigma[0], epsilon[0]);
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      p[i] = dist.pdf(x[i], true, warn);
+    });
+  } else {
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      p[i] = logpdf_huber(GETV(x, i), GETV(mu, i),
+                          GETV(sigma, i), GETV(epsilon, i),
+                          warn);
+    });
+  }
   
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -181,16 +86,18 @@ NumericVector cpp_phuber(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
-    p[i] = cdf_huber(GETV(x, i), GETV(mu, i),
-                     GETV(sigma, i), GETV(epsilon, i),
-                     throw_warning);
-  
-  if (!lower_tail)
-    p = 1.0 - p;
-  
-  if (log_prob)
-    p = Rcpp::log(p);
+  if (all_scalar({mu.length(), sigma.length(), epsilon.length()})) {
+    HuberFrozen dist(mu[0], sigma[0], epsilon[0]);
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      p[i] = dist.cdf(x[i], lower_tail, log_prob, warn);
+    });
+  } else {
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      p[i] = cdf_huber(GETV(x, i), GETV(mu, i),
+                       GETV(sigma, i), GETV(epsilon, i),
+                       lower_tail, log_prob, warn);
+    });
+  }
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -221,20 +128,21 @@ NumericVector cpp_qhuber(
     epsilon.length()
   });
   NumericVector q(Nmax);
-  NumericVector pp = Rcpp::clone(p);
   
   bool throw_warning = false;
   
-  if (log_prob)
-    pp = Rcpp::exp(pp);
-  
-  if (!lower_tail)
-    pp = 1.0 - pp;
-  
-  for (int i = 0; i < Nmax; i++)
-    q[i] = invcdf_huber(GETV(pp, i), GETV(mu, i),
-                        GETV(sigma, i), GETV(epsilon, i),
-                        throw_warning);
+  if (all_scalar({mu.length(), sigma.length(), epsilon.length()})) {
+    HuberFrozen dist(mu[0], sigma[0], epsilon[0]);
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      q[i] = dist.invcdf(p[i], lower_tail, log_prob, warn);
+    });
+  } else {
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      q[i] = invcdf_huber(GETV(p, i), GETV(mu, i),
+                          GETV(sigma, i), GETV(epsilon, i),
+                          lower_tail, log_prob, warn);
+    });
+  }
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -260,9 +168,17 @@ NumericVector cpp_rhuber(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
-    x[i] = rng_huber(GETV(mu, i), GETV(sigma, i),
-                     GETV(epsilon, i), throw_warning);
+  if (all_scalar({mu.length(), sigma.length(), epsilon.length()})) {
+    HuberFrozen dist(mu[0], sigma[0], epsilon[0]);
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+      x[i] = dist.rng(warn);
+    });
+  } else {
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+      x[i] = rng_huber(GETV(mu, i), GETV(sigma, i),
+                       GETV(epsilon, i), warn);
+    });
+  }
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
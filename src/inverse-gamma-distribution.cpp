@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/inverse-gamma-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,58 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
-*  Inverse-Gamma distribution
-*
-*  Values:
-*  x
-*
-*  Parameters:
-*  alpha > 0
-*  beta > 0
-*
-*  f(k) = (x^(-alpha-1) * exp(-1/(beta*x))) / (Gamma(alpha)*beta^alpha)
-*  F(x) = gamma(alpha, 1/(beta*x)) / Gamma(alpha)
-*
-*  V. Witkovsky (2001) Computing the distribution of a linear
-*  combination of inverted gamma variables, Kybernetika 37(1), 79-90
-*
-*/
-
-
-inline double logpdf_invgamma(double x, double alpha, double beta,
-                              bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta))
-    return x+alpha+beta;
-#endif
-  if (alpha <= 0.0 || beta <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x <= 0.0)
-    return R_NegInf;
-  
-  return log(beta) * -alpha - R::lgammafn(alpha) + log(x) *
-           (-alpha-1.0) - 1.0/(beta*x);
-}
-
-inline double cdf_invgamma(double x, double alpha, double beta,
-                           bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta))
-    return x+alpha+beta;
-#endif
-  if (alpha <= 0.0 || beta <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x <= 0.0)
-    return 0.0;
-  return R::pgamma(1.0/x, alpha, 1.0/beta, false, false);
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dinvgamma(
     const NumericVector& x,
@@ -86,9 +35,17 @@ NumericVector cpp_dinvgamma(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
-    p[i] = logpdf_invgamma(GETV(x, i), GETV(alpha, i),
-                           GETV(beta, i), throw_warning);
+  if (all_scalar({alpha.length(), beta.length()})) {
+    InvgammaFrozen dist(alpha[0], beta[0]);
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      p[i] = dist.pdf(x[i], true, warn);
+    });
+  } else {
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      p[i] = logpdf_invgamma(GETV(x, i), GETV(alpha, i),
+                             GETV(beta, i), warn);
+    });
+  }
 
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -122,9 +79,10 @@ NumericVector cpp_pinvgamma(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_invgamma(GETV(x, i), GETV(alpha, i),
-                        GETV(beta, i), throw_warning);
+                        GETV(beta, i), warn);
+  });
   
   if (!lower_tail)
     p = 1.0 - p;
@@ -138,3 +96,41 @@ NumericVector cpp_pinvgamma(
   return p;
 }
 
+
+// [[Rcpp::export]]
+NumericVector cpp_rinvgamma(
+    const int& n,
+    const NumericVector& alpha,
+    const NumericVector& beta
+  ) {
+  
+  if (std::min({alpha.length(), beta.length()}) < 1) {
+    Rcpp::warning("NAs produced");
+    return NumericVector(n, NA_REAL);
+  }
+  
+  NumericVector x(n);
+  
+  bool throw_warning = false;
+  
+  // fixed parameters, the gamma sampler is set up once
+  
+  if (all_scalar({alpha.length(), beta.length()}) &&
+      alpha[0] > 0.0 && beta[0] > 0.0 &&
+      R_FINITE(alpha[0]) && R_FINITE(beta[0])) {
+    GammaSampler gamma(alpha[0]);
+    double scale = 1.0/beta[0];
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+      x[i] = 1.0 / gamma.draw(scale);
+    });
+  } else {
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+      x[i] = rng_invgamma(GETV(alpha, i), GETV(beta, i), warn);
+    });
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+  
+  return x;
+}
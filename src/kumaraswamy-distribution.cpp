@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/kumaraswamy-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -14,78 +15,6 @@ using Rcpp::NumericVector;
 
 using std::log1p;
 
-/*
-*  Kumaraswamy distribution
-*
-*  Values:
-*  x in [0, 1]
-*
-*  Parameters:
-*  a > 0
-*  b > 0
-*
-*  f(x)    = a*b*x^{a-1}*(1-x^a)^{b-1}
-*  F(x)    = 1-(1-x^a)^b
-*  F^-1(p) = 1-(1-p^{1/b})^{1/a}
-*
-*/
-
-inline double pdf_kumar(double x, double a, double b,
-                        bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(a) || ISNAN(b))
-    return x+a+b;
-#endif
-  if (a <= 0.0 || b <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0 || x > 1.0)
-    return 0.0;
-  // is the support [0,1] or (0,1) ?
-  // log(a) + log(b) + log(x)*(a-1.0) + log1p(-pow(x, a))*(b-1.0);
-  return a*b * pow(x, a-1.0) * pow(1.0-pow(x, a), b-1.0);
-}
-
-inline double cdf_kumar(double x, double a, double b,
-                        bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(a) || ISNAN(b))
-    return x+a+b;
-#endif
-  if (a <= 0.0 || b <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0)
-    return 0.0;
-  if (x >= 1.0)
-    return 1.0;
-  return 1.0 - pow(1.0 - pow(x, a), b);
-}
-
-inline double invcdf_kumar(double p, double a, double b,
-                           bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(a) || ISNAN(b))
-    return p+a+b;
-#endif
-  if (a <= 0.0 || b <= 0.0 || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  return pow(1.0 - pow(1.0 - p, 1.0/b), 1.0/a);
-}
-
-inline double rng_kumar(double a, double b, bool& throw_warning) {
-  if (ISNAN(a) || ISNAN(b) || a <= 0.0 || b <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double u = rng_unif();
-  return pow(1.0 - pow(u, 1.0/b), 1.0/a);
-}
-
 
 // [[Rcpp::export]]
 NumericVector cpp_dkumar(
@@ -108,9 +37,10 @@ NumericVector cpp_dkumar(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = pdf_kumar(GETV(x, i), GETV(a, i),
-                     GETV(b, i), throw_warning);
+                     GETV(b, i), warn);
+  });
 
   if (log_prob)
     p = Rcpp::log(p);
@@ -144,9 +74,10 @@ NumericVector cpp_pkumar(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_kumar(GETV(x, i), GETV(a, i),
-                     GETV(b, i), throw_warning);
+                     GETV(b, i), warn);
+  });
 
   if (!lower_tail)
     p = 1.0 - p;
@@ -190,9 +121,10 @@ NumericVector cpp_qkumar(
   if (!lower_tail)
     pp = 1.0 - pp;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     q[i] = invcdf_kumar(GETV(pp, i), GETV(a, i),
-                        GETV(b, i), throw_warning);
+                        GETV(b, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -217,9 +149,10 @@ NumericVector cpp_rkumar(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_kumar(GETV(a, i), GETV(b, i),
-                     throw_warning);
+                     warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/laplace-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,87 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
- *  Laplace distribution
- *
- *  Values:
- *  x
- *
- *  Parameters:
- *  mu
- *  sigma > 0
- *
- *  z = (x-mu)/sigma
- *  f(x)    = 1/(2*sigma) * exp(-|z|)
- *  F(x)    = { 1/2 * exp(z)                 if   x < mu
- *            { 1 - 1/2 * exp(z)             otherwise
- *  F^-1(p) = { mu + sigma * log(2*p)        if p <= 0.5
- *            { mu - sigma * log(2*(1-p))    otherwise
- *
- */
-
-inline double logpdf_laplace(double x, double mu, double sigma,
-                             bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
-    return x+mu+sigma;
-#endif
-  if (sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  double z = abs(x-mu)/sigma;
-  // exp(-z)/(2.0*sigma);
-  return -z - LOG_2F - log(sigma);
-}
-
-inline double cdf_laplace(double x, double mu, double sigma,
-                          bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
-    return x+mu+sigma;
-#endif
-  if (sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  double z = (x-mu)/sigma;
-  if (x < mu)
-    return exp(z - LOG_2F); // exp(z)/2.0
-  else
-    return 1.0 - exp(-z - LOG_2F); // 1.0 - exp(-z)/2.0
-}
-
-inline double invcdf_laplace(double p, double mu, double sigma,
-                             bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma))
-    return p+mu+sigma;
-#endif
-  if (sigma <= 0.0 || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (p < 0.5)
-    return mu + sigma * log(2.0*p);
-  else
-    return mu - sigma * log(2.0*(1.0-p));
-}
-
-inline double rng_laplace(double mu, double sigma, bool& throw_warning) {
-  if (ISNAN(mu) || ISNAN(sigma) || sigma <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  // this is slower
-  // double u = R::runif(-0.5, 0.5);
-  // return mu + sigma * R::sign(u) * log(1.0 - 2.0*abs(u));
-  double u = R::exp_rand();
-  double s = rng_sign();
-  return u*s * sigma + mu;
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dlaplace(
     const NumericVector& x,
@@ -115,9 +35,10 @@ NumericVector cpp_dlaplace(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = logpdf_laplace(GETV(x, i), GETV(mu, i),
-                          GETV(sigma, i), throw_warning);
+                          GETV(sigma, i), warn);
+  });
 
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -151,9 +72,10 @@ NumericVector cpp_plaplace(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_laplace(GETV(x, i), GETV(mu, i),
-                       GETV(sigma, i), throw_warning);
+                       GETV(sigma, i), warn);
+  });
 
   if (!lower_tail)
     p = 1.0 - p;
@@ -197,9 +119,10 @@ NumericVector cpp_qlaplace(
   if (!lower_tail)
     pp = 1.0 - pp;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     q[i] = invcdf_laplace(GETV(pp, i), GETV(mu, i),
-                          GETV(sigma, i), throw_warning);
+                          GETV(sigma, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -224,9 +147,10 @@ NumericVector cpp_rlaplace(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_laplace(GETV(mu, i), GETV(sigma, i),
-                       throw_warning);
+                       warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
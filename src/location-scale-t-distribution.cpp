@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/location-scale-t-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,71 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
-*  Non-standard t-distribution
-*
-*  Values:
-*  x
-*
-*  Parameters:
-*  nu > 0
-*  mu
-*  sigma > 0
-*
-*/
-
-inline double pdf_lst(double x, double nu, double mu, double sigma,
-                      bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(nu) || ISNAN(mu) || ISNAN(sigma))
-    return x+nu+mu+sigma;
-#endif
-  if (nu <= 0.0 || sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  double z = (x - mu)/sigma;
-  return R::dt(z, nu, false)/sigma;
-}
-
-inline double cdf_lst(double x, double nu, double mu, double sigma,
-                      bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(nu) || ISNAN(mu) || ISNAN(sigma))
-    return x+nu+mu+sigma;
-#endif
-  if (nu <= 0.0 || sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  double z = (x - mu)/sigma;
-  return R::pt(z, nu, true, false);
-}
-
-inline double invcdf_lst(double p, double nu, double mu, double sigma,
-                         bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(nu) || ISNAN(mu) || ISNAN(sigma))
-    return p+nu+mu+sigma;
-#endif
-  if (nu <= 0.0 || sigma <= 0.0 || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  return R::qt(p, nu, true, false)*sigma + mu;
-}
-
-inline double rng_lst(double nu, double mu, double sigma,
-                      bool& throw_warning) {
-  if (ISNAN(nu) || ISNAN(mu) || ISNAN(sigma) ||
-      nu <= 0.0 || sigma <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  return R::rt(nu)*sigma + mu;
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dlst(
     const NumericVector& x,
@@ -102,10 +38,11 @@ NumericVector cpp_dlst(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = pdf_lst(GETV(x, i), GETV(nu, i),
                    GETV(mu, i), GETV(sigma, i),
-                   throw_warning);
+                   warn);
+  });
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -142,10 +79,11 @@ NumericVector cpp_plst(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_lst(GETV(x, i), GETV(nu, i),
                    GETV(mu, i), GETV(sigma, i),
-                   throw_warning);
+                   warn);
+  });
   
   if (!lower_tail)
     p = 1.0 - p;
@@ -192,10 +130,11 @@ NumericVector cpp_qlst(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     x[i] = invcdf_lst(GETV(pp, i), GETV(nu, i),
                       GETV(mu, i), GETV(sigma, i),
-                      throw_warning);
+                      warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -221,9 +160,10 @@ NumericVector cpp_rlst(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_lst(GETV(nu, i), GETV(mu, i),
-                   GETV(sigma, i), throw_warning);
+                   GETV(sigma, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
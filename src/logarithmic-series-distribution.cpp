@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/logarithmic-series-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -14,112 +15,18 @@ using Rcpp::NumericVector;
 
 using std::log1p;
 
-/*
-*  Logarithmic Series distribution
-*
-*  Values:
-*  x
-*
-*  Parameters:
-*  0 < theta < 1
-*
-*  f(x) = (-1/log(1-theta)*theta^x) / x
-*  F(x) = -1/log(1-theta) * sum((theta^x)/x)
-*
-*/
 
+// LgserFrozen keeps the cumulative probabilities of the first values,
+// so it is used when each value of theta is shared by many elements
 
-inline double logpdf_lgser(double x, double theta, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(theta))
-    return x+theta;
-#endif
-  if (theta <= 0.0 || theta >= 1.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (!isInteger(x) || x < 1.0)
-    return R_NegInf;
-  // a = -1.0/log(1.0 - theta);
-  double a = -1.0/log1p(-theta);
-  // a * pow(theta, x) / x;
-  return log(a) + (log(theta) * x) - log(x);
-}
-
-inline double cdf_lgser(double x, double theta, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(theta))
-    return x+theta;
-#endif
-  if (theta <= 0.0 || theta >= 1.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 1.0)
-    return 0.0;
-  if (!R_FINITE(x))
-    return 1.0;
-  if (is_large_int(x)) {
-    Rcpp::warning("NAs introduced by coercion to integer range");
-    return NA_REAL;
-  }
-  
-  double a = -1.0/log1p(-theta);
-  double b = 0.0;
-  double dk;
-  int ix = to_pos_int(x);
-  
-  for (int k = 1; k <= ix; k++) {
-    dk = to_dbl(k);
-    b += pow(theta, dk) / dk;
-  }
-  
-  return a * b;
-}
-
-inline double invcdf_lgser(double p, double theta, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(theta))
-    return p+theta;
-#endif
-  if (theta <= 0.0 || theta >= 1.0 || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (p == 0.0)
-    return 1.0;
-  if (p == 1.0)
-    return R_PosInf;
-  
-  double pk = -theta/log(1.0 - theta);
-  double k = 1.0;
-  
-  while (p > pk) {
-    p -= pk;
-    pk *= theta * k/(k+1.0);
-    k += 1.0;
-  }
-  
-  return k;
-}
-
-inline double rng_lgser(double theta, bool& throw_warning) {
-  if (ISNAN(theta) || theta <= 0.0 || theta >= 1.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-
-  double u = rng_unif();
-  double pk = -theta/log(1.0 - theta);
-  double k = 1.0;
-  
-  while (u > pk) {
-    u -= pk;
-    pk *= theta * k/(k+1.0);
-    k += 1.0;
-  }
-  
-  return k;
+std::vector<LgserFrozen> shared_lgser(const NumericVector& theta, int n) {
+  std::vector<LgserFrozen> dist;
+  if (theta.length() > 1 && theta.length() > n / LGSER_DIRECT)
+    return dist;
+  dist.reserve(theta.length());
+  for (int j = 0; j < theta.length(); j++)
+    dist.push_back(LgserFrozen(theta[j]));
+  return dist;
 }
 
 
@@ -142,9 +49,17 @@ NumericVector cpp_dlgser(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
-    p[i] = logpdf_lgser(GETV(x, i), GETV(theta, i),
-                        throw_warning);
+  if (all_scalar({theta.length()})) {
+    LgserFrozen dist(theta[0]);
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      p[i] = dist.pdf(x[i], true, warn);
+    });
+  } else {
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      p[i] = logpdf_lgser(GETV(x, i), GETV(theta, i),
+                          warn);
+    });
+  }
  
  if (!log_prob)
    p = Rcpp::exp(p);
@@ -176,9 +91,19 @@ NumericVector cpp_plgser(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
-    p[i] = cdf_lgser(GETV(x, i), GETV(theta, i),
-                     throw_warning);
+  std::vector<LgserFrozen> dist = shared_lgser(theta, Nmax);
+
+  if (!dist.empty()) {
+    int k = theta.length();
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      p[i] = dist[i % k].cdf(GETV(x, i), warn);
+    });
+  } else {
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      p[i] = cdf_lgser(GETV(x, i), GETV(theta, i),
+                       warn);
+    });
+  }
 
   if (!lower_tail)
     p = 1.0 - p;
@@ -220,9 +145,19 @@ NumericVector cpp_qlgser(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  for (int i = 0; i < Nmax; i++)
-    x[i] = invcdf_lgser(GETV(pp, i), GETV(theta, i),
-                        throw_warning);
+  std::vector<LgserFrozen> dist = shared_lgser(theta, Nmax);
+
+  if (!dist.empty()) {
+    int k = theta.length();
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      x[i] = dist[i % k].invcdf(GETV(pp, i), warn);
+    });
+  } else {
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      x[i] = invcdf_lgser(GETV(pp, i), GETV(theta, i),
+                          warn);
+    });
+  }
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -246,8 +181,16 @@ NumericVector cpp_rlgser(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < n; i++)
-    x[i] = rng_lgser(GETV(theta, i), throw_warning);
+  if (all_scalar({theta.length()})) {
+    LgserFrozen dist(theta[0]);
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+      x[i] = dist.rng(warn);
+    });
+  } else {
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+      x[i] = rng_lgser(GETV(theta, i), warn);
+    });
+  }
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
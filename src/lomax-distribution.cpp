@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/lomax-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -15,78 +16,6 @@ using Rcpp::NumericVector;
 using std::log1p;
 
 
-/*
-*  Lomax distribution
-*
-*  Values:
-*  x > 0
-*
-*  Parameters:
-*  lambda > 0
-*  kappa > 0
-*
-*  f(x)    = lambda*kappa / (1+lambda*x)^(kappa+1)
-*  F(x)    = 1-(1+lambda*x)^-kappa
-*  F^-1(p) = ((1-p)^(-1/kappa)-1) / lambda
-*
-*/
-
-
-inline double logpdf_lomax(double x, double lambda, double kappa,
-                           bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(lambda) || ISNAN(kappa))
-    return x+lambda+kappa;
-#endif
-  if (lambda <= 0.0 || kappa <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x <= 0.0)
-    return R_NegInf;
-  // lambda*kappa / pow(1.0+lambda*x, kappa+1.0);
-  return log(lambda) + log(kappa) - log1p(lambda*x)*(kappa+1.0);
-}
-
-inline double cdf_lomax(double x, double lambda, double kappa,
-                        bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(lambda) || ISNAN(kappa))
-    return x+lambda+kappa;
-#endif
-  if (lambda <= 0.0 || kappa <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x <= 0.0)
-    return 0.0;
-  // 1.0 - pow(1.0+lambda*x, -kappa);
-  return 1.0 - exp(log1p(lambda*x) * (-kappa));
-}
-
-inline double invcdf_lomax(double p, double lambda, double kappa,
-                           bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(lambda) || ISNAN(kappa))
-    return p+lambda+kappa;
-#endif
-  if (lambda <= 0.0 || kappa <= 0.0 || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  return (pow(1.0-p, -1.0/kappa)-1.0) / lambda;
-}
-
-inline double rng_lomax(double lambda, double kappa, bool& throw_warning) {
-  if (ISNAN(lambda) || ISNAN(kappa) || lambda <= 0.0 || kappa <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double u = rng_unif();
-  return (pow(u, -1.0/kappa)-1.0) / lambda;
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dlomax(
     const NumericVector& x,
@@ -108,9 +37,10 @@ NumericVector cpp_dlomax(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = logpdf_lomax(GETV(x, i), GETV(lambda, i),
-                        GETV(kappa, i), throw_warning);
+                        GETV(kappa, i), warn);
+  });
 
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -144,9 +74,10 @@ NumericVector cpp_plomax(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_lomax(GETV(x, i), GETV(lambda, i),
-                     GETV(kappa, i), throw_warning);
+                     GETV(kappa, i), warn);
+  });
 
   if (!lower_tail)
     p = 1.0 - p;
@@ -190,9 +121,10 @@ NumericVector cpp_qlomax(
   if (!lower_tail)
     pp = 1.0 - pp;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     x[i] = invcdf_lomax(GETV(pp, i), GETV(lambda, i),
-                        GETV(kappa, i), throw_warning);
+                        GETV(kappa, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -217,9 +149,10 @@ NumericVector cpp_rlomax(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_lomax(GETV(lambda, i), GETV(kappa, i),
-                     throw_warning);
+                     warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
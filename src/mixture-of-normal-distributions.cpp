@@ -240,18 +240,13 @@ NumericVector cpp_rmixnorm(
   if (k != mu.ncol() || k != sigma.ncol())
     Rcpp::stop("sizes of mu, sigma, and alpha do not match");
   
-  int jj;
-  bool wrong_param;
-  double alpha_tot, nans_sum, u, p_tmp;
-  NumericVector prob(k);
-  
-  for (int i = 0; i < n; i++) {
-    jj = 0;
-    wrong_param = false;
-    u = rng_unif();
-    p_tmp = 1.0;
-    alpha_tot = 0.0;
-    nans_sum = 0.0;
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+    int jj = 0;
+    bool wrong_param = false;
+    double u = rng_unif();
+    double p_tmp = 1.0;
+    double alpha_tot = 0.0;
+    double nans_sum = 0.0;
     
     for (int j = 0; j < k; j++) {
       if (GETM(alpha, i, j) < 0.0 || GETM(sigma, i, j) < 0.0) {
@@ -263,9 +258,9 @@ NumericVector cpp_rmixnorm(
     }
     
     if (ISNAN(nans_sum + alpha_tot) || wrong_param) {
-      throw_warning = true;
+      warn = true;
       x[i] = NA_REAL;
-      continue;
+      return;
     }
     
     for (int j = k-1; j >= 0; j--) {
@@ -276,8 +271,8 @@ NumericVector cpp_rmixnorm(
       }
     }
 
-    x[i] = R::rnorm(GETM(mu, i, jj), GETM(sigma, i, jj)); 
-  }
+    x[i] = rng_norm(GETM(mu, i, jj), GETM(sigma, i, jj)); 
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
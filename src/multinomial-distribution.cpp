@@ -134,19 +134,30 @@ NumericMatrix cpp_rmnom(
   }
   
   int k = prob.ncol();
-  bool wrong_values;
-  double p_tmp, size_left, sum_p, p_tot;
-  
   NumericMatrix x(n, k);
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++) {
+  // with a single set of the parameters the first binomial is the same
+  // for all the rows, so its sampler is set up once
+  
+  bool fixed_first = size.length() == 1 && prob.nrow() == 1;
+  BinomFrozen first;
+  
+  if (fixed_first) {
+    double p_tot = 0.0;
+    for (int j = 0; j < k; j++)
+      p_tot += prob(0, j);
+    first = BinomFrozen(size[0], trunc_p(prob(0, 0)/p_tot));
+  }
+  
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     
-    size_left = GETV(size, i);
-    sum_p = 1.0;
-    p_tot = 0.0;
-    wrong_values = false;
+    double size_left = GETV(size, i);
+    double sum_p = 1.0;
+    double p_tot = 0.0;
+    double p_tmp;
+    bool wrong_values = false;
     
     // TODO:
     // sort prob(i,_) first?
@@ -161,16 +172,19 @@ NumericMatrix cpp_rmnom(
     
     if (wrong_values || ISNAN(p_tot + GETV(size, i)) ||
         GETV(size, i) < 0.0 || !isInteger(GETV(size, i), false)) {
-      throw_warning = true;
+      warn = true;
       for (int j = 0; j < k; j++)
         x(i, j) = NA_REAL;
-      continue;
+      return;
     }
 
     for (int j = 0; j < k-1; j++) {
       if ( size_left > 0.0 ) {
         p_tmp = GETM(prob, i, j)/p_tot;
-        x(i, j) = R::rbinom(size_left, trunc_p(p_tmp/sum_p));
+        if (j == 0 && fixed_first)
+          x(i, j) = first.rng();
+        else
+          x(i, j) = rng_binom(size_left, trunc_p(p_tmp/sum_p));
         size_left -= x(i, j);
         sum_p -= p_tmp;
       } else {
@@ -180,7 +194,7 @@ NumericMatrix cpp_rmnom(
     
     x(i, k-1) = size_left;
     
-  }
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
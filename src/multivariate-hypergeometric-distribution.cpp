@@ -95,14 +95,14 @@ NumericVector cpp_dmvhyper(
           !isInteger(GETM(x, i, j))) {
         wrong_x = true;
       } else {
-        lncx_prod += R::lchoose(GETM(n, i, j), GETM(x, i, j));
+        lncx_prod += lchoose_fn(GETM(n, i, j), GETM(x, i, j));
       }
     }
     
     if (wrong_x || sum_x != GETV(k, i)) {
       p[i] = R_NegInf;
     } else {
-      lNck = R::lchoose(n_tot, GETV(k, i));
+      lNck = lchoose_fn(n_tot, GETV(k, i));
       p[i] = lncx_prod - lNck;
     }
     
@@ -136,16 +136,13 @@ NumericMatrix cpp_rmvhyper(
   
   int m = n.ncol();
   NumericMatrix x(nn, m);
-  std::vector<double> n_otr(m);
-  
-  bool wrong_values;
-  double k_left;
   
   bool throw_warning = false;
 
-  for (int i = 0; i < nn; i++) {
+  parallel_rng_for(nn, throw_warning, [&](int i, bool& warn) {
     
-    wrong_values = false;
+    std::vector<double> n_otr(m);
+    bool wrong_values = false;
     n_otr[0] = 0.0;
     
     for (int j = 1; j < m; j++) {
@@ -161,29 +158,29 @@ NumericMatrix cpp_rmvhyper(
         !isInteger(GETM(n, i, 0), false) || GETM(n, i, 0) < 0 ||
         (n_otr[0] + GETM(n, i, 0)) < GETV(k, i) ||
         !isInteger(GETV(k, i), false) || GETV(k, i) < 0.0) {
-      throw_warning = true;
+      warn = true;
       for (int j = 0; j < m; j++)
         x(i, j) = NA_REAL;
-      continue;
+      return;
     }
     
     for (int j = 1; j < m; j++)
       n_otr[j] = n_otr[j-1] - GETM(n, i, j);
     
-    k_left = GETV(k, i);
-    x(i, 0) = R::rhyper(GETM(n, i, 0), n_otr[0], k_left);
+    double k_left = GETV(k, i);
+    x(i, 0) = rng_hyper(GETM(n, i, 0), n_otr[0], k_left);
     k_left -= x(i, 0);
     
     if (m > 2) {
       for (int j = 1; j < m-1; j++) {
-        x(i, j) = R::rhyper(GETM(n, i, j), n_otr[j], k_left);
+        x(i, j) = rng_hyper(GETM(n, i, j), n_otr[j], k_left);
         k_left -= x(i, j);
       }
     }
     
     x(i, m-1) = k_left;
     
-  }
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
@@ -0,0 +1,741 @@
+#include <Rcpp.h>
+#include "shared.h"
+#include "../inst/include/extraDistr/truncated-normal-distribution.h"
+#include <memory>
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::plugins(cpp11)]]
+
+using std::pow;
+using std::sqrt;
+using std::abs;
+using std::exp;
+using std::log;
+using std::floor;
+using std::ceil;
+using Rcpp::NumericVector;
+using Rcpp::NumericMatrix;
+
+
+/*
+ *  Multivariate truncated normal distribution
+ *
+ *  Values:
+ *  x          (R^d)
+ *
+ *  Parameters:
+ *  mu         (R^d)
+ *  Sigma      (d x d, positive definite)
+ *  a < b      (R^d)
+ *
+ *  f(x) = N(x | mu, Sigma) / P(a < X < b)    for a < x < b
+ *
+ *  Exact sampling uses the minimax tilting method of Botev (2017):
+ *
+ *  1. The variables are reordered so that the ones with the narrowest
+ *     truncation intervals come first and Sigma = L L' is decomposed,
+ *     so that X = mu + L Z, with Z sampled sequentially from univariate
+ *     truncated normals.
+ *
+ *  2. Each Z_k is shifted by the tilting parameter m_k, chosen (together
+ *     with the point x) as the saddle point of
+ *
+ *     psi(x, m) = sum_k -x_k m_k + m_k^2/2 + log(Phi(ub_k - m_k) - Phi(lb_k - m_k))
+ *
+ *     where lb_k, ub_k are the bounds of Z_k given x_1, ..., x_{k-1}.
+ *
+ *  3. Draws from the tilted sequential proposal are accepted with
+ *     probability exp(psi(Z, m) - psi*), the same psi is the weight of
+ *     the importance sampling estimate of P(a < X < b).
+ *
+ *  The univariate truncated normals are drawn using the regimes of
+ *  rng_tnorm and their probabilities are computed by TnormTails, so they
+ *  stay accurate far in the tails.
+ *
+ *  Botev, Z.I. (2017). The normal law under linear restrictions:
+ *  simulation and estimation via minimax tilting. Journal of the Royal
+ *  Statistical Society: Series B, 79(1), 125-148.
+ *
+ */
+
+
+// log(Phi(b) - Phi(a))
+
+inline double lnNpr(double a, double b) {
+  return TnormTails(a, b).log_mass;
+}
+
+// Solves A y = b by Gaussian elimination with partial pivoting, A is
+// an n x n row-major matrix, both A and b are overwritten
+
+static bool solve_linear(std::vector<double>& A, std::vector<double>& b, int n) {
+  for (int k = 0; k < n; k++) {
+    int piv = k;
+    for (int i = k+1; i < n; i++) {
+      if (abs(A[i*n + k]) > abs(A[piv*n + k]))
+        piv = i;
+    }
+    if (A[piv*n + k] == 0.0 || ISNAN(A[piv*n + k]))
+      return false;
+    if (piv != k) {
+      for (int j = 0; j < n; j++)
+        std::swap(A[k*n + j], A[piv*n + j]);
+      std::swap(b[k], b[piv]);
+    }
+    for (int i = k+1; i < n; i++) {
+      double f = A[i*n + k] / A[k*n + k];
+      for (int j = k; j < n; j++)
+        A[i*n + j] -= f * A[k*n + j];
+      b[i] -= f * b[k];
+    }
+  }
+  for (int k = n-1; k >= 0; k--) {
+    for (int j = k+1; j < n; j++)
+      b[k] -= A[k*n + j] * b[j];
+    b[k] /= A[k*n + k];
+  }
+  return true;
+}
+
+// Checks that sigma is a symmetric, positive definite matrix and
+// returns its Cholesky factor (row-major, lower triangular)
+
+static std::vector<double> check_sigma(const NumericMatrix& sigma, bool& nan_sigma) {
+
+  int d = sigma.nrow();
+  std::vector<double> L(d*d, 0.0);
+
+  if (sigma.ncol() != d)
+    Rcpp::stop("sigma is not a square matrix");
+
+  nan_sigma = false;
+  for (int i = 0; i < d; i++) {
+    for (int j = 0; j < d; j++) {
+      if (ISNAN(sigma(i, j)))
+        nan_sigma = true;
+    }
+  }
+  if (nan_sigma)
+    return L;
+
+  for (int i = 0; i < d; i++) {
+    for (int j = 0; j < i; j++) {
+      if (abs(sigma(i, j) - sigma(j, i)) >
+            1e-8 * std::max(abs(sigma(i, j)), abs(sigma(j, i))))
+        Rcpp::stop("sigma is not symmetric");
+    }
+  }
+
+  for (int j = 0; j < d; j++) {
+    double s = sigma(j, j);
+    for (int k = 0; k < j; k++)
+      s -= L[j*d + k] * L[j*d + k];
+    if (!(s > 0.0) || !R_FINITE(s))
+      Rcpp::stop("sigma is not positive definite");
+    L[j*d + j] = sqrt(s);
+    for (int i = j+1; i < d; i++) {
+      double t = sigma(i, j);
+      for (int k = 0; k < j; k++)
+        t -= L[i*d + k] * L[j*d + k];
+      L[i*d + j] = t / L[j*d + j];
+    }
+  }
+
+  return L;
+}
+
+
+class MvtnormTilting {
+
+  int d;
+  std::vector<int> perm;      // k-th variable is perm[k]-th in the input
+  std::vector<double> D;      // diagonal of the Cholesky factor
+  std::vector<double> L;      // Cholesky factor, rows divided by D, zero diagonal
+  std::vector<double> lb, ub; // permuted, centered and scaled bounds
+  std::vector<double> mu, x;  // tilting parameter and saddle point, mu[d-1] = x[d-1] = 0
+  std::vector<double> mean;
+  double psi_star;
+
+  // variable reordering and Cholesky decomposition, at each step the
+  // variable with the smallest probability of its truncation interval
+  // (given the expected values of the previous ones) is taken next
+
+  void cholperm(const NumericMatrix& sigma, std::vector<double>& a,
+                std::vector<double>& b) {
+
+    std::vector<double> S(d*d), Lf(d*d, 0.0), z(d, 0.0);
+    for (int i = 0; i < d; i++) {
+      for (int j = 0; j < d; j++)
+        S[i*d + j] = sigma(i, j);
+    }
+
+    for (int j = 0; j < d; j++) {
+
+      int best = j;
+      double pr_best = R_PosInf;
+      for (int i = j; i < d; i++) {
+        double s = S[i*d + i], c = 0.0;
+        for (int k = 0; k < j; k++) {
+          s -= Lf[i*d + k] * Lf[i*d + k];
+          c += Lf[i*d + k] * z[k];
+        }
+        s = sqrt(std::max(s, std::numeric_limits<double>::epsilon()));
+        double pr = lnNpr((a[i] - c) / s, (b[i] - c) / s);
+        if (pr < pr_best) {
+          pr_best = pr;
+          best = i;
+        }
+      }
+
+      if (best != j) {
+        for (int k = 0; k < d; k++)
+          std::swap(S[j*d + k], S[best*d + k]);
+        for (int k = 0; k < d; k++)
+          std::swap(S[k*d + j], S[k*d + best]);
+        for (int k = 0; k < d; k++)
+          std::swap(Lf[j*d + k], Lf[best*d + k]);
+        std::swap(a[j], a[best]);
+        std::swap(b[j], b[best]);
+        std::swap(perm[j], perm[best]);
+      }
+
+      double s = S[j*d + j];
+      for (int k = 0; k < j; k++)
+        s -= Lf[j*d + k] * Lf[j*d + k];
+      Lf[j*d + j] = sqrt(std::max(s, std::numeric_limits<double>::epsilon()));
+      for (int i = j+1; i < d; i++) {
+        double t = S[i*d + j];
+        for (int k = 0; k < j; k++)
+          t -= Lf[i*d + k] * Lf[j*d + k];
+        Lf[i*d + j] = t / Lf[j*d + j];
+      }
+
+      // expected value of the truncated normal, z[j]
+      double c = 0.0;
+      for (int k = 0; k < j; k++)
+        c += Lf[j*d + k] * z[k];
+      double tl = (a[j] - c) / Lf[j*d + j];
+      double tu = (b[j] - c) / Lf[j*d + j];
+      double w = lnNpr(tl, tu);
+      z[j] = (R_FINITE(tl) ? exp(lphi(tl) - w) : 0.0) -
+             (R_FINITE(tu) ? exp(lphi(tu) - w) : 0.0);
+    }
+
+    for (int i = 0; i < d; i++) {
+      D[i] = Lf[i*d + i];
+      for (int j = 0; j < i; j++)
+        L[i*d + j] = Lf[i*d + j] / D[i];
+    }
+    for (int i = 0; i < d; i++) {
+      lb[i] = a[i] / D[i];
+      ub[i] = b[i] / D[i];
+    }
+  }
+
+  // gradient of psi with respect to (x[0..d-2], mu[0..d-2]), and if
+  // jac is not NULL also its Jacobian (row-major)
+
+  void gradpsi(const std::vector<double>& y, std::vector<double>& grad,
+               std::vector<double>* jac) const {
+
+    int m = d - 1;
+    std::vector<double> xx(d, 0.0), mm(d, 0.0), P(d), dP(d);
+    for (int k = 0; k < m; k++) {
+      xx[k] = y[k];
+      mm[k] = y[m + k];
+    }
+
+    for (int k = 0; k < d; k++) {
+      double c = 0.0;
+      for (int j = 0; j < k; j++)
+        c += L[k*d + j] * xx[j];
+      double lt = lb[k] - mm[k] - c;
+      double ut = ub[k] - mm[k] - c;
+      double w = lnNpr(lt, ut);
+      double pl = R_FINITE(lt) ? exp(lphi(lt) - w) : 0.0;
+      double pu = R_FINITE(ut) ? exp(lphi(ut) - w) : 0.0;
+      P[k] = pl - pu;
+      dP[k] = -P[k]*P[k] + (R_FINITE(lt) ? lt*pl : 0.0) -
+              (R_FINITE(ut) ? ut*pu : 0.0);
+    }
+
+    grad.assign(2*m, 0.0);
+    for (int j = 0; j < m; j++) {
+      double s = 0.0;
+      for (int k = j+1; k < d; k++)
+        s += L[k*d + j] * P[k];
+      grad[j] = -mm[j] + s;
+      grad[m + j] = mm[j] - xx[j] + P[j];
+    }
+
+    if (jac == NULL)
+      return;
+
+    std::vector<double>& J = *jac;
+    J.assign(4*m*m, 0.0);
+    int n = 2*m;
+    for (int i = 0; i < m; i++) {
+      for (int j = 0; j < m; j++) {
+        // d2 psi / dx_i dx_j = sum_k L[k,i] dP[k] L[k,j]
+        double s = 0.0;
+        for (int k = std::max(i, j) + 1; k < d; k++)
+          s += L[k*d + i] * dP[k] * L[k*d + j];
+        J[i*n + j] = s;
+        // d2 psi / dmu_i dx_j = -delta_ij + dP[i] L[i,j]
+        double mx = (i == j ? -1.0 : 0.0) + dP[i] * L[i*d + j];
+        J[(m + i)*n + j] = mx;
+        J[j*n + m + i] = mx;
+      }
+      J[(m + i)*n + m + i] = 1.0 + dP[i];
+    }
+  }
+
+  // psi at the point x and tilting parameter mu
+
+  double psi(const std::vector<double>& xx, const std::vector<double>& mm) const {
+    double p = 0.0;
+    for (int k = 0; k < d; k++) {
+      double c = 0.0;
+      for (int j = 0; j < k; j++)
+        c += L[k*d + j] * xx[j];
+      p += lnNpr(lb[k] - mm[k] - c, ub[k] - mm[k] - c) +
+           0.5*mm[k]*mm[k] - xx[k]*mm[k];
+    }
+    return p;
+  }
+
+  // Newton's method with backtracking line search for grad psi = 0,
+  // if it fails, mu = 0 and psi* = 0 (log-probabilities are <= 0) is a
+  // valid, although less efficient, bound for the rejection sampler
+
+  void find_tilting() {
+
+    int m = d - 1;
+    if (m == 0) {
+      psi_star = psi(x, mu);
+      return;
+    }
+
+    std::vector<double> y(2*m, 0.0), grad, J, step, y_new, grad_new;
+    gradpsi(y, grad, &J);
+    double norm = 0.0;
+    for (double g : grad)
+      norm += g*g;
+
+    bool converged = false;
+    for (int iter = 0; iter < 100; iter++) {
+      if (sqrt(norm) < 1e-10) {
+        converged = true;
+        break;
+      }
+      step = grad;
+      if (!solve_linear(J, step, 2*m))
+        break;
+      double t = 1.0, norm_new = R_PosInf;
+      for (int k = 0; k < 30; k++) {
+        y_new = y;
+        for (int i = 0; i < 2*m; i++)
+          y_new[i] -= t * step[i];
+        gradpsi(y_new, grad_new, NULL);
+        norm_new = 0.0;
+        for (double g : grad_new)
+          norm_new += g*g;
+        if (norm_new <= (1.0 - 1e-4*t) * norm)
+          break;
+        t /= 2.0;
+      }
+      if (!(norm_new < norm))
+        break;
+      y = y_new;
+      norm = norm_new;
+      gradpsi(y, grad, &J);
+    }
+
+    if (converged) {
+      for (int k = 0; k < m; k++) {
+        x[k] = y[k];
+        mu[k] = y[m + k];
+      }
+      psi_star = psi(x, mu);
+    }
+    if (!converged || !R_FINITE(psi_star)) {
+      std::fill(x.begin(), x.end(), 0.0);
+      std::fill(mu.begin(), mu.end(), 0.0);
+      psi_star = 0.0;
+    }
+  }
+
+  // draws Z from the tilted proposal, given the uniforms u (or from the
+  // RNG if u is NULL), returns the log-weight psi(Z, mu)
+
+  double proposal(double* z, const double* u) const {
+    double logpr = 0.0;
+    for (int k = 0; k < d; k++) {
+      double c = 0.0;
+      for (int j = 0; j < k; j++)
+        c += L[k*d + j] * z[j];
+      double tl = lb[k] - mu[k] - c;
+      double tu = ub[k] - mu[k] - c;
+      double aa, t;
+      if (u == NULL) {
+        tnorm_regime_t regime = tnorm_regime(tl, tu, aa);
+        t = tnorm_draw(regime, tl, tu, aa);
+        logpr += lnNpr(tl, tu);
+      } else {
+        TnormTails tails(tl, tu);
+        t = (k < d-1) ? tails.invcdf(u[k]) : 0.0;
+        logpr += tails.log_mass;
+      }
+      z[k] = mu[k] + t;
+      logpr += 0.5*mu[k]*mu[k] - mu[k]*z[k];
+    }
+    return logpr;
+  }
+
+public:
+
+  bool invalid;
+
+  MvtnormTilting(const NumericMatrix& sigma, const NumericMatrix& mean_,
+                 const NumericMatrix& lower, const NumericMatrix& upper,
+                 int row)
+    : d(sigma.nrow()), perm(d), D(d), L(d*d, 0.0), lb(d), ub(d),
+      mu(d, 0.0), x(d, 0.0), mean(d), psi_star(0.0), invalid(false) {
+
+    std::vector<double> a(d), b(d);
+    for (int j = 0; j < d; j++) {
+      perm[j] = j;
+      mean[j] = GETM(mean_, row, j);
+      a[j] = GETM(lower, row, j) - mean[j];
+      b[j] = GETM(upper, row, j) - mean[j];
+      if (ISNAN(a[j]) || ISNAN(b[j]) || !(a[j] < b[j]) ||
+          !R_FINITE(mean[j]))
+        invalid = true;
+    }
+    if (invalid)
+      return;
+
+    cholperm(sigma, a, b);
+    find_tilting();
+  }
+
+  // exact draw, false if it was not accepted in max_iter trials
+
+  bool draw(double* out, int max_iter = 1000000) const {
+    std::vector<double> z(d);
+    for (int iter = 0; iter < max_iter; iter++) {
+      double logpr = proposal(z.data(), NULL);
+      if (rng_exp() > psi_star - logpr) {
+        for (int k = 0; k < d; k++) {
+          double c = z[k];
+          for (int j = 0; j < k; j++)
+            c += L[k*d + j] * z[j];
+          out[perm[k]] = mean[perm[k]] + D[k] * c;
+        }
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // log(P(a < X < b)) estimated using n points of the Richtmyer
+  // quasi-random sequence (frac(i * sqrt(prime_k))), so the result is
+  // deterministic
+
+  double log_prob(int n) const {
+
+    if (d == 1)
+      return lnNpr(lb[0], ub[0]);
+
+    std::vector<double> alpha;
+    for (int p = 2; (int) alpha.size() < d-1; p++) {
+      bool prime = true;
+      for (int q = 2; q*q <= p; q++) {
+        if (p % q == 0) {
+          prime = false;
+          break;
+        }
+      }
+      if (prime)
+        alpha.push_back(sqrt((double) p));
+    }
+
+    std::vector<double> z(d), u(d-1);
+    double lsum = R_NegInf;
+    for (int i = 1; i <= n; i++) {
+      for (int k = 0; k < d-1; k++) {
+        double v = i * alpha[k];
+        u[k] = v - floor(v);
+      }
+      lsum = log_add_exp(lsum, proposal(z.data(), u.data()));
+    }
+    return lsum - log((double) n);
+  }
+
+};
+
+
+// number of quasi-random points used for the normalizing constant
+
+static const int MVTNORM_QMC_POINTS = 10000;
+
+
+// [[Rcpp::export]]
+NumericVector cpp_dmvtnorm(
+    const NumericMatrix& x,
+    const NumericMatrix& mean,
+    const NumericMatrix& sigma,
+    const NumericMatrix& lower,
+    const NumericMatrix& upper,
+    const bool& log_prob = false
+  ) {
+
+  if (std::min({x.nrow(), x.ncol(), mean.nrow(), mean.ncol(),
+                sigma.nrow(), lower.nrow(), upper.nrow()}) < 1) {
+    return NumericVector(0);
+  }
+
+  int d = sigma.nrow();
+
+  if (x.ncol() != d || mean.ncol() != d ||
+      lower.ncol() != d || upper.ncol() != d)
+    Rcpp::stop("number of columns in x, mean, lower and upper should equal the dimension of sigma");
+
+  int Nmax = std::max({
+    x.nrow(),
+    mean.nrow(),
+    lower.nrow(),
+    upper.nrow()
+  });
+  NumericVector p(Nmax);
+
+  bool throw_warning = false;
+  bool nan_sigma;
+  std::vector<double> C = check_sigma(sigma, nan_sigma);
+
+  double log_det = 0.0;
+  for (int j = 0; j < d; j++)
+    log_det += log(C[j*d + j]);
+
+  bool shared_params = (mean.nrow() == 1 || identical_rows(mean)) &&
+                       (lower.nrow() == 1 || identical_rows(lower)) &&
+                       (upper.nrow() == 1 || identical_rows(upper));
+  double shared_norm = NAN;
+  bool shared_invalid = false;
+  if (shared_params && !nan_sigma) {
+    MvtnormTilting dist(sigma, mean, lower, upper, 0);
+    shared_invalid = dist.invalid;
+    if (!shared_invalid)
+      shared_norm = dist.log_prob(MVTNORM_QMC_POINTS);
+  }
+
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+
+    double nan_sum = 0.0;
+    bool inside = true;
+    std::vector<double> y(d);
+
+    for (int j = 0; j < d; j++) {
+      double xij = GETM(x, i, j);
+      nan_sum += xij + GETM(mean, i, j) + GETM(lower, i, j) + GETM(upper, i, j);
+      if (!(xij > GETM(lower, i, j) && xij < GETM(upper, i, j)))
+        inside = false;
+      y[j] = xij - GETM(mean, i, j);
+    }
+
+#ifdef IEEE_754
+    if (ISNAN(nan_sum) || nan_sigma) {
+      p[i] = nan_sum + (nan_sigma ? NAN : 0.0);
+      return;
+    }
+#endif
+
+    double norm;
+    if (shared_params) {
+      if (shared_invalid) {
+        warn = true;
+        p[i] = NAN;
+        return;
+      }
+      norm = shared_norm;
+    } else {
+      MvtnormTilting dist(sigma, mean, lower, upper, i);
+      if (dist.invalid) {
+        warn = true;
+        p[i] = NAN;
+        return;
+      }
+      norm = inside ? dist.log_prob(MVTNORM_QMC_POINTS) : 0.0;
+    }
+
+    if (!inside) {
+      p[i] = R_NegInf;
+      return;
+    }
+
+    // solve C y = x - mean
+    double quad = 0.0;
+    for (int j = 0; j < d; j++) {
+      for (int k = 0; k < j; k++)
+        y[j] -= C[j*d + k] * y[k];
+      y[j] /= C[j*d + j];
+      quad += y[j] * y[j];
+    }
+
+    p[i] = -(d * M_LN_SQRT_2PI + log_det + 0.5*quad) - norm;
+  });
+
+  if (!log_prob)
+    p = Rcpp::exp(p);
+
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericMatrix cpp_rmvtnorm(
+    const int& n,
+    const NumericMatrix& mean,
+    const NumericMatrix& sigma,
+    const NumericMatrix& lower,
+    const NumericMatrix& upper,
+    const bool& exact,
+    const NumericMatrix& start,
+    const int& sweeps
+  ) {
+
+  int d = sigma.nrow();
+
+  if (std::min({mean.nrow(), sigma.nrow(), lower.nrow(), upper.nrow()}) < 1) {
+    Rcpp::warning("NAs produced");
+    NumericMatrix out(n, d);
+    std::fill(out.begin(), out.end(), NA_REAL);
+    return out;
+  }
+
+  if (mean.ncol() != d || lower.ncol() != d || upper.ncol() != d)
+    Rcpp::stop("number of columns in mean, lower and upper should equal the dimension of sigma");
+  if (!exact && start.nrow() > 0 && start.ncol() != d)
+    Rcpp::stop("number of columns in start should equal the dimension of sigma");
+  if (!exact && (sweeps < 1 || sweeps == NA_INTEGER))
+    Rcpp::stop("sweeps must be a positive integer");
+
+  NumericMatrix x(n, d);
+
+  bool throw_warning = false;
+  bool nan_sigma;
+  std::vector<double> C = check_sigma(sigma, nan_sigma);
+
+  if (nan_sigma) {
+    Rcpp::warning("NAs produced");
+    std::fill(x.begin(), x.end(), NA_REAL);
+    return x;
+  }
+
+  if (exact) {
+
+    bool shared_params = (mean.nrow() == 1 || identical_rows(mean)) &&
+                         (lower.nrow() == 1 || identical_rows(lower)) &&
+                         (upper.nrow() == 1 || identical_rows(upper));
+    std::unique_ptr<MvtnormTilting> shared;
+    if (shared_params)
+      shared.reset(new MvtnormTilting(sigma, mean, lower, upper, 0));
+
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+      std::unique_ptr<MvtnormTilting> own;
+      const MvtnormTilting* dist = shared.get();
+      if (!shared_params) {
+        own.reset(new MvtnormTilting(sigma, mean, lower, upper, i));
+        dist = own.get();
+      }
+      std::vector<double> row(d);
+      if (dist->invalid || !dist->draw(row.data())) {
+        warn = true;
+        std::fill(row.begin(), row.end(), NA_REAL);
+      }
+      for (int j = 0; j < d; j++)
+        x(i, j) = row[j];
+    });
+
+  } else {
+
+    // precision matrix Q = inverse of sigma, from its Cholesky factor
+
+    std::vector<double> Q(d*d, 0.0), col(d);
+    for (int c = 0; c < d; c++) {
+      std::fill(col.begin(), col.end(), 0.0);
+      col[c] = 1.0;
+      for (int j = 0; j < d; j++) {
+        for (int k = 0; k < j; k++)
+          col[j] -= C[j*d + k] * col[k];
+        col[j] /= C[j*d + j];
+      }
+      for (int j = d-1; j >= 0; j--) {
+        for (int k = j+1; k < d; k++)
+          col[j] -= C[k*d + j] * col[k];
+        col[j] /= C[j*d + j];
+      }
+      for (int j = 0; j < d; j++)
+        Q[j*d + c] = col[j];
+    }
+
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+
+      std::vector<double> z(d), m(d), a(d), b(d);
+      bool wrong_param = false;
+
+      for (int j = 0; j < d; j++) {
+        m[j] = GETM(mean, i, j);
+        a[j] = GETM(lower, i, j);
+        b[j] = GETM(upper, i, j);
+        if (ISNAN(a[j]) || ISNAN(b[j]) || !(a[j] < b[j]) || !R_FINITE(m[j]))
+          wrong_param = true;
+        if (start.nrow() > 0)
+          z[j] = GETM(start, i, j);
+        else
+          z[j] = std::min(std::max(m[j], a[j]), b[j]);
+        if (ISNAN(z[j]))
+          wrong_param = true;
+      }
+
+      if (wrong_param) {
+        warn = true;
+        for (int j = 0; j < d; j++)
+          x(i, j) = NA_REAL;
+        return;
+      }
+
+      // x[j] | x[-j] ~ N(m[j] - sum_{k != j} Q[j,k] (x[k] - m[k]) / Q[j,j],
+      //                  1/Q[j,j]), truncated to (a[j], b[j])
+
+      for (int s = 0; s < sweeps; s++) {
+        for (int j = 0; j < d; j++) {
+          double c = 0.0;
+          for (int k = 0; k < d; k++) {
+            if (k != j)
+              c += Q[j*d + k] * (z[k] - m[k]);
+          }
+          double sd = 1.0 / sqrt(Q[j*d + j]);
+          double cm = m[j] - c * sd * sd;
+          double za = (a[j] - cm) / sd;
+          double zb = (b[j] - cm) / sd;
+          double aa;
+          tnorm_regime_t regime = tnorm_regime(za, zb, aa);
+          z[j] = cm + sd * tnorm_draw(regime, za, zb, aa);
+        }
+      }
+
+      for (int j = 0; j < d; j++)
+        x(i, j) = z[j];
+    });
+
+  }
+
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+
+  return x;
+}
+
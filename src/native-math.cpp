@@ -0,0 +1,61 @@
+#include <Rcpp.h>
+#include "shared.h"
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::plugins(cpp11)]]
+
+using Rcpp::NumericVector;
+
+
+// Evaluates the native special functions (see native_math.h) regardless
+// of EDCPP_NATIVE_MATH, used for testing their accuracy against R
+
+// [[Rcpp::export]]
+NumericVector cpp_native_math(
+    const std::string& fun,
+    const NumericVector& x,
+    const NumericVector& y
+  ) {
+  
+  if (std::min({x.length(), y.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    y.length()
+  });
+  NumericVector p(Nmax);
+  
+  for (int i = 0; i < Nmax; i++) {
+    if (fun == "lgamma") {
+      p[i] = native::lgamma(GETV(x, i));
+    } else if (fun == "gamma") {
+      p[i] = native::gamma(GETV(x, i));
+    } else if (fun == "lbeta") {
+      p[i] = native::lbeta(GETV(x, i), GETV(y, i));
+    } else if (fun == "lchoose") {
+      p[i] = native::lchoose(GETV(x, i), GETV(y, i));
+    } else if (fun == "dnorm") {
+      p[i] = native::dnorm(GETV(x, i));
+    } else if (fun == "ldnorm") {
+      p[i] = native::ldnorm(GETV(x, i));
+    } else if (fun == "pnorm") {
+      p[i] = native::pnorm(GETV(x, i));
+    } else if (fun == "qnorm") {
+      p[i] = native::qnorm(GETV(x, i));
+    } else if (fun == "lpnorm") {
+      p[i] = native::lpnorm(GETV(x, i));
+    } else if (fun == "qnorm_log") {
+      p[i] = native::qnorm_log(GETV(x, i));
+    } else if (fun == "bessel_i") {
+      p[i] = native::bessel_i(GETV(x, i), GETV(y, i), 1.0);
+    } else if (fun == "bessel_i_scaled") {
+      p[i] = native::bessel_i(GETV(x, i), GETV(y, i), 2.0);
+    } else {
+      Rcpp::stop("unknown function");
+    }
+  }
+  
+  return p;
+}
+
@@ -1,5 +1,7 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "table-cache.h"
+#include "../inst/include/extraDistr/negative-hypergeometric-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -75,7 +77,17 @@ NumericVector cpp_dnhyper(
   
   bool throw_warning = false;
   
-  std::map<std::tuple<int, int, int>, std::vector<double>> memo;
+  // The probabilities are evaluated directly in log scale, a table of
+  // the whole support is built only when it has at most MAX_PMF_RATIO
+  // elements per value that shares its parameters.
+  
+  double nsets = std::min(
+    static_cast<double>(Nmax),
+    static_cast<double>(n.length()) * m.length() * r.length()
+  );
+  double max_table = std::min(MAX_CDF_TABLE, MAX_PMF_RATIO * Nmax / nsets);
+  
+  std::map<std::tuple<int, int, int>, table_ptr> memo;
   
   for (int i = 0; i < Nmax; i++) {
     if (i % 100 == 0)
@@ -98,29 +110,33 @@ NumericVector cpp_dnhyper(
       p[i] = NAN;
     } else if (!isInteger(GETV(x, i)) || GETV(x, i) < GETV(r, i) ||
                GETV(x, i) > (GETV(n, i) + GETV(r, i))) {
-      p[i] = 0.0;
-    } else if (is_large_int(GETV(x, i))) {
-      p[i] = NA_REAL;
-      Rcpp::warning("NAs introduced by coercion to integer range");
+      p[i] = log_prob ? R_NegInf : 0.0;
+    } else if (GETV(n, i) >= max_table) {
+      p[i] = logpmf_nhyper(GETV(x, i), GETV(n, i), GETV(m, i), GETV(r, i),
+                           throw_warning);
+      if (!log_prob)
+        p[i] = exp(p[i]);
     } else {
       
-      std::vector<double>& tmp = memo[std::make_tuple(
+      table_ptr& tmp = memo[std::make_tuple(
         static_cast<int>(i % n.length()),
         static_cast<int>(i % m.length()),
         static_cast<int>(i % r.length())
       )];
       
-      if (!tmp.size()) {
-        tmp = nhyper_table(GETV(n, i), GETV(m, i), GETV(r, i), false);
+      if (!tmp) {
+        tmp = cached_table(TABLE_DNHYPER, GETV(n, i), GETV(m, i), GETV(r, i),
+                           to_pos_int(GETV(n, i)) + 1, [&]() {
+          return nhyper_table(GETV(n, i), GETV(m, i), GETV(r, i), false);
+        });
       }
-      p[i] = tmp[to_pos_int( GETV(x, i) - GETV(r, i) )];
+      p[i] = (*tmp)[to_pos_int( GETV(x, i) - GETV(r, i) )];
+      if (log_prob)
+        p[i] = log(p[i]);
       
     }
   } 
   
-  if (log_prob)
-    p = Rcpp::log(p);
-  
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   
@@ -153,7 +169,7 @@ NumericVector cpp_pnhyper(
   
   bool throw_warning = false;
   
-  std::map<std::tuple<int, int, int>, std::vector<double>> memo;
+  std::map<std::tuple<int, int, int>, table_ptr> memo;
   
   for (int i = 0; i < Nmax; i++) {
     if (i % 100 == 0)
@@ -183,16 +199,19 @@ NumericVector cpp_pnhyper(
       Rcpp::warning("NAs introduced by coercion to integer range");
     } else {
       
-      std::vector<double>& tmp = memo[std::make_tuple(
+      table_ptr& tmp = memo[std::make_tuple(
         static_cast<int>(i % n.length()),
         static_cast<int>(i % m.length()),
         static_cast<int>(i % r.length())
       )];
       
-      if (!tmp.size()) {
-        tmp = nhyper_table(GETV(n, i), GETV(m, i), GETV(r, i), true);
+      if (!tmp) {
+        tmp = cached_table(TABLE_PNHYPER, GETV(n, i), GETV(m, i), GETV(r, i),
+                           to_pos_int(GETV(n, i)) + 1, [&]() {
+          return nhyper_table(GETV(n, i), GETV(m, i), GETV(r, i), true);
+        });
       }
-      p[i] = tmp[to_pos_int( GETV(x, i) - GETV(r, i) )];
+      p[i] = (*tmp)[to_pos_int( GETV(x, i) - GETV(r, i) )];
       
     }
   } 
@@ -210,6 +229,43 @@ NumericVector cpp_pnhyper(
 }
 
 
+// Cumulative table with its guide table, both kept in the table cache,
+// so the quantiles and random draws cost O(1) on average instead of
+// scanning the table.
+
+typedef std::pair<table_ptr, table_ptr> nhyper_guided;
+typedef std::map<std::tuple<int, int, int>, nhyper_guided> nhyper_memo;
+
+const nhyper_guided& guided_nhyper_table(
+    nhyper_memo& memo, int i,
+    const NumericVector& n,
+    const NumericVector& m,
+    const NumericVector& r
+  ) {
+  
+  nhyper_guided& tab = memo[std::make_tuple(
+    static_cast<int>(i % n.length()),
+    static_cast<int>(i % m.length()),
+    static_cast<int>(i % r.length())
+  )];
+  
+  if (!tab.first) {
+    int len = to_pos_int(GETV(n, i)) + 1;
+    tab.first = cached_table(TABLE_PNHYPER, GETV(n, i), GETV(m, i), GETV(r, i),
+                             len, [&]() {
+      return nhyper_table(GETV(n, i), GETV(m, i), GETV(r, i), true);
+    });
+    const table_ptr& cdf = tab.first;
+    tab.second = cached_table(TABLE_GNHYPER, GETV(n, i), GETV(m, i), GETV(r, i),
+                              len, [&]() {
+      return guide_table(*cdf);
+    });
+  }
+  
+  return tab;
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_qnhyper(
     const NumericVector& p,
@@ -242,7 +298,7 @@ NumericVector cpp_qnhyper(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  std::map<std::tuple<int, int, int>, std::vector<double>> memo;
+  nhyper_memo memo;
   
   for (int i = 0; i < Nmax; i++) {
     if (i % 100 == 0)
@@ -266,22 +322,8 @@ NumericVector cpp_qnhyper(
       x[i] = NAN;
     } else {
       
-      std::vector<double>& tmp = memo[std::make_tuple(
-        static_cast<int>(i % n.length()),
-        static_cast<int>(i % m.length()),
-        static_cast<int>(i % r.length())
-      )];
-      
-      if (!tmp.size()) {
-        tmp = nhyper_table(GETV(n, i), GETV(m, i), GETV(r, i), true);
-      }
-      
-      for (int j = 0; j <= to_pos_int( GETV(n, i) ); j++) {
-        if (tmp[j] >= GETV(pp, i)) {
-          x[i] = to_dbl(j) + GETV(r, i);
-          break;
-        }
-      }
+      const nhyper_guided& tab = guided_nhyper_table(memo, i, n, m, r);
+      x[i] = guided_quantile(*tab.first, *tab.second, GETV(pp, i)) + GETV(r, i);
       
     }
   } 
@@ -311,7 +353,7 @@ NumericVector cpp_rnhyper(
   
   bool throw_warning = false;
   
-  std::map<std::tuple<int, int, int>, std::vector<double>> memo;
+  nhyper_memo memo;
   
   for (int i = 0; i < nn; i++) {
     if (i % 100 == 0)
@@ -325,24 +367,9 @@ NumericVector cpp_rnhyper(
       x[i] = NA_REAL;
     } else {
 
-      std::vector<double>& tmp = memo[std::make_tuple(
-        static_cast<int>(i % n.length()),
-        static_cast<int>(i % m.length()),
-        static_cast<int>(i % r.length())
-      )];
-      
-      if (!tmp.size()) {
-        tmp = nhyper_table(GETV(n, i), GETV(m, i), GETV(r, i), true);
-      }
-      
+      const nhyper_guided& tab = guided_nhyper_table(memo, i, n, m, r);
       u = rng_unif();
-      
-      for (int j = 0; j <= to_pos_int( GETV(n, i) ); j++) {
-        if (tmp[j] >= u) {
-          x[i] = to_dbl(j) + GETV(r, i);
-          break;
-        }
-      }
+      x[i] = guided_quantile(*tab.first, *tab.second, u) + GETV(r, i);
       
     }
   } 
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/non-standart-beta-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,74 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
-*  Non-standard beta distribution
-*
-*  Values:
-*  x
-*
-*  Parameters:
-*  0 <= beta <= 1
-*  alpha > 0
-*  lower < upper
-*
-*/
-
-double pdf_nsbeta(double x, double alpha, double beta, double l,
-                  double u, bool log_p, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta) || ISNAN(l) || ISNAN(u))
-    return x+alpha+beta+l+u;
-#endif
-  if (l >= u || alpha < 0.0 || beta < 0.0) {
-    Rcpp::warning("NaNs produced");
-    return NAN;
-  }
-  double r = u-l;
-  double p = R::dbeta((x-l)/r, alpha, beta, log_p);
-  if (log_p) 
-    return p-log(r);
-  else
-    return p/r;
-}
-
-double cdf_nsbeta(double x, double alpha, double beta, double l,
-                  double u, bool lower_tail, bool log_p, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta) || ISNAN(l) || ISNAN(u))
-    return x+alpha+beta+l+u;
-#endif
-  if (l >= u || alpha < 0.0 || beta < 0.0) {
-    Rcpp::warning("NaNs produced");
-    return NAN;
-  }
-  return R::pbeta((x-l)/(u-l), alpha, beta, lower_tail, log_p);
-}
-
-double invcdf_nsbeta(double p, double alpha, double beta, double l,
-                     double u, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(alpha) || ISNAN(beta) || ISNAN(l) || ISNAN(u))
-    return p+alpha+beta+l+u;
-#endif
-  if (l >= u || alpha < 0.0 || beta < 0.0 || !VALID_PROB(p)) {
-    Rcpp::warning("NaNs produced");
-    return NAN;
-  }
-  return R::qbeta(p, alpha, beta, true, false) * (u-l) + l;
-}
-
-double rng_nsbeta(double alpha, double beta, double l, double u,
-                  bool& throw_warning) {
-  if (ISNAN(alpha) || ISNAN(beta) || ISNAN(l) || ISNAN(u) ||
-      l >= u || alpha < 0.0 || beta < 0.0) {
-    Rcpp::warning("NAs produced");
-    return NA_REAL;
-  }
-  return R::rbeta(alpha, beta) * (u-l) + l;
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dnsbeta(
     const NumericVector& x,
@@ -108,10 +41,11 @@ NumericVector cpp_dnsbeta(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = pdf_nsbeta(GETV(x, i), GETV(alpha, i),
                       GETV(beta, i), GETV(lower, i),
-                      GETV(upper, i), log_prob, throw_warning);
+                      GETV(upper, i), log_prob, warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -148,11 +82,12 @@ NumericVector cpp_pnsbeta(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_nsbeta(GETV(x, i), GETV(alpha, i),
                       GETV(beta, i), GETV(lower, i),
                       GETV(upper, i), lower_tail,
-                      log_prob, throw_warning);
+                      log_prob, warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -196,10 +131,11 @@ NumericVector cpp_qnsbeta(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     x[i] = invcdf_nsbeta(GETV(pp, i), GETV(alpha, i),
                          GETV(beta, i), GETV(lower, i),
-                         GETV(upper, i), throw_warning);
+                         GETV(upper, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -227,10 +163,11 @@ NumericVector cpp_rnsbeta(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_nsbeta(GETV(alpha, i), GETV(beta, i),
                       GETV(lower, i), GETV(upper, i),
-                      throw_warning);
+                      warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
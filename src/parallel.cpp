@@ -0,0 +1,67 @@
+#include <Rcpp.h>
+#include "shared.h"
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::plugins(cpp11)]]
+
+
+static int num_threads = 1;
+static warning_buffer* deferred_warnings = NULL;
+
+
+int get_num_threads() {
+#ifdef _OPENMP
+  return num_threads;
+#else
+  return 1;
+#endif
+}
+
+int set_num_threads(int n) {
+  int old = get_num_threads();
+  if (n < 1 || n == NA_INTEGER)
+    Rcpp::stop("number of threads must be a positive integer");
+  num_threads = n;
+  return old;
+}
+
+static void deferred_warning(const char* msg) {
+#ifdef _OPENMP
+  if (deferred_warnings != NULL && omp_in_parallel()) {
+    (*deferred_warnings)[omp_get_thread_num()].push_back(msg);
+    return;
+  }
+#endif
+  Rcpp::warning(msg);
+}
+
+void begin_deferred_warnings(warning_buffer* buffer) {
+  deferred_warnings = buffer;
+  kernel_warning_handler() = deferred_warning;
+}
+
+void end_deferred_warnings() {
+  warning_buffer* buffer = deferred_warnings;
+  deferred_warnings = NULL;
+  kernel_warning_handler() = NULL;
+  if (buffer == NULL)
+    return;
+  // threads got consecutive chunks, so this is the serial order
+  for (size_t t = 0; t < buffer->size(); t++) {
+    for (size_t j = 0; j < (*buffer)[t].size(); j++)
+      Rcpp::warning((*buffer)[t][j]);
+  }
+}
+
+
+// [[Rcpp::export]]
+int cpp_set_threads(
+    const int& n
+  ) {
+  return set_num_threads(n);
+}
+
+
+// [[Rcpp::export]]
+int cpp_get_threads() {
+  return get_num_threads();
+}
@@ -0,0 +1,112 @@
+#ifndef EDCPP_PARALLEL_H
+#define EDCPP_PARALLEL_H
+
+#include <vector>
+#include <string>
+#include "rng.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// vectors shorter than this are always processed serially,
+// for them the cost of starting threads outweighs the gains
+
+static const int MIN_PARALLEL_N = 10000;
+
+typedef std::vector< std::vector<std::string> > warning_buffer;
+
+int get_num_threads();
+int set_num_threads(int n);
+
+// While a multithreaded loop runs, kernel_warning() messages raised from
+// the worker threads are buffered (R API is not thread-safe) and replayed
+// from the main thread after the loop finishes.
+
+void begin_deferred_warnings(warning_buffer* buffer);
+void end_deferred_warnings();
+
+
+/*
+ * Evaluate kernel(i, throw_warning) for i = 0, ..., n-1
+ *
+ * With more than one thread the range is split into contiguous chunks
+ * (static schedule, so the chunks are assigned in thread order), each
+ * element is computed by exactly the same scalar code as in the serial
+ * case, so the results are bit-identical. Warning flags are collected
+ * per thread and merged.
+ *
+ */
+
+template <typename Kernel>
+inline void parallel_for(int n, bool& throw_warning, Kernel kernel) {
+
+#ifdef _OPENMP
+  int nthreads = get_num_threads();
+
+  if (nthreads > 1 && n >= MIN_PARALLEL_N) {
+
+    std::vector<char> flags(nthreads, 0);
+    warning_buffer messages(nthreads);
+    begin_deferred_warnings(&messages);
+
+#pragma omp parallel num_threads(nthreads)
+{
+    bool warn = false;
+
+#pragma omp for schedule(static)
+    for (int i = 0; i < n; i++)
+      kernel(i, warn);
+
+    flags[omp_get_thread_num()] = warn;
+}
+
+    end_deferred_warnings();
+
+    for (int t = 0; t < nthreads; t++) {
+      if (flags[t])
+        throw_warning = true;
+    }
+    return;
+  }
+#endif
+
+  for (int i = 0; i < n; i++)
+    kernel(i, throw_warning);
+}
+
+
+/*
+ * Random generation loop: x[i] = kernel(i, throw_warning)
+ *
+ * With R's generator the loop is serial and draws from R's RNG exactly
+ * as before. With the Philox generator, a seed is drawn once from R's
+ * RNG and the i-th value uses its own stream (seed, i), so the result
+ * does not depend on the number of threads nor on how the range is split.
+ *
+ * Kernels must draw only through rng_unif(), rng_norm(), rng_exp()
+ * and the other stream-aware samplers.
+ *
+ */
+
+template <typename Kernel>
+inline void parallel_rng_for(int n, bool& throw_warning, Kernel kernel) {
+
+  if (get_rng_kind() == RNG_R) {
+    for (int i = 0; i < n; i++)
+      kernel(i, throw_warning);
+    return;
+  }
+
+  uint64_t seed = rng_seed();
+
+  parallel_for(n, throw_warning, [&](int i, bool& warn) {
+    PhiloxStream stream(seed, static_cast<uint64_t>(i));
+    rng_stream() = &stream;
+    kernel(i, warn);
+    rng_stream() = NULL;
+  });
+}
+
+
+#endif
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/pareto-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,75 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
- *  Pareto distribution
- *
- *  Values:
- *  x
- *
- *  Parameters:
- *  a, b > 0
- *
- *  f(x)    = (a*b^a) / x^{a+1}
- *  F(x)    = 1 - (b/x)^a
- *  F^-1(p) = b/(1-p)^{1-a}
- *
- */
-
-inline double logpdf_pareto(double x, double a, double b,
-                            bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(a) || ISNAN(b))
-    return x+a+b;
-#endif
-  if (a <= 0.0 || b <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < b)
-    return R_NegInf;
-  // a * pow(b, a) / pow(x, a+1.0);
-  return log(a) + log(b)*a - log(x)*(a+1.0);
-}
-
-inline double cdf_pareto(double x, double a, double b,
-                         bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(a) || ISNAN(b))
-    return x+a+b;
-#endif
-  if (a <= 0.0 || b <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < b)
-    return 0.0;
-  return 1.0 - pow(b/x, a);
-}
-
-inline double invcdf_pareto(double p, double a, double b,
-                            bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(a) || ISNAN(b))
-    return p+a+b;
-#endif
-  if (a <= 0.0 || b <= 0.0 || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  return b / pow(1.0-p, 1.0/a);
-}
-
-inline double rng_pareto(double a, double b, bool& throw_warning) {
-  if (ISNAN(a) || ISNAN(b) || a <= 0.0 || b <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double u = rng_unif();
-  return b / pow(u, 1.0/a);
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dpareto(
     const NumericVector& x,
@@ -103,9 +35,10 @@ NumericVector cpp_dpareto(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = logpdf_pareto(GETV(x, i), GETV(a, i),
-                         GETV(b, i), throw_warning);
+                         GETV(b, i), warn);
+  });
 
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -139,9 +72,10 @@ NumericVector cpp_ppareto(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_pareto(GETV(x, i), GETV(a, i),
-                      GETV(b, i), throw_warning);
+                      GETV(b, i), warn);
+  });
 
   if (!lower_tail)
     p = 1.0 - p;
@@ -185,9 +119,10 @@ NumericVector cpp_qpareto(
   if (!lower_tail)
     pp = 1.0 - pp;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     x[i] = invcdf_pareto(GETV(pp, i), GETV(a, i),
-                         GETV(b, i), throw_warning);
+                         GETV(b, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -212,9 +147,10 @@ NumericVector cpp_rpareto(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_pareto(GETV(a, i), GETV(b, i),
-                      throw_warning);
+                      warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
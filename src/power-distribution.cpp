@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/power-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,82 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
-*  Power distribution
-*
-*  Values:
-*  0 < x < alpha
-*
-*  Parameters:
-*  alpha > 0
-*  beta > 0
-*
-*  f(x)    = (beta*x^(beta-1)) / (alpha^beta)
-*  F(x)    = x^beta / alpha^beta
-*  F^-1(p) = alpha * p^(1/beta)
-*
-*/
-
-
-inline double logpdf_power(double x, double alpha, double beta,
-                           bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta))
-    return x+alpha+beta;
-#endif
-  if (alpha <= 0.0 || beta <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x <= 0.0 || x >= alpha)
-    return R_NegInf;
-  // beta * pow(x, beta-1.0) / pow(alpha, beta);
-  return log(beta) + log(x)*(beta-1.0) - log(alpha)*beta;
-}
-
-inline double cdf_power(double x, double alpha, double beta,
-                        bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta))
-    return x+alpha+beta;
-#endif
-  if (alpha <= 0.0 || beta <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x <= 0.0)
-    return 0.0;
-  if (x >= alpha)
-    return 1.0;
-  // pow(x, beta) / pow(alpha, beta);
-  return exp( log(x)*beta - log(alpha)*beta );
-}
-
-inline double invcdf_power(double p, double alpha, double beta,
-                           bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(alpha) || ISNAN(beta))
-    return p+alpha+beta;
-#endif
-  if (alpha <= 0.0 || beta <= 0.0 || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  return alpha * pow(p, 1.0/beta);
-}
-
-inline double rng_power(double alpha, double beta,
-                        bool& throw_warning) {
-  if (ISNAN(alpha) || ISNAN(beta) ||
-      alpha <= 0.0 || beta <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double u = rng_unif();
-  return alpha * pow(u, 1.0/beta);
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dpower(
     const NumericVector& x,
@@ -110,9 +35,10 @@ NumericVector cpp_dpower(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = logpdf_power(GETV(x, i), GETV(alpha, i),
-                        GETV(beta, i), throw_warning);
+                        GETV(beta, i), warn);
+  });
 
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -146,9 +72,10 @@ NumericVector cpp_ppower(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_power(GETV(x, i), GETV(alpha, i),
-                     GETV(beta, i), throw_warning);
+                     GETV(beta, i), warn);
+  });
 
   if (!lower_tail)
     p = 1.0 - p;
@@ -192,9 +119,10 @@ NumericVector cpp_qpower(
   if (!lower_tail)
     pp = 1.0 - pp;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     x[i] = invcdf_power(GETV(pp, i), GETV(alpha, i),
-                        GETV(beta, i), throw_warning);
+                        GETV(beta, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -219,9 +147,10 @@ NumericVector cpp_rpower(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_power(GETV(alpha, i), GETV(beta, i),
-                     throw_warning);
+                     warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
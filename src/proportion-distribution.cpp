@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/proportion-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,69 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
-*  Re-parametrized beta distribution
-*
-*  Values:
-*  x
-*
-*  Parameters:
-*  0 <= mean <= 1
-*  size > 0
-*  prior >= 0
-*
-*/
-
-inline double pdf_prop(double x, double size, double mean, double prior,
-                       bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(size) || ISNAN(mean) || ISNAN(prior))
-    return x+size+mean+prior;
-#endif
-  if (size <= 0.0 || mean <= 0.0 || mean >= 1.0 || prior < 0) {
-    throw_warning = true;
-    return NAN;
-  }
-  return R::dbeta(x, size*mean+prior, size*(1.0-mean)+prior, false);
-}
-
-inline double cdf_prop(double x, double size, double mean, double prior,
-                       bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(size) || ISNAN(mean) || ISNAN(prior))
-    return x+size+mean+prior;
-#endif
-  if (size <= 0.0 || mean <= 0.0 || mean >= 1.0 || prior < 0) {
-    throw_warning = true;
-    return NAN;
-  }
-  return R::pbeta(x, size*mean+prior, size*(1.0-mean)+prior, true, false);
-}
-
-inline double invcdf_prop(double p, double size, double mean, double prior,
-                          bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(size) || ISNAN(mean) || ISNAN(prior))
-    return p+size+mean+prior;
-#endif
-  if (size <= 0.0 || mean <= 0.0 || mean >= 1.0 || prior < 0 || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  return R::qbeta(p, size*mean+prior, size*(1.0-mean)+prior, true, false);
-}
-
-inline double rng_prop(double size, double mean, double prior,
-                       bool& throw_warning) {
-  if (ISNAN(size) || ISNAN(mean) || ISNAN(prior) ||
-      size <= 0.0 || mean <= 0.0 || mean >= 1.0 || prior < 0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  return R::rbeta(size*mean+prior, size*(1.0-mean)+prior);
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dprop(
     const NumericVector& x,
@@ -100,10 +38,11 @@ NumericVector cpp_dprop(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = pdf_prop(GETV(x, i), GETV(size, i),
                     GETV(mean, i), GETV(prior, i),
-                    throw_warning);
+                    warn);
+  });
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -140,10 +79,11 @@ NumericVector cpp_pprop(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_prop(GETV(x, i), GETV(size, i),
                     GETV(mean, i), GETV(prior, i),
-                    throw_warning);
+                    warn);
+  });
   
   if (!lower_tail)
     p = 1.0 - p;
@@ -190,10 +130,11 @@ NumericVector cpp_qprop(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     x[i] = invcdf_prop(GETV(pp, i), GETV(size, i),
                        GETV(mean, i), GETV(prior, i),
-                       throw_warning);
+                       warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -219,9 +160,10 @@ NumericVector cpp_rprop(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_prop(GETV(size, i), GETV(mean, i),
-                    GETV(prior, i), throw_warning);
+                    GETV(prior, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
@@ -13,8 +13,11 @@ NumericVector cpp_rsign(
   
   NumericVector x(n);
   
-  for (int i = 0; i < n; i++)
+  bool throw_warning = false;
+  
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_sign();
+  });
   
   return x;
 }
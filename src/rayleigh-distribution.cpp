@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/rayleigh-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,80 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
- *  Rayleigh distribution
- *
- *  Values:
- *  x >= 0
- *
- *  Parameters:
- *  sigma > 0
- *
- *  f(x)    = x/sigma^2 * exp(-(x^2 / 2*sigma^2))
- *  F(x)    = 1 - exp(-x^2 / 2*sigma^2)
- *  F^-1(p) = sigma * sqrt(-2 * log(1-p))
- *
- */
-
-
-inline double logpdf_rayleigh(double x, double sigma,
-                              bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(sigma))
-    return x+sigma;
-#endif
-  if (sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x <= 0.0 || !R_FINITE(x))
-    return R_NegInf;
-  // x/(sigma*sigma) * exp(-(x*x) / (2.0*(sigma*sigma)));
-  double lsigsq = 2.0 * log(sigma);
-  double lxsq = 2.0 * log(x);
-  return log(x) - lsigsq - exp( lxsq - LOG_2F - lsigsq );
-}
-
-inline double cdf_rayleigh(double x, double sigma,
-                           bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(sigma))
-    return x+sigma;
-#endif
-  if (sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0)
-    return 0.0;
-  if (!R_FINITE(x))
-    return 1.0;
-  return 1.0 - exp(-(x*x) / (2.0*(sigma*sigma)));
-}
-
-inline double invcdf_rayleigh(double p, double sigma,
-                              bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(sigma))
-    return p+sigma;
-#endif
-  if (!VALID_PROB(p) || sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  return sqrt(-2.0*(sigma*sigma) * log(1.0-p));
-}
-
-inline double rng_rayleigh(double sigma, bool& throw_warning) {
-  if (ISNAN(sigma) || sigma <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double u = rng_unif();
-  return sqrt(-2.0*(sigma*sigma) * log(u));
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_drayleigh(
     const NumericVector& x,
@@ -106,9 +33,10 @@ NumericVector cpp_drayleigh(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = logpdf_rayleigh(GETV(x, i), GETV(sigma, i),
-                           throw_warning);
+                           warn);
+  });
 
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -140,9 +68,10 @@ NumericVector cpp_prayleigh(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_rayleigh(GETV(x, i), GETV(sigma, i),
-                        throw_warning);
+                        warn);
+  });
 
   if (!lower_tail)
     p = 1.0 - p;
@@ -184,9 +113,10 @@ NumericVector cpp_qrayleigh(
   if (!lower_tail)
     pp = 1.0 - pp;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     q[i] = invcdf_rayleigh(GETV(pp, i), GETV(sigma, i),
-                           throw_warning);
+                           warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -210,8 +140,9 @@ NumericVector cpp_rrayleigh(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < n; i++)
-    x[i] = rng_rayleigh(GETV(sigma, i), throw_warning);
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+    x[i] = rng_rayleigh(GETV(sigma, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
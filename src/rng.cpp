@@ -0,0 +1,67 @@
+#include <Rcpp.h>
+#include "shared.h"
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::plugins(cpp11)]]
+
+
+static int rng_kind = RNG_R;
+
+
+int get_rng_kind() {
+  return rng_kind;
+}
+
+int set_rng_kind(int kind) {
+  int old = rng_kind;
+  if (kind != RNG_R && kind != RNG_PHILOX)
+    Rcpp::stop("unknown random number generator");
+  rng_kind = kind;
+  return old;
+}
+
+int get_norm_kind() {
+  return rng_norm_kind();
+}
+
+int set_norm_kind(int kind) {
+  int old = rng_norm_kind();
+  if (kind != NORM_INVERSION && kind != NORM_ZIGGURAT)
+    Rcpp::stop("unknown normal generator");
+  rng_norm_kind() = kind;
+  return old;
+}
+
+uint64_t rng_seed() {
+  // R's generators return (at least) 32 random bits per draw
+  uint64_t hi = static_cast<uint64_t>(R::unif_rand() * 4294967296.0);
+  uint64_t lo = static_cast<uint64_t>(R::unif_rand() * 4294967296.0);
+  return (hi << 32) | lo;
+}
+
+
+// [[Rcpp::export]]
+int cpp_set_rng_kind(
+    const int& kind
+  ) {
+  return set_rng_kind(kind);
+}
+
+
+// [[Rcpp::export]]
+int cpp_get_rng_kind() {
+  return get_rng_kind();
+}
+
+
+// [[Rcpp::export]]
+int cpp_set_norm_kind(
+    const int& kind
+  ) {
+  return set_norm_kind(kind);
+}
+
+
+// [[Rcpp::export]]
+int cpp_get_norm_kind() {
+  return get_norm_kind();
+}
@@ -0,0 +1,28 @@
+#ifndef EDCPP_RNG_H
+#define EDCPP_RNG_H
+
+#include <cstdint>
+#include "../inst/include/extraDistr/rng.h"
+
+// Kinds of the random number generators:
+//
+// RNG_R       R's global generator and R's samplers, as in base R
+// RNG_PHILOX  counter-based Philox4x32-10 streams, one per generated value,
+//             seeded from R's generator (so affected by set.seed)
+
+enum rng_kind_t { RNG_R = 0, RNG_PHILOX = 1 };
+
+int get_rng_kind();
+int set_rng_kind(int kind);
+
+// normal and exponential samplers, see norm_kind_t in
+// inst/include/extraDistr/shared.h
+
+int get_norm_kind();
+int set_norm_kind(int kind);
+
+
+uint64_t rng_seed();    // 64-bit seed drawn from R's generator
+
+
+#endif
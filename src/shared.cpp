@@ -1,20 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
 
-bool isInteger(double x, bool warn) {
-  if (ISNAN(x))
-    return false;
-  if (((x < 0.0) ? std::ceil(x) : std::floor(x)) != x) {
-    if (warn) {
-      char msg[55];
-      std::snprintf(msg, sizeof(msg), "non-integer: %f", x);
-      Rcpp::warning(msg);
-    }
-    return false;
-  }
-  return true;
-}
-
 double finite_max_int(const Rcpp::NumericVector& x) {
   double max_x = 0.0;
   int n = x.length();
@@ -35,12 +21,13 @@ double finite_max_int(const Rcpp::NumericVector& x) {
   return max_x;
 }
 
-double rng_unif() {
-  double u;
-  // same as in base R
-  do {
-    u = R::unif_rand();
-  } while (u <= 0.0 || u >= 1.0);
-  return u;
+bool identical_rows(const Rcpp::NumericMatrix& x) {
+  for (int j = 0; j < x.ncol(); j++) {
+    for (int i = 1; i < x.nrow(); i++) {
+      if (x(i, j) != x(0, j))
+        return false;
+    }
+  }
+  return true;
 }
 
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/skellam-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,41 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
- * Skellam distribution
- * 
- * mu1 >= 0
- * mu2 >= 0
- * 
- */
-
-inline double pmf_skellam(double x, double mu1, double mu2,
-                          bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu1) || ISNAN(mu2))
-    return x+mu1+mu2;
-#endif
-  if (mu1 < 0.0 || mu2 < 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (!isInteger(x) || !R_FINITE(x))
-    return 0.0;
-  return exp(-(mu1+mu2)) * pow(mu1/mu2, x/2.0) *
-    R::bessel_i(2.0*sqrt(mu1*mu2), x, 1.0);
-}
-
-inline double rng_skellam(double mu1, double mu2,
-                          bool& throw_warning) {
-  if (ISNAN(mu1) || ISNAN(mu2) || mu1 < 0.0 || mu2 < 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  return R::rpois(mu1) - R::rpois(mu2);
-}
-
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dskellam(
     const NumericVector& x,
@@ -69,9 +35,17 @@ NumericVector cpp_dskellam(
   
   bool throw_warning = false;
   
+#ifdef EDCPP_NATIVE_MATH
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+    p[i] = pmf_skellam(GETV(x, i), GETV(mu1, i),
+                       GETV(mu2, i), warn);
+  });
+#else
+  // R's bessel_i() uses R_alloc, so it cannot be called from other threads
   for (int i = 0; i < Nmax; i++)
     p[i] = pmf_skellam(GETV(x, i), GETV(mu1, i),
                        GETV(mu2, i), throw_warning);
+#endif
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -99,9 +73,10 @@ NumericVector cpp_rskellam(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_skellam(GETV(mu1, i), GETV(mu2, i),
-                       throw_warning);
+                       warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
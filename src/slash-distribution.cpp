@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/slash-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,61 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
- * Location-scale slash distribution
- * 
- * Parameters:
- * mu
- * sigma > 0
- * 
- * 
- */
-
-
-inline double pdf_slash(double x, double mu, double sigma,
-                        bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
-    return x+mu+sigma;
-#endif
-  if (sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  double z = (x - mu)/sigma;
-  if (z == 0.0)
-    return 0.19947114020071635; // 1.0/(2.0 * SQRT_2_PI);
-  return ((PHI_0 - phi(z))/(z*z))/sigma;
-}
-
-inline double cdf_slash(double x, double mu, double sigma,
-                        bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
-    return x+mu+sigma;
-#endif
-  if (sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  double z = (x - mu)/sigma;
-  if (z == 0.0)
-    return 0.5;
-  return Phi(z) - (PHI_0 - phi(z))/z;
-}
-
-inline double rng_slash(double mu, double sigma,
-                        bool& throw_warning) {
-  if (ISNAN(mu) || ISNAN(sigma) || sigma <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double z = R::norm_rand();
-  double u = rng_unif();
-  return z/u*sigma + mu;
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dslash(
     const NumericVector& x,
@@ -89,9 +35,10 @@ NumericVector cpp_dslash(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = pdf_slash(GETV(x, i), GETV(mu, i),
-                     GETV(sigma, i), throw_warning);
+                     GETV(sigma, i), warn);
+  });
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -125,9 +72,10 @@ NumericVector cpp_pslash(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_slash(GETV(x, i), GETV(mu, i),
-                     GETV(sigma, i), throw_warning);
+                     GETV(sigma, i), warn);
+  });
   
   if (!lower_tail)
     p = 1.0 - p;
@@ -158,9 +106,10 @@ NumericVector cpp_rslash(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_slash(GETV(mu, i), GETV(sigma, i),
-                     throw_warning);
+                     warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
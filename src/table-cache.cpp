@@ -0,0 +1,146 @@
+#include <Rcpp.h>
+#include "shared.h"
+#include "table-cache.h"
+#include <list>
+#include <unordered_map>
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::plugins(cpp11)]]
+
+
+struct TableKey {
+  int kind;
+  double a, b, c;
+  
+  bool operator==(const TableKey& other) const {
+    return kind == other.kind && a == other.a &&
+      b == other.b && c == other.c;
+  }
+};
+
+struct TableKeyHash {
+  size_t operator()(const TableKey& key) const {
+    std::hash<double> h;
+    size_t seed = static_cast<size_t>(key.kind);
+    // + 0.0 so that -0 and 0 have the same hash
+    seed ^= h(key.a + 0.0) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= h(key.b + 0.0) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= h(key.c + 0.0) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+  }
+};
+
+typedef std::pair<TableKey, table_ptr> table_entry;
+typedef std::list<table_entry> table_list;
+
+
+static table_list tables;   // most recently used first
+static std::unordered_map<TableKey, table_list::iterator, TableKeyHash> table_index;
+static double used_bytes = 0.0;
+static double max_bytes = 33554432.0;   // 32 MB
+
+
+inline double table_bytes(const table_ptr& tab) {
+  return static_cast<double>(tab->size() * sizeof(double));
+}
+
+static void evict(double limit) {
+  while (!tables.empty() && used_bytes > limit) {
+    used_bytes -= table_bytes(tables.back().second);
+    table_index.erase(tables.back().first);
+    tables.pop_back();
+  }
+}
+
+static void erase_table(table_list::iterator it) {
+  used_bytes -= table_bytes(it->second);
+  table_index.erase(it->first);
+  tables.erase(it);
+}
+
+
+table_ptr cached_table(int kind, double a, double b, double c,
+                       int length, table_builder build) {
+  
+  TableKey key = { kind, a, b, c };
+  auto found = table_index.find(key);
+  
+  if (found != table_index.end()) {
+    table_list::iterator it = found->second;
+    if (static_cast<int>(it->second->size()) >= length) {
+      tables.splice(tables.begin(), tables, it);
+      return it->second;
+    }
+    // too short, rebuilt below
+    erase_table(it);
+  }
+  
+  table_ptr tab = std::make_shared< const std::vector<double> >(build());
+  
+  if (table_bytes(tab) <= max_bytes) {
+    tables.push_front(table_entry(key, tab));
+    table_index[key] = tables.begin();
+    used_bytes += table_bytes(tab);
+    evict(max_bytes);
+  }
+  
+  return tab;
+}
+
+
+std::vector<double> guide_table(const std::vector<double>& tab) {
+  size_t m = tab.size();
+  std::vector<double> guide(m);
+  size_t j = 0;
+  for (size_t k = 0; k < m; k++) {
+    double p = static_cast<double>(k) / static_cast<double>(m);
+    while (j < m - 1 && tab[j] < p)
+      j++;
+    guide[k] = static_cast<double>(j);
+  }
+  return guide;
+}
+
+
+
+double get_table_cache_limit() {
+  return max_bytes;
+}
+
+double set_table_cache_limit(double bytes) {
+  double old = max_bytes;
+  if (ISNAN(bytes) || bytes < 0.0)
+    Rcpp::stop("cache limit must be a non-negative number");
+  max_bytes = bytes;
+  evict(max_bytes);
+  return old;
+}
+
+void clear_table_cache() {
+  tables.clear();
+  table_index.clear();
+  used_bytes = 0.0;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::List cpp_table_cache_info() {
+  return Rcpp::List::create(
+    Rcpp::Named("tables") = static_cast<int>(tables.size()),
+    Rcpp::Named("bytes") = used_bytes,
+    Rcpp::Named("limit") = max_bytes
+  );
+}
+
+
+// [[Rcpp::export]]
+double cpp_set_table_cache_limit(
+    const double& bytes
+  ) {
+  return set_table_cache_limit(bytes);
+}
+
+
+// [[Rcpp::export]]
+void cpp_clear_table_cache() {
+  clear_table_cache();
+}
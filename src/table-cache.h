@@ -0,0 +1,224 @@
+#ifndef EDCPP_TABLE_CACHE_H
+#define EDCPP_TABLE_CACHE_H
+
+#include <vector>
+#include <memory>
+#include <functional>
+#include <algorithm>
+#include <map>
+#include <tuple>
+
+// Process-wide cache of the probability tables used by the discrete
+// distributions (e.g. pbbinom, pnhyper), so that calls repeated with
+// the same parameters do not rebuild the same tables.
+//
+// Tables are keyed by the kind of the table and the parameter values,
+// looked up by hashing and evicted in least recently used order when
+// their total size exceeds the limit. The cache is used only from the
+// main thread.
+
+enum table_kind_t {
+  TABLE_PBBINOM = 1,
+  TABLE_PBNBINOM = 2,
+  TABLE_PGPOIS = 3,
+  TABLE_DNHYPER = 4,
+  TABLE_PNHYPER = 5,
+  TABLE_GNHYPER = 6
+};
+
+typedef std::shared_ptr< const std::vector<double> > table_ptr;
+typedef std::function< std::vector<double>() > table_builder;
+
+// Returns the table for the parameters, if it has at least `length`
+// elements, otherwise builds it with `build()` and stores the result.
+// Elements of the tables must not depend on their lengths. The pointer
+// stays valid after the table is evicted.
+
+table_ptr cached_table(int kind, double a, double b, double c,
+                       int length, table_builder build);
+
+// Longer tables of cumulative probabilities are not built, the values
+// are evaluated by the kernels instead (see tpois_table).
+
+static const double MAX_CDF_TABLE = 100000.0;
+
+// Tables of cumulative probabilities are built (or fetched from the cache)
+// only when they have at most this many elements per value that uses them,
+// otherwise evaluating the values by the kernels is cheaper. Given the
+// number of values and of distinct parameter sets, max_cdf_table() is the
+// longest table worth building (see cpp_pbbinom). To bound the memory,
+// the tables never have more than MAX_SHARED_CDF_TABLE elements (32 MB,
+// the default limit of the cache), the kernels are used above that.
+
+static const double MAX_CDF_RATIO = 64.0;
+static const double MAX_SHARED_CDF_TABLE = 4194304.0;
+
+inline double max_cdf_table(double nvalues, double nsets) {
+  double len = MAX_CDF_RATIO * nvalues / std::max(1.0, std::min(nvalues, nsets));
+  return std::min(len, MAX_SHARED_CDF_TABLE);
+}
+
+// Tables of probabilities are built only when they have at most this many
+// elements per value that uses them, otherwise evaluating the values
+// directly is cheaper (see cpp_dnhyper).
+
+static const double MAX_PMF_RATIO = 16.0;
+
+// Smallest j such that tab[j] >= p, or -1 if p exceeds the whole table
+
+inline double table_quantile(const std::vector<double>& tab, double p) {
+  std::vector<double>::const_iterator it =
+    std::lower_bound(tab.begin(), tab.end(), p);
+  if (it == tab.end())
+    return -1.0;
+  return static_cast<double>(it - tab.begin());
+}
+
+// Guide table (Chen and Asau, 1974) for the table of cumulative
+// probabilities tab: guide[k] is the smallest j such that
+// tab[j] >= k/m, where m is the length of tab. The search for p starts
+// at guide[floor(p*m)], and on average takes less than two steps.
+
+std::vector<double> guide_table(const std::vector<double>& tab);
+
+// Smallest j such that tab[j] >= p, for p in [0, 1] and tab ending
+// with 1.0
+
+inline double guided_quantile(const std::vector<double>& tab,
+                              const std::vector<double>& guide,
+                              double p) {
+  size_t m = guide.size();
+  size_t k = static_cast<size_t>(p * static_cast<double>(m));
+  if (k >= m)
+    k = m - 1;
+  // p*m may round up
+  while (k > 0 && static_cast<double>(k) / static_cast<double>(m) > p)
+    k--;
+  size_t j = static_cast<size_t>(guide[k]);
+  while (j < tab.size() - 1 && tab[j] < p)
+    j++;
+  return static_cast<double>(j);
+}
+
+// Inverse transform for a discrete distribution on lo, lo+1, ..., hi:
+// the cumulative probabilities, normalized to end with 1, with their
+// guide table. The table stays empty if the probabilities sum to zero
+// or are not finite.
+
+class InverseTable {
+
+  double lo;
+  std::vector<double> cdf, guide;
+
+public:
+
+  InverseTable() : lo(0.0) {}
+
+  template <typename Pmf>
+  InverseTable(double lo, double hi, Pmf pmf) : lo(lo) {
+    int len = static_cast<int>(hi - lo) + 1;
+    std::vector<double> tab(len);
+    double total = 0.0;
+    for (int j = 0; j < len; j++) {
+      total += pmf(lo + static_cast<double>(j));
+      tab[j] = total;
+    }
+    if (!(total > 0.0) || !R_FINITE(total))
+      return;
+    for (int j = 0; j < len; j++)
+      tab[j] /= total;
+    tab[len-1] = 1.0;
+    guide = guide_table(tab);
+    cdf.swap(tab);
+  }
+
+  bool empty() const {
+    return cdf.empty();
+  }
+
+  double quantile(double p) const {
+    return lo + guided_quantile(cdf, guide, p);
+  }
+
+};
+
+// Quantiles of a discrete distribution with parameters a, b and c
+// (recycled to the length n), for the probabilities pp on the lower tail
+// and in natural scale, where invcdf(p, a, b, c, warn) is the quantile
+// function and build(x, a, b, c) the table of cumulative probabilities
+// of 0, 1, ..., x (see cpp_qbbinom).
+//
+// Tables cover the support up to the quantile of the largest
+// probability, for each set of the parameters. They are used only
+// when they are short enough and shared by enough values, otherwise
+// the quantiles are searched for using the cdf.
+
+template <typename Invcdf, typename Builder>
+inline Rcpp::NumericVector cached_quantiles(
+    int kind, int n, const Rcpp::NumericVector& pp,
+    const Rcpp::NumericVector& a, const Rcpp::NumericVector& b,
+    const Rcpp::NumericVector& c, Invcdf invcdf, Builder build,
+    bool& throw_warning
+  ) {
+  
+  Rcpp::NumericVector x(n);
+  
+  double pmax = 0.0;
+  for (int i = 0; i < pp.length(); i++) {
+    if (pp[i] > pmax && pp[i] < 1.0)
+      pmax = pp[i];
+  }
+  
+  double max_table = max_cdf_table(
+    n, static_cast<double>(a.length()) * b.length() * c.length()
+  );
+  
+  std::map<std::tuple<int, int, int>, table_ptr> memo;
+  
+  for (int i = 0; i < n; i++) {
+    
+    if (i % 100 == 0)
+      Rcpp::checkUserInterrupt();
+    
+    double prob = GETV(pp, i);
+    double ai = GETV(a, i);
+    double bi = GETV(b, i);
+    double ci = GETV(c, i);
+    
+    // NaN's and invalid parameters give NaN bounds, so no tables
+    if (ISNAN(prob) || prob <= 0.0 || prob >= 1.0) {
+      x[i] = invcdf(prob, ai, bi, ci, throw_warning);
+      continue;
+    }
+    
+    std::tuple<int, int, int> key = std::make_tuple(
+      static_cast<int>(i % a.length()),
+      static_cast<int>(i % b.length()),
+      static_cast<int>(i % c.length())
+    );
+    
+    if (memo.find(key) == memo.end()) {
+      table_ptr& tab = memo[key];
+      double bound = invcdf(pmax, ai, bi, ci, throw_warning);
+      if (bound < max_table) {
+        tab = cached_table(kind, ai, bi, ci, to_pos_int(bound) + 1, [&]() {
+          return build(bound, ai, bi, ci);
+        });
+      }
+    }
+    
+    const table_ptr& tab = memo[key];
+    double q = tab ? table_quantile(*tab, prob) : -1.0;
+    x[i] = (q >= 0.0) ? q : invcdf(prob, ai, bi, ci, throw_warning);
+    
+  }
+  
+  return x;
+}
+
+double get_table_cache_limit();
+double set_table_cache_limit(double bytes);
+void clear_table_cache();
+
+
+#endif
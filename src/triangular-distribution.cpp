@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/triangular-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,105 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
-*  Triangular distribution
-*
-*  Values:
-*  x
-*
-*  Parameters:
-*  a
-*  b > a
-*  a <= c <= b
-*
-*  f(x)    = { (2*(x-a)) / ((b-a)*(c-a))  x < c
-*            { 2/(b-a)                    x = c
-*            { (2*(b-x)) / ((b-a)*(b-c))  x > c
-*  F(x)    = { (x-a)^2 / ((b-a)*(c-a))
-*            { 1 - ((b-x)^2 / ((b-a)*(b-c)))
-*  F^-1(p) = { a + sqrt(p*(b-a)*(c-a))    p < (c-a)/(b-a)
-*            { b - sqrt((1-p)*(b-a)*(b-c));
-*/
-
-inline double logpdf_triangular(double x, double a, double b,
-                                double c, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(a) || ISNAN(b) || ISNAN(c))
-    return x+a+b+c;
-#endif
-  if (a > c || c > b || a == b) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < a || x > b) {
-    return R_NegInf;
-  } else if (x < c) {
-    // 2.0*(x-a) / ((b-a)*(c-a));
-    return LOG_2F + log(x-a) - log(b-a) - log(c-a);
-  } else if (x > c) {
-    // 2.0*(b-x) / ((b-a)*(b-c));
-    return LOG_2F + log(b-x) - log(b-a) - log(b-c);
-  } else {
-    // 2.0/(b-a);
-    return LOG_2F - log(b-a);
-  }
-}
-
-inline double cdf_triangular(double x, double a, double b,
-                             double c, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(a) || ISNAN(b) || ISNAN(c))
-    return x+a+b+c;
-#endif
-  if (a > c || c > b || a == b) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < a) {
-    return 0.0;
-  } else if (x >= b) {
-    return 1.0;
-  } else if (x <= c) {
-    // ((x-a)*(x-a)) / ((b-a)*(c-a));
-    return exp( log(x-a) * 2.0 - log(b-a) - log(c-a) );
-  } else {
-    // 1.0 - (((b-x)*(b-x)) / ((b-a)*(b-c)));
-    return 1.0 - exp( log(b-x) * 2.0 - log(b-a) - log(b-c) );
-  }
-}
-
-inline double invcdf_triangular(double p, double a, double b,
-                                double c, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(a) || ISNAN(b) || ISNAN(c))
-    return p+a+b+c;
-#endif
-  if (a > c || c > b || a == b || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  double fc = (c-a)/(b-a);
-  if (p < fc)
-    return a + sqrt(p*(b-a)*(c-a));
-  return b - sqrt((1.0-p)*(b-a)*(b-c));
-}
-
-inline double rng_triangular(double a, double b, double c,
-                             bool& throw_warning) {
-  if (ISNAN(a) || ISNAN(b) || ISNAN(c) ||
-      a > c || c > b || a == b) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double u, v, r, cc;
-  r = b - a;
-  cc = (c-a)/r;
-  u = rng_unif();
-  v = rng_unif();
-  return ((1.0-cc) * std::min(u, v) + cc * std::max(u, v)) * r + a;
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dtriang(
     const NumericVector& x,
@@ -136,10 +38,11 @@ NumericVector cpp_dtriang(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = logpdf_triangular(GETV(x, i), GETV(a, i),
                           GETV(b, i), GETV(c, i),
-                          throw_warning);
+                          warn);
+  });
 
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -176,10 +79,11 @@ NumericVector cpp_ptriang(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_triangular(GETV(x, i), GETV(a, i),
                           GETV(b, i), GETV(c, i),
-                          throw_warning);
+                          warn);
+  });
 
   if (!lower_tail)
     p = 1.0 - p;
@@ -226,10 +130,11 @@ NumericVector cpp_qtriang(
   if (!lower_tail)
     pp = 1.0 - pp;
 
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     x[i] = invcdf_triangular(GETV(pp, i), GETV(a, i),
                              GETV(b, i), GETV(c, i),
-                             throw_warning);
+                             warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -255,9 +160,10 @@ NumericVector cpp_rtriang(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_triangular(GETV(a, i), GETV(b, i),
-                          GETV(c, i), throw_warning);
+                          GETV(c, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
@@ -1,5 +1,7 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "table-cache.h"
+#include "../inst/include/extraDistr/truncated-binomial-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,90 +15,37 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-inline double logpdf_tbinom(double x, double size, double prob, double a,
-                            double b, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(size) || ISNAN(prob) || ISNAN(a) || ISNAN(b))
-    return x+size+prob+a+b;
-#endif
-  if (size < 0.0 || !VALID_PROB(prob) || b < a || !isInteger(size, false)) {
-    throw_warning = true;
-    return NAN;
-  }
-  
-  if (!isInteger(x) || x < 0.0 || x <= a || x > b || x > size)
-    return R_NegInf;
-  
-  double pa, pb;
-  pa = R::pbinom(a, size, prob, true, false);
-  pb = R::pbinom(b, size, prob, true, false);
-  
-  return R::dbinom(x, size, prob, true) - log(pb-pa);
-}
+// With scalar parameters and support narrow enough compared to the
+// number of values, the truncated distribution is tabulated once and
+// inverted using the guide table (see also tpois_table)
 
-inline double cdf_tbinom(double x, double size, double prob, double a,
-                         double b, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(size) || ISNAN(prob) || ISNAN(a) || ISNAN(b))
-    return x+size+prob+a+b;
-#endif
-  if (size < 0.0 || !VALID_PROB(prob) || b < a ||
-      !isInteger(size, false)) {
-    throw_warning = true;
-    return NAN;
-  }
+InverseTable tbinom_table(
+    const NumericVector& size,
+    const NumericVector& prob,
+    const NumericVector& lower,
+    const NumericVector& upper,
+    double n
+  ) {
   
-  if (x < 0.0 || x <= a)
-    return 0.0;
-  if (x > b || x >= size)
-    return 1.0;
+  double s = size[0], pr = prob[0], a = lower[0], b = upper[0];
   
-  double pa, pb;
-  pa = R::pbinom(a, size, prob, true, false);
-  pb = R::pbinom(b, size, prob, true, false);
+  if (ISNAN(s) || ISNAN(pr) || ISNAN(a) || ISNAN(b) ||
+      s < 0.0 || !VALID_PROB(pr) || b < a || !isInteger(s, false))
+    return InverseTable();
   
-  return (R::pbinom(x, size, prob, true, false) - pa) / (pb-pa);
-}
-
-inline double invcdf_tbinom(double p, double size, double prob,
-                            double a, double b, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(size) || ISNAN(prob) || ISNAN(a) || ISNAN(b))
-    return p+size+prob+a+b;
-#endif
-  if (size < 0.0 || !VALID_PROB(prob) || b < a ||
-      !isInteger(size, false) || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  
-  if (p == 0.0)
-    return std::max(a, 0.0);
-  if (p == 1.0)
-    return std::min(size, b);
-  
-  double pa, pb;
-  pa = R::pbinom(a, size, prob, true, false);
-  pb = R::pbinom(b, size, prob, true, false);
+  double lo = std::max(floor(a) + 1.0, 0.0);
+  double hi = std::min(floor(b), s);
   
-  return R::qbinom(pa + p*(pb-pa), size, prob, true, false);
-}
-
-inline double rng_tbinom(double size, double prob, double a,
-                         double b, bool& throw_warning) {
-  if (ISNAN(size) || ISNAN(prob) || ISNAN(a) || ISNAN(b) ||
-      size < 0.0 || !VALID_PROB(prob) || b < a ||
-      !isInteger(size, false)) {
-    throw_warning = true;
-    return NA_REAL;
-  }
+  if (!R_FINITE(lo) || hi < lo ||
+      hi - lo + 1.0 > std::min(MAX_CDF_TABLE, 4.0 * n))
+    return InverseTable();
   
-  double u, pa, pb;
-  pa = R::pbinom(a, size, prob, true, false);
-  pb = R::pbinom(b, size, prob, true, false);
+  double mode = floor((s + 1.0) * pr);
+  double lmax = R::dbinom(std::min(std::max(mode, lo), hi), s, pr, true);
   
-  u = R::runif(pa, pb);
-  return R::qbinom(u, size, prob, true, false);
+  return InverseTable(lo, hi, [&](double x) {
+    return exp(R::dbinom(x, s, pr, true) - lmax);
+  });
 }
 
 
@@ -126,10 +75,11 @@ NumericVector cpp_dtbinom(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = logpdf_tbinom(GETV(x, i), GETV(size, i),
                          GETV(prob, i), GETV(lower, i),
-                         GETV(upper, i), throw_warning);
+                         GETV(upper, i), warn);
+  });
   
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -168,10 +118,11 @@ NumericVector cpp_ptbinom(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_tbinom(GETV(x, i), GETV(size, i),
                       GETV(prob, i), GETV(lower, i),
-                      GETV(upper, i), throw_warning);
+                      GETV(upper, i), warn);
+  });
   
   if (!lower_tail)
     p = 1.0 - p;
@@ -220,10 +171,27 @@ NumericVector cpp_qtbinom(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  for (int i = 0; i < Nmax; i++)
-    x[i] = invcdf_tbinom(GETV(pp, i), GETV(size, i),
-                         GETV(prob, i), GETV(lower, i),
-                         GETV(upper, i), throw_warning);
+  InverseTable tab;
+  
+  if (all_scalar({size.length(), prob.length(),
+                  lower.length(), upper.length()}))
+    tab = tbinom_table(size, prob, lower, upper, Nmax);
+  
+  if (!tab.empty()) {
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      if (pp[i] > 0.0 && pp[i] < 1.0)
+        x[i] = tab.quantile(pp[i]);
+      else
+        x[i] = invcdf_tbinom(pp[i], size[0], prob[0],
+                             lower[0], upper[0], warn);
+    });
+  } else {
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      x[i] = invcdf_tbinom(GETV(pp, i), GETV(size, i),
+                           GETV(prob, i), GETV(lower, i),
+                           GETV(upper, i), warn);
+    });
+  }
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -251,10 +219,23 @@ NumericVector cpp_rtbinom(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
-    x[i] = rng_tbinom(GETV(size, i), GETV(prob, i),
-                      GETV(lower, i), GETV(upper, i),
-                      throw_warning);
+  InverseTable tab;
+  
+  if (all_scalar({size.length(), prob.length(),
+                  lower.length(), upper.length()}))
+    tab = tbinom_table(size, prob, lower, upper, n);
+  
+  if (!tab.empty()) {
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+      x[i] = tab.quantile(rng_unif());
+    });
+  } else {
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+      x[i] = rng_tbinom(GETV(size, i), GETV(prob, i),
+                        GETV(lower, i), GETV(upper, i),
+                        warn);
+    });
+  }
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
@@ -1,5 +1,7 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "table-cache.h"
+#include "../inst/include/extraDistr/truncated-poisson-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,93 +15,44 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-inline double logpdf_tpois(double x, double lambda, double a,
-                           double b, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(lambda) || ISNAN(a) || ISNAN(b))
-    return x+lambda+a+b;
-#endif
-  if (lambda < 0.0 || b < a) {
-    throw_warning = true;
-    return NAN;
-  }
-  
-  if (!isInteger(x) || x < 0.0 || x <= a || x > b || !R_FINITE(x))
-    return R_NegInf;
-  
-  // if (a == 0.0 && b == R_PosInf)
-  //   return pow(lambda, x) / (factorial(x) * (exp(lambda) - 1.0));
-  
-  double pa, pb;
-  pa = R::ppois(a, lambda, true, false);
-  pb = R::ppois(b, lambda, true, false);
-  
-  return R::dpois(x, lambda, true) - log(pb-pa);
-}
+// With scalar parameters and support narrow enough compared to the
+// number of values, the truncated distribution is tabulated once and
+// inverted using the guide table, rather than calling ppois and qpois
+// for each value. For b = Inf the table ends where the remaining
+// probability is below the machine epsilon. The probabilities are
+// scaled by the largest one in the window, so that windows far in the
+// tails do not underflow.
 
-inline double cdf_tpois(double x, double lambda, double a,
-                        double b, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(lambda) || ISNAN(a) || ISNAN(b))
-    return x+lambda+a+b;
-#endif
-  if (lambda <= 0.0 || b < a) {
-    throw_warning = true;
-    return NAN;
-  }
+InverseTable tpois_table(
+    const NumericVector& lambda,
+    const NumericVector& lower,
+    const NumericVector& upper,
+    double n
+  ) {
   
-  if (x < 0.0 || x <= a)
-    return 0.0;
-  if (x > b || !R_FINITE(x))
-    return 1.0;
+  double l = lambda[0], a = lower[0], b = upper[0];
   
-  // if (a == 0.0 && b == R_PosInf)
-  //   return R::ppois(x, lambda, true, false) / (1.0 - exp(-lambda));
+  if (ISNAN(l) || ISNAN(a) || ISNAN(b) || l < 0.0 || b < a)
+    return InverseTable();
   
-  double pa, pb;
-  pa = R::ppois(a, lambda, true, false);
-  pb = R::ppois(b, lambda, true, false);
-
-  return (R::ppois(x, lambda, true, false) - pa) / (pb-pa);
-}
-
-inline double invcdf_tpois(double p, double lambda, double a,
-                           double b, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(lambda) || ISNAN(a) || ISNAN(b))
-    return p+lambda+a+b;
-#endif
-  if (lambda < 0.0 || b < a || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
+  double lo = std::max(floor(a) + 1.0, 0.0);
+  double hi = floor(b);
+  
+  if (!R_FINITE(b)) {
+    double ltail = R::ppois(lo - 1.0, l, false, true);
+    hi = R::qpois(log(std::numeric_limits<double>::epsilon()) + ltail,
+                  l, false, true);
   }
-
-  if (p == 0.0)
-    return std::max(a, 0.0);
-  if (p == 1.0)
-    return b;
   
-  double pa, pb;
-  pa = R::ppois(a, lambda, true, false);
-  pb = R::ppois(b, lambda, true, false);
+  if (!R_FINITE(lo) || !R_FINITE(hi) || hi < lo ||
+      hi - lo + 1.0 > std::min(MAX_CDF_TABLE, 4.0 * n))
+    return InverseTable();
   
-  return R::qpois(pa + p*(pb-pa), lambda, true, false);
-}
-
-inline double rng_tpois(double lambda, double a, double b,
-                        bool& throw_warning) {
-  if (ISNAN(lambda) || ISNAN(a) || ISNAN(b) ||
-      lambda < 0.0 || b < a) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-
-  double u, pa, pb;
-  pa = R::ppois(a, lambda, true, false);
-  pb = R::ppois(b, lambda, true, false);
+  double lmax = R::dpois(std::min(std::max(floor(l), lo), hi), l, true);
   
-  u = R::runif(pa, pb);
-  return R::qpois(u, lambda, true, false);
+  return InverseTable(lo, hi, [&](double x) {
+    return exp(R::dpois(x, l, true) - lmax);
+  });
 }
 
 
@@ -127,10 +80,11 @@ NumericVector cpp_dtpois(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = logpdf_tpois(GETV(x, i), GETV(lambda, i),
                         GETV(lower, i), GETV(upper, i),
-                        throw_warning);
+                        warn);
+  });
   
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -167,10 +121,11 @@ NumericVector cpp_ptpois(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_tpois(GETV(x, i), GETV(lambda, i),
                      GETV(lower, i), GETV(upper, i),
-                     throw_warning);
+                     warn);
+  });
   
   if (!lower_tail)
     p = 1.0 - p;
@@ -217,10 +172,25 @@ NumericVector cpp_qtpois(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  for (int i = 0; i < Nmax; i++)
-    x[i] = invcdf_tpois(GETV(pp, i), GETV(lambda, i),
-                        GETV(lower, i), GETV(upper, i),
-                        throw_warning);
+  InverseTable tab;
+  
+  if (all_scalar({lambda.length(), lower.length(), upper.length()}))
+    tab = tpois_table(lambda, lower, upper, Nmax);
+  
+  if (!tab.empty()) {
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      if (pp[i] > 0.0 && pp[i] < 1.0)
+        x[i] = tab.quantile(pp[i]);
+      else
+        x[i] = invcdf_tpois(pp[i], lambda[0], lower[0], upper[0], warn);
+    });
+  } else {
+    parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
+      x[i] = invcdf_tpois(GETV(pp, i), GETV(lambda, i),
+                          GETV(lower, i), GETV(upper, i),
+                          warn);
+    });
+  }
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -246,9 +216,21 @@ NumericVector cpp_rtpois(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
-    x[i] = rng_tpois(GETV(lambda, i), GETV(lower, i),
-                     GETV(upper, i), throw_warning);
+  InverseTable tab;
+  
+  if (all_scalar({lambda.length(), lower.length(), upper.length()}))
+    tab = tpois_table(lambda, lower, upper, n);
+  
+  if (!tab.empty()) {
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+      x[i] = tab.quantile(rng_unif());
+    });
+  } else {
+    parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+      x[i] = rng_tpois(GETV(lambda, i), GETV(lower, i),
+                       GETV(upper, i), warn);
+    });
+  }
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
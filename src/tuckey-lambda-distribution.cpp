@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/tuckey-lambda-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -12,43 +13,6 @@ using std::floor;
 using std::ceil;
 using Rcpp::NumericVector;
 
-/*
-Joiner, B.L., & Rosenblatt, J.R. (1971).
-Some properties of the range in samples from Tukey's symmetric lambda distributions.
-Journal of the American Statistical Association, 66(334), 394-399.
-
-Hastings Jr, C., Mosteller, F., Tukey, J.W., & Winsor, C.P. (1947).
-Low moments for small samples: a comparative study of order statistics.
-The Annals of Mathematical Statistics, 413-426.
-*/
-
-
-inline double invcdf_tlambda(double p, double lambda,
-                             bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(lambda))
-    return p+lambda;
-#endif
-  if (!VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (lambda == 0.0)
-    return log(p) - log(1.0 - p);
-  return (pow(p, lambda) - pow(1.0 - p, lambda))/lambda;
-}
-
-inline double rng_tlambda(double lambda, bool& throw_warning) {
-  if (ISNAN(lambda)) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double u = rng_unif();
-  if (lambda == 0.0)
-    return log(u) - log(1.0 - u);
-  return (pow(u, lambda) - pow(1.0 - u, lambda))/lambda;
-}
-
 
 // [[Rcpp::export]]
 NumericVector cpp_qtlambda(
@@ -77,9 +41,10 @@ NumericVector cpp_qtlambda(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     q[i] = invcdf_tlambda(GETV(pp, i), GETV(lambda, i),
-                          throw_warning);
+                          warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -103,8 +68,9 @@ NumericVector cpp_rtlambda(
   
   bool throw_warning = false;
     
-  for (int i = 0; i < n; i++)
-    x[i] = rng_tlambda(GETV(lambda, i), throw_warning);
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
+    x[i] = rng_tlambda(GETV(lambda, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
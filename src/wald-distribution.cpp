@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/wald-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -13,72 +14,6 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-/*
- * Wald distribution
- * 
- * Parameters:
- * mu > 0
- * lambda > 0
- * 
- * Values:
- * x > 0
- *
- * 
- */
-
-inline double pdf_wald(double x, double mu, double lambda,
-                       bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(lambda))
-    return x+mu+lambda;
-#endif
-  if (mu <= 0.0 || lambda <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x <= 0.0 || !R_FINITE(x))
-    return 0.0;
-  return sqrt(lambda/(2.0*M_PI*(x*x*x))) *
-         exp( (-lambda*(x-mu)*(x-mu))/(2.0*(mu*mu)*x) );
-}
-
-inline double cdf_wald(double x, double mu, double lambda,
-                       bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(lambda))
-    return x+mu+lambda;
-#endif
-  if (mu <= 0.0 || lambda <= 0.0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x <= 0.0)
-    return 0.0;
-  if (x == R_PosInf)
-    return 1.0;
-  return Phi(sqrt(lambda/x)*(x/mu-1.0)) +
-         exp((2.0*lambda)/mu) *
-         Phi(-sqrt(lambda/x)*(x/mu+1.0));
-}
-
-inline double rng_wald(double mu, double lambda, bool& throw_warning) {
-  if (ISNAN(mu) || ISNAN(lambda) || mu <= 0.0 || lambda <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double u, x, y, z;
-  u = rng_unif();
-  z = R::norm_rand();
-  y = z*z;
-  x = mu + (mu*mu*y)/(2.0*lambda) - mu/(2.0*lambda) *
-      sqrt(4.0*mu*lambda*y+(mu*mu)*(y*y));
-  if (u <= mu/(mu+x))
-    return x;
-  else
-    return (mu*mu)/x;
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dwald(
     const NumericVector& x,
@@ -100,9 +35,10 @@ NumericVector cpp_dwald(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = pdf_wald(GETV(x, i), GETV(mu, i),
-                    GETV(lambda, i), throw_warning);
+                    GETV(lambda, i), warn);
+  });
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -136,9 +72,10 @@ NumericVector cpp_pwald(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_wald(GETV(x, i), GETV(mu, i),
-                    GETV(lambda, i), throw_warning);
+                    GETV(lambda, i), warn);
+  });
   
   if (!lower_tail)
     p = 1.0 - p;
@@ -169,9 +106,10 @@ NumericVector cpp_rwald(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_wald(GETV(mu, i), GETV(lambda, i),
-                    throw_warning);
+                    warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/zero-inflated-binomial-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -14,90 +15,6 @@ using Rcpp::NumericVector;
 
 using std::log1p;
 
-/*
-* Zero-inflated Poisson distribution
-* 
-* Parameters:
-* lambda > 0
-* 0 <= pi <= 1
-* 
-* Values:
-* x >= 0
-*
-*/
-
-inline double pdf_zib(double x, double n, double p,
-                      double pi, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(n) || ISNAN(p) || ISNAN(pi))
-    return x+n+p+pi;
-#endif
-  if (!VALID_PROB(p) || n < 0.0 || !VALID_PROB(pi) ||
-      !isInteger(n, false)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0 || !isInteger(x) || !R_FINITE(x))
-    return 0.0;
-  if (x == 0.0) {
-    // pi + (1.0-pi) * pow(1.0-p, n);
-    return pi + exp( log1p(-pi) + log1p(-p) * n );
-  } else {
-    // (1.0-pi) * R::dbinom(x, n, p, false);
-    return exp( log1p(-pi) + R::dbinom(x, n, p, true) );
-  }
-}
-
-inline double cdf_zib(double x, double n, double p,
-                      double pi, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(n) || ISNAN(p) || ISNAN(pi))
-    return x+n+p+pi;
-#endif
-  if (!VALID_PROB(p) || n < 0.0 || !VALID_PROB(pi) ||
-      !isInteger(n, false)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0)
-    return 0.0;
-  if (!R_FINITE(x))
-    return 1.0;
-  // pi + (1.0-pi) * R::pbinom(x, n, p, true, false);
-  return pi + exp( log1p(-pi) + R::pbinom(x, n, p, true, true) );
-}
-
-inline double invcdf_zib(double pp, double n, double p,
-                         double pi, bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(pp) || ISNAN(n) || ISNAN(p) || ISNAN(pi))
-    return pp+n+p+pi;
-#endif
-  if (!VALID_PROB(p) || n < 0.0 || !VALID_PROB(pi) ||
-      !isInteger(n, false) || !VALID_PROB(pp)) {
-      throw_warning = true;
-    return NAN;
-  }
-  if (pp < pi)
-    return 0.0;
-  else
-    return R::qbinom((pp - pi) / (1.0-pi), n, p, true, false);
-}
-
-inline double rng_zib(double n, double p, double pi,
-                      bool& throw_warning) {
-  if (ISNAN(n) || ISNAN(p) || ISNAN(pi) || !VALID_PROB(p) ||
-      n < 0.0 || !VALID_PROB(pi) || !isInteger(n, false)) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double u = rng_unif();
-  if (u < pi)
-    return 0.0;
-  else
-    return R::rbinom(n, p);
-}
-
 
 // [[Rcpp::export]]
 NumericVector cpp_dzib(
@@ -123,10 +40,11 @@ NumericVector cpp_dzib(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = pdf_zib(GETV(x, i), GETV(size, i),
                    GETV(prob, i), GETV(pi, i),
-                   throw_warning);
+                   warn);
+  });
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -163,10 +81,11 @@ NumericVector cpp_pzib(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_zib(GETV(x, i), GETV(size, i),
                    GETV(prob, i), GETV(pi, i),
-                   throw_warning);
+                   warn);
+  });
   
   if (!lower_tail)
     p = 1.0 - p;
@@ -213,10 +132,11 @@ NumericVector cpp_qzib(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     x[i] = invcdf_zib(GETV(pp, i), GETV(size, i),
                       GETV(prob, i), GETV(pi, i),
-                      throw_warning);
+                      warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -242,9 +162,10 @@ NumericVector cpp_rzib(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_zib(GETV(size, i), GETV(prob, i),
-                   GETV(pi, i), throw_warning);
+                   GETV(pi, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
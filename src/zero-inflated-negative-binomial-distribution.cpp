@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/zero-inflated-negative-binomial-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -15,76 +16,6 @@ using Rcpp::NumericVector;
 using std::log1p;
 
 
-inline double pdf_zinb(double x, double r, double p, double pi,
-                       bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(r) || ISNAN(p) || ISNAN(pi))
-    return x+r+p+pi;
-#endif
-  if (!VALID_PROB(p) || r < 0.0 || !VALID_PROB(pi)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0 || !isInteger(x) || !R_FINITE(x))
-    return 0.0;
-  if (x == 0.0) {
-    // pi + (1.0-pi) * pow(p, r);
-    return pi + exp(log1p(-pi) + log(p) * r);
-  } else {
-    // (1.0-pi) * R::dnbinom(x, r, p, false);
-    return exp(log1p(-pi) + R::dnbinom(x, r, p, true));
-  }
-}
-
-inline double cdf_zinb(double x, double r, double p, double pi,
-                       bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(r) || ISNAN(p) || ISNAN(pi))
-    return x+r+p+pi;
-#endif
-  if (!VALID_PROB(p) || r < 0.0 || !VALID_PROB(pi)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0)
-    return 0.0;
-  if (!R_FINITE(x))
-    return 1.0;
-  // pi + (1.0-pi) * R::pnbinom(x, r, p, true, false);
-  return pi + exp(log1p(-pi) + R::pnbinom(x, r, p, true, true));
-}
-
-inline double invcdf_zinb(double pp, double r, double p, double pi,
-                          bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(pp) || ISNAN(r) || ISNAN(p) || ISNAN(pi))
-    return pp+r+p+pi;
-#endif
-  if (!VALID_PROB(p) || r < 0.0 || !VALID_PROB(pi) || !VALID_PROB(pp)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (pp < pi)
-    return 0.0;
-  else
-    return R::qnbinom((pp - pi) / (1.0-pi), r, p, true, false);
-}
-
-inline double rng_zinb(double r, double p, double pi,
-                       bool& throw_warning) {
-  if (ISNAN(r) || ISNAN(p) || ISNAN(pi) || !VALID_PROB(p) ||
-      r < 0.0 || !VALID_PROB(pi)) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double u = rng_unif();
-  if (u < pi)
-    return 0.0;
-  else
-    return R::rnbinom(r, p);
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dzinb(
     const NumericVector& x,
@@ -109,10 +40,11 @@ NumericVector cpp_dzinb(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = pdf_zinb(GETV(x, i), GETV(size, i),
                     GETV(prob, i), GETV(pi, i),
-                    throw_warning);
+                    warn);
+  });
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -149,10 +81,11 @@ NumericVector cpp_pzinb(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_zinb(GETV(x, i), GETV(size, i),
                     GETV(prob, i), GETV(pi, i),
-                    throw_warning);
+                    warn);
+  });
 
   if (!lower_tail)
     p = 1.0 - p;
@@ -199,10 +132,11 @@ NumericVector cpp_qzinb(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     x[i] = invcdf_zinb(GETV(pp, i), GETV(size, i),
                        GETV(prob, i), GETV(pi, i),
-                       throw_warning);
+                       warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -228,9 +162,10 @@ NumericVector cpp_rzinb(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_zinb(GETV(size, i), GETV(prob, i),
-                    GETV(pi, i), throw_warning);
+                    GETV(pi, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
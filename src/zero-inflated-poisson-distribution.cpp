@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "../inst/include/extraDistr/zero-inflated-poisson-distribution.h"
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -15,87 +16,6 @@ using Rcpp::NumericVector;
 using std::log1p;
 
 
-/*
-* Zero-inflated Poisson distribution
-* 
-* Parameters:
-* lambda > 0
-* 0 <= pi <= 1
-* 
-* Values:
-* x >= 0
-*
-*/
-
-inline double pdf_zip(double x, double lambda, double pi,
-                      bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(lambda) || ISNAN(pi))
-    return x+lambda+pi;
-#endif
-  if (lambda <= 0.0 || !VALID_PROB(pi)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0 || !isInteger(x) || !R_FINITE(x))
-    return 0.0;
-  if (x == 0.0) {
-    // pi + (1.0-pi) * exp(-lambda);
-    return pi + exp( log1p(-pi) - lambda );
-  } else {
-    // (1.0-pi) * R::dpois(x, lambda, false);
-    return exp( log1p(-pi) + R::dpois(x, lambda, true) );
-  }
-}
-
-inline double cdf_zip(double x, double lambda, double pi,
-                      bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(lambda) || ISNAN(pi))
-    return x+lambda+pi;
-#endif
-  if (lambda <= 0.0 || !VALID_PROB(pi)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0)
-    return 0.0;
-  if (!R_FINITE(x))
-    return 1.0;
-  // pi + (1.0-pi) * R::ppois(x, lambda, true, false);
-  return pi + exp(log1p(-pi) + R::ppois(x, lambda, true, true));
-}
-
-inline double invcdf_zip(double p, double lambda, double pi,
-                         bool& throw_warning) {
-#ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(lambda) || ISNAN(pi))
-    return p+lambda+pi;
-#endif
-  if (lambda <= 0.0 || !VALID_PROB(pi) || !VALID_PROB(p)) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (p < pi)
-    return 0.0;
-  else
-    return R::qpois((p - pi) / (1.0-pi), lambda, true, false);
-}
-
-inline double rng_zip(double lambda, double pi, bool& throw_warning) {
-  if (ISNAN(lambda) || ISNAN(pi) ||
-      lambda <= 0.0 || !VALID_PROB(pi)) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double u = rng_unif();
-  if (u < pi)
-    return 0.0;
-  else
-    return R::rpois(lambda);
-}
-
-
 // [[Rcpp::export]]
 NumericVector cpp_dzip(
     const NumericVector& x,
@@ -117,9 +37,10 @@ NumericVector cpp_dzip(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = pdf_zip(GETV(x, i), GETV(lambda, i),
-                   GETV(pi, i), throw_warning);
+                   GETV(pi, i), warn);
+  });
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -153,9 +74,10 @@ NumericVector cpp_pzip(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     p[i] = cdf_zip(GETV(x, i), GETV(lambda, i),
-                   GETV(pi, i), throw_warning);
+                   GETV(pi, i), warn);
+  });
   
   if (!lower_tail)
     p = 1.0 - p;
@@ -199,9 +121,10 @@ NumericVector cpp_qzip(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  for (int i = 0; i < Nmax; i++)
+  parallel_for(Nmax, throw_warning, [&](int i, bool& warn) {
     x[i] = invcdf_zip(GETV(pp, i), GETV(lambda, i),
-                      GETV(pi, i), throw_warning);
+                      GETV(pi, i), warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -226,9 +149,10 @@ NumericVector cpp_rzip(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
+  parallel_rng_for(n, throw_warning, [&](int i, bool& warn) {
     x[i] = rng_zip(GETV(lambda, i), GETV(pi, i),
-                   throw_warning);
+                   warn);
+  });
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
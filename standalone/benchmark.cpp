@@ -0,0 +1,85 @@
+// Benchmark of the scalar kernels built against the core library
+//
+// Usage: extraDistr_benchmark [n]
+//
+// Each kernel is called n times (default 10^6), the time per call
+// is reported in nanoseconds.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "extraDistr/kernels.h"
+
+using namespace extraDistr;
+
+typedef std::chrono::steady_clock bench_clock;
+
+template <typename Kernel>
+static void bench(const char* name, int n, Kernel kernel) {
+  bool throw_warning = false;
+  double sum = 0.0;
+  bench_clock::time_point start = bench_clock::now();
+  for (int i = 0; i < n; i++)
+    sum += kernel(i, throw_warning);
+  double ns = std::chrono::duration<double, std::nano>(
+    bench_clock::now() - start
+  ).count();
+  // the sum is printed so the loop is not optimized away
+  std::printf("%-16s %10.1f ns/call   (sum = %g%s)\n", name, ns / n, sum,
+              throw_warning ? ", NaNs produced" : "");
+}
+
+int main(int argc, char** argv) {
+
+  int n = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+  if (n < 1) {
+    std::fprintf(stderr, "n must be a positive integer\n");
+    return 1;
+  }
+
+  set_seed(42);
+
+  bench("pdf_tnorm", n, [n](int i, bool& w) {
+    return pdf_tnorm(-2.0 + 4.0 * i / n, 0.0, 1.0, -1.0, 1.5, w);
+  });
+  bench("cdf_huber", n, [n](int i, bool& w) {
+    return cdf_huber(-5.0 + 10.0 * i / n, 0.0, 1.0, 1.345, true, false, w);
+  });
+  bench("logpmf_bbinom", n, [](int i, bool& w) {
+    return logpmf_bbinom(i % 51, 50.0, 2.0, 3.0, w);
+  });
+  bench("invcdf_tlambda", n, [n](int i, bool& w) {
+    return invcdf_tlambda((i + 0.5) / n, 0.14, w);
+  });
+  bench("rng_tnorm", n, [](int, bool& w) {
+    return rng_tnorm(0.0, 1.0, -1.0, 1.5, w);
+  });
+  // normal and exponential draws by inversion and by the ziggurat method,
+  // rng_tnorm on (-2, 2) uses rejection from the normal distribution
+  for (int kind = NORM_INVERSION; kind <= NORM_ZIGGURAT; kind++) {
+    bool zig = (kind == NORM_ZIGGURAT);
+    rng_norm_kind() = kind;
+    bench(zig ? "rng_norm (zig)" : "rng_norm", n, [](int, bool&) {
+      return rng_norm();
+    });
+    bench(zig ? "rng_exp (zig)" : "rng_exp", n, [](int, bool&) {
+      return rng_exp();
+    });
+    bench(zig ? "tnorm_wide (zig)" : "tnorm_wide", n, [](int, bool& w) {
+      return rng_tnorm(0.0, 1.0, -2.0, 2.0, w);
+    });
+  }
+  rng_norm_kind() = NORM_INVERSION;
+
+  bench("rng_wald", n, [](int, bool& w) {
+    return rng_wald(1.0, 2.0, w);
+  });
+  bench("rng_gamma", n, [](int, bool&) {
+    return rng_gamma(2.5, 1.0);
+  });
+  bench("rng_binom", n, [](int, bool&) {
+    return rng_binom(100.0, 0.3);
+  });
+
+  return 0;
+}
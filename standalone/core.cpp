@@ -0,0 +1,28 @@
+// Core library of the extraDistr kernels, built without R, see
+// CMakeLists.txt in the top-level directory of the package sources
+
+#include <atomic>
+#include "extraDistr/kernels.h"
+
+namespace extraDistr {
+
+// threads that never call set_seed() use seed 0 and a stream number
+// assigned in the order in which they first draw random numbers
+
+static std::atomic<uint64_t> next_default_stream(0);
+
+static PhiloxStream& thread_stream() {
+  static thread_local PhiloxStream stream(0, next_default_stream++);
+  return stream;
+}
+
+PhiloxStream& default_stream() {
+  return thread_stream();
+}
+
+void set_seed(uint64_t seed, uint64_t stream) {
+  thread_stream() = PhiloxStream(seed, stream);
+  rng_stream() = &thread_stream();
+}
+
+}